@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+#
+# Compare two result files of bench-SFCGAL (written with SFCGAL_BENCH_JSON=file)
+# and flag the measures which got slower or allocate more.
+#
+# usage: bench-compare.py baseline.json contender.json [--threshold 0.10] [--metric median_time]
+#
+# Exits with status 1 if a regression is found.
+
+import argparse
+import json
+import sys
+
+
+def load(filename):
+    with open(filename) as f:
+        data = json.load(f)
+    return dict((b["name"], b) for b in data["benchmarks"])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="compare two bench-SFCGAL JSON result files")
+    parser.add_argument("baseline")
+    parser.add_argument("contender")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="relative slowdown reported as a regression (default 0.10)")
+    parser.add_argument("--metric", default="median_time",
+                        choices=["min_time", "median_time", "mean_time"],
+                        help="time compared (default median_time)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    contender = load(args.contender)
+
+    regressions = 0
+    print("%-48s %12s %12s %9s %12s" % ("benchmark", "baseline", "contender", "change", "allocations"))
+
+    for name in sorted(set(baseline) | set(contender)):
+        if name not in contender:
+            print("%-48s %12s" % (name, "removed"))
+            continue
+        if name not in baseline:
+            print("%-48s %12s %12.6g" % (name, "new", contender[name][args.metric]))
+            continue
+
+        old = baseline[name][args.metric]
+        new = contender[name][args.metric]
+        change = (new - old) / old if old > 0 else 0.0
+
+        oldAlloc = baseline[name].get("allocations", 0)
+        newAlloc = contender[name].get("allocations", 0)
+        allocChange = (newAlloc - oldAlloc) / oldAlloc if oldAlloc > 0 else 0.0
+
+        # a slowdown within the noise of both measures is not reported
+        noise = baseline[name].get("stddev_time", 0) + contender[name].get("stddev_time", 0)
+        slower = change > args.threshold and new - old > noise
+        flag = ""
+        if slower or allocChange > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+
+        print("%-48s %12.6g %12.6g %+8.1f%% %+11.1f%%%s"
+              % (name, old, new, 100.0 * change, 100.0 * allocChange, flag))
+
+    if regressions:
+        print("%d regression(s) above %.0f%%" % (regressions, 100.0 * args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
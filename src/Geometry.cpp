@@ -21,6 +21,17 @@
 #include <SFCGAL/Geometry.h>
 
 #include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/MultiPoint.h>
+#include <SFCGAL/MultiLineString.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/GeometryVisitor.h>
 #include <SFCGAL/detail/io/WktWriter.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
@@ -35,6 +46,8 @@
 
 #include <SFCGAL/Kernel.h>
 
+#include <algorithm>
+
 namespace SFCGAL {
 
 ///
@@ -51,22 +64,10 @@ Geometry::~Geometry()
 ///
 std::string Geometry::asText( const int& numDecimals ) const
 {
-    std::ostringstream oss;
-
-    if ( numDecimals >= 0 ) {
-        oss << std::fixed ;
-        oss.precision( numDecimals );
-    }
-
-    detail::io::WktWriter writer( oss );
-    bool exact = false;
-
-    if ( numDecimals == -1 ) {
-        exact = true;
-    }
-
-    writer.write( *this, exact );
-    return oss.str();
+    std::string wkt;
+    detail::io::WktWriter writer( wkt, numDecimals );
+    writer.write( *this, numDecimals == -1 );
+    return wkt;
 }
 
 ///
@@ -139,6 +140,7 @@ const Geometry&    Geometry::geometryN( size_t const& n ) const
 ///
 Geometry&   Geometry::geometryN( size_t const& n )
 {
+    touch();
     BOOST_ASSERT( n == 0 );
     ( void )n;
     return *this ;
@@ -148,7 +150,10 @@ Geometry&   Geometry::geometryN( size_t const& n )
 ///
 ///
 ///
-Geometry::Geometry() : validityFlag_( false )
+Geometry::Geometry() :
+    validityFlag_( false ),
+    generation_( 0 ),
+    validityCache_( 0 )
 {
 
 }
@@ -156,7 +161,10 @@ Geometry::Geometry() : validityFlag_( false )
 ///
 ///
 ///
-Geometry::Geometry( Geometry const& other ) : validityFlag_( other.validityFlag_ )
+Geometry::Geometry( Geometry const& other ) :
+    validityFlag_( other.validityFlag_ ),
+    generation_( 0 ),
+    validityCache_( 0 )
 {
 
 }
@@ -164,6 +172,7 @@ Geometry::Geometry( Geometry const& other ) : validityFlag_( other.validityFlag_
 Geometry& Geometry::operator=( const Geometry& other )
 {
     validityFlag_ = other.validityFlag_;
+    touch();
     return *this;
 }
 
@@ -177,6 +186,158 @@ void Geometry::forceValidityFlag( bool valid )
         validityFlag_ = valid;
 }
 
+namespace {
+// the three low bits of the validity cache hold the ValidityCheck flags
+const boost::uint64_t VALIDITY_CHECK_MASK = 7;
+
+// last generation given by Geometry::touch()
+std::atomic< boost::uint64_t > lastGeneration( 0 );
+
+//
+// greatest generation of a geometry and of its parts
+class DeepGenerationVisitor : public ConstGeometryVisitor {
+public:
+    boost::uint64_t generation;
+
+    DeepGenerationVisitor() : generation( 0 ) {}
+
+    virtual void visit( const Point& g ) {
+        add( g );
+    }
+
+    virtual void visit( const LineString& g ) {
+        add( g );
+
+        // the points of a compact LineString are views, modified through it
+        if ( g.isCompact() ) {
+            return;
+        }
+
+        for ( size_t i = 0; i < g.numPoints(); i++ ) {
+            visit( g.pointN( i ) );
+        }
+    }
+
+    virtual void visit( const Polygon& g ) {
+        add( g );
+
+        for ( size_t i = 0; i < g.numRings(); i++ ) {
+            visit( g.ringN( i ) );
+        }
+    }
+
+    virtual void visit( const Triangle& g ) {
+        add( g );
+
+        for ( int i = 0; i < 3; i++ ) {
+            visit( g.vertex( i ) );
+        }
+    }
+
+    virtual void visit( const Solid& g ) {
+        add( g );
+
+        for ( size_t i = 0; i < g.numShells(); i++ ) {
+            visit( g.shellN( i ) );
+        }
+    }
+
+    virtual void visit( const MultiPoint& g ) {
+        visitCollection( g );
+    }
+
+    virtual void visit( const MultiLineString& g ) {
+        visitCollection( g );
+    }
+
+    virtual void visit( const MultiPolygon& g ) {
+        visitCollection( g );
+    }
+
+    virtual void visit( const MultiSolid& g ) {
+        visitCollection( g );
+    }
+
+    virtual void visit( const GeometryCollection& g ) {
+        visitCollection( g );
+    }
+
+    virtual void visit( const PolyhedralSurface& g ) {
+        add( g );
+
+        for ( size_t i = 0; i < g.numPolygons(); i++ ) {
+            visit( g.polygonN( i ) );
+        }
+    }
+
+    virtual void visit( const TriangulatedSurface& g ) {
+        add( g );
+
+        for ( size_t i = 0; i < g.numTriangles(); i++ ) {
+            visit( g.triangleN( i ) );
+        }
+    }
+
+    using ConstGeometryVisitor::visit;
+
+private:
+    void add( const Geometry& g ) {
+        generation = std::max( generation, g.generation() );
+    }
+
+    void visitCollection( const GeometryCollection& g ) {
+        add( g );
+
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            g.geometryN( i ).accept( *this );
+        }
+    }
+};
+}
+
+///
+///
+///
+boost::uint64_t Geometry::deepGeneration() const
+{
+    DeepGenerationVisitor visitor;
+    accept( visitor );
+    return visitor.generation;
+}
+
+///
+///
+///
+void Geometry::touch()
+{
+    generation_ = lastGeneration.fetch_add( 1, std::memory_order_relaxed ) + 1;
+}
+
+///
+///
+///
+bool Geometry::hasCachedValidity( ValidityCheck check ) const
+{
+    const boost::uint64_t cache = validityCache_.load( std::memory_order_acquire );
+    return ( cache & check ) && ( cache & ~VALIDITY_CHECK_MASK ) == ( deepGeneration() << 3 );
+}
+
+///
+///
+///
+void Geometry::cacheValidity( ValidityCheck check ) const
+{
+    const boost::uint64_t key = deepGeneration() << 3;
+    boost::uint64_t cache = validityCache_.load( std::memory_order_relaxed );
+    boost::uint64_t updated;
+
+    // checks of a previous generation are forgotten
+    do {
+        updated = ( ( cache & ~VALIDITY_CHECK_MASK ) == key ? cache : key ) | check;
+    }
+    while ( ! validityCache_.compare_exchange_weak( cache, updated, std::memory_order_release, std::memory_order_relaxed ) );
+}
+
 ///
 /// Function used to compare geometries
 /// FIXME
@@ -25,10 +25,13 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <sstream>
 
+#include <boost/cstdint.hpp>
+
 #include <boost/assert.hpp>
 
 namespace CGAL {
@@ -175,9 +178,54 @@ public:
     /** Returns the validity flag */
     bool hasValidityFlag() const;
 
+    /**
+     * Validity checks whose success is cached by the geometry
+     * @see SFCGAL_ASSERT_GEOMETRY_VALIDITY
+     */
+    enum ValidityCheck {
+        VALIDITY_CHECK_DEFAULT = 1, ///< validity of the geometry
+        VALIDITY_CHECK_2D      = 2, ///< validity of the geometry converted to 2D
+        VALIDITY_CHECK_3D      = 4  ///< validity of the geometry converted to 3D
+    };
+
+    /**
+     * Returns the generation of the geometry, renewed by every function that
+     * may modify it (including the non const accessors to its parts)
+     */
+    inline boost::uint64_t generation() const {
+        return generation_;
+    }
+
+    /**
+     * Returns the greatest generation of the geometry and of its parts (down to
+     * the points), which changes when a part is modified through a reference
+     * obtained before.
+     */
+    boost::uint64_t deepGeneration() const;
+
+    /**
+     * Gives the geometry a new generation, taken from a process wide counter so that
+     * it is greater than every previous one. This invalidates the validity cache of
+     * the geometry and of the geometries containing it.
+     */
+    void touch();
+
+    /**
+     * Tests if a validity check succeeded on the current deep generation of the geometry
+     * @note thread safe
+     */
+    bool hasCachedValidity( ValidityCheck check ) const;
+
+    /**
+     * Records that a validity check succeeded on the current deep generation of the geometry
+     * @note thread safe
+     */
+    void cacheValidity( ValidityCheck check ) const;
+
     /**
      * [OGC/SFA]returns the WKT string
-     * @param numDecimals extension specify fix precision output
+     * @param numDecimals extension specify fix precision output (-1 for the exact rational
+     * representation, lower than -1 for the shortest decimal representation of the rounded coordinates)
      */
     std::string          asText( const int& numDecimals = -1 ) const ;
 
@@ -285,6 +333,12 @@ protected:
     Geometry& operator=( const Geometry& other );
 
     bool validityFlag_;
+    boost::uint64_t generation_;
+    /**
+     * generation of the last successful validity checks (high bits) and
+     * the ValidityCheck flags of these checks (low bits)
+     */
+    mutable std::atomic< boost::uint64_t > validityCache_;
 };
 
 /**
@@ -52,6 +52,7 @@ GeometryCollection::GeometryCollection( GeometryCollection const& other ):
 ///
 GeometryCollection& GeometryCollection::operator = ( GeometryCollection other )
 {
+    touch();
     swap( other );
     return *this ;
 }
@@ -160,6 +161,7 @@ const Geometry&    GeometryCollection::geometryN( size_t const& n ) const
 ///
 Geometry&          GeometryCollection::geometryN( size_t const& n )
 {
+    touch();
     return _geometries[n];
 }
 
@@ -169,6 +171,7 @@ Geometry&          GeometryCollection::geometryN( size_t const& n )
 ///
 void    GeometryCollection::addGeometry( Geometry* geometry )
 {
+    touch();
     BOOST_ASSERT( geometry != NULL );
 
     if ( ! isAllowed( *geometry ) ) {
@@ -203,6 +206,7 @@ bool GeometryCollection::isAllowed( Geometry const& )
 ///
 void GeometryCollection::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
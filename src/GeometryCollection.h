@@ -94,6 +94,7 @@ public:
     //-- iterators
 
     inline iterator       begin() {
+        touch();
         return _geometries.begin() ;
     }
     inline const_iterator begin() const {
@@ -101,6 +102,7 @@ public:
     }
 
     inline iterator       end() {
+        touch();
         return _geometries.end() ;
     }
     inline const_iterator end() const {
@@ -22,6 +22,7 @@
 #define _SFCGAL_KERNEL_H_
 
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 
 namespace SFCGAL {
 
@@ -31,6 +32,15 @@ namespace SFCGAL {
 typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel ;
 
 
+/**
+ * Kernel with exact predicates on double coordinates.
+ *
+ * Only used by algorithms which evaluate predicates or return a double
+ * (see detail::InexactGeometrySet), never to build a result geometry.
+ */
+typedef CGAL::Exact_predicates_inexact_constructions_kernel InexactKernel ;
+
+
 /**
  * Quotient type
  */
@@ -21,6 +21,8 @@
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/GeometryVisitor.h>
 
+#include <mutex>
+
 namespace SFCGAL {
 
 ///
@@ -28,7 +30,8 @@ namespace SFCGAL {
 ///
 LineString::LineString():
     Geometry(),
-    _points()
+    _points(),
+    _materialized( false )
 {
 
 }
@@ -38,7 +41,8 @@ LineString::LineString():
 ///
 LineString::LineString( const std::vector< Point >& points ):
     Geometry(),
-    _points()
+    _points(),
+    _materialized( false )
 {
     for ( size_t i = 0; i < points.size(); i++ ) {
         _points.push_back( points[i].clone() ) ;
@@ -50,18 +54,37 @@ LineString::LineString( const std::vector< Point >& points ):
 ///
 LineString::LineString( const Point& startPoint, const Point& endPoint ):
     Geometry(),
-    _points()
+    _points(),
+    _materialized( false )
 {
     _points.push_back( startPoint.clone() );
     _points.push_back( endPoint.clone() );
 }
 
+///
+///
+///
+LineString::LineString( const detail::CoordinateBuffer& coordinates ):
+    Geometry(),
+    _points(),
+    _coordinates( new detail::CoordinateBuffer( coordinates ) ),
+    _materialized( false )
+{
+
+}
+
 ///
 ///
 ///
 LineString::LineString( const LineString& other ):
-    Geometry()
+    Geometry(),
+    _materialized( false )
 {
+    if ( other._coordinates.get() ) {
+        _coordinates.reset( new detail::CoordinateBuffer( *other._coordinates ) );
+        return;
+    }
+
     for ( size_t i = 0; i < other.numPoints(); i++ ) {
         _points.push_back( other.pointN( i ).clone() ) ;
     }
@@ -72,6 +95,7 @@ LineString::LineString( const LineString& other ):
 ///
 LineString& LineString::operator = ( LineString other )
 {
+    touch();
     swap( other );
     return *this ;
 }
@@ -121,6 +145,10 @@ int LineString::dimension() const
 ///
 int   LineString::coordinateDimension() const
 {
+    if ( _coordinates.get() ) {
+        return isEmpty() ? 0 : 2 + ( _coordinates->is3D() ? 1 : 0 ) + ( _coordinates->isMeasured() ? 1 : 0 ) ;
+    }
+
     return isEmpty() ? 0 : _points[0].coordinateDimension() ;
 }
 
@@ -129,7 +157,7 @@ int   LineString::coordinateDimension() const
 ///
 bool   LineString::isEmpty() const
 {
-    return _points.empty() ;
+    return numPoints() == 0 ;
 }
 
 ///
@@ -137,6 +165,10 @@ bool   LineString::isEmpty() const
 ///
 bool  LineString::is3D() const
 {
+    if ( _coordinates.get() ) {
+        return ! isEmpty() && _coordinates->is3D() ;
+    }
+
     return ! isEmpty() && startPoint().is3D() ;
 }
 
@@ -145,6 +177,10 @@ bool  LineString::is3D() const
 ///
 bool  LineString::isMeasured() const
 {
+    if ( _coordinates.get() ) {
+        return ! isEmpty() && _coordinates->isMeasured() ;
+    }
+
     return ! isEmpty() && startPoint().isMeasured() ;
 }
 
@@ -153,7 +189,13 @@ bool  LineString::isMeasured() const
 ///
 void LineString::clear()
 {
+    touch();
     _points.clear();
+
+    if ( _coordinates.get() ) {
+        _coordinates->clear();
+        _materialized = false;
+    }
 }
 
 ///
@@ -161,6 +203,11 @@ void LineString::clear()
 ///
 void LineString::reverse()
 {
+    touch();
+    if ( _coordinates.get() ) {
+        _coordinates->reverse();
+    }
+
     std::reverse( _points.begin(), _points.end() );
 }
 
@@ -169,11 +216,11 @@ void LineString::reverse()
 ///
 size_t LineString::numSegments() const
 {
-    if ( _points.empty() ) {
+    if ( isEmpty() ) {
         return 0 ;
     }
     else {
-        return _points.size() - 1 ;
+        return numPoints() - 1 ;
     }
 }
 
@@ -182,6 +229,12 @@ size_t LineString::numSegments() const
 ///
 bool LineString::isClosed() const
 {
+    if ( _coordinates.get() ) {
+        const detail::CoordinateBuffer& c = *_coordinates;
+        const size_t last = c.size() - 1;
+        return ( ! isEmpty() ) && c.x( 0 ) == c.x( last ) && c.y( 0 ) == c.y( last ) && c.z( 0 ) == c.z( last ) ;
+    }
+
     return ( ! isEmpty() ) && ( startPoint() == endPoint() ) ;
 }
 
@@ -190,15 +243,103 @@ bool LineString::isClosed() const
 ///
 void LineString::reserve( const size_t& n )
 {
+    if ( _coordinates.get() ) {
+        _coordinates->reserve( n );
+        return;
+    }
+
     _points.reserve( n ) ;
 }
 
+///
+///
+///
+bool LineString::compact()
+{
+    if ( _coordinates.get() ) {
+        return true;
+    }
+
+    std::unique_ptr< detail::CoordinateBuffer > coordinates( new detail::CoordinateBuffer( is3D(), isMeasured() ) );
+    coordinates->reserve( _points.size() );
+
+    for ( const_iterator it = _points.begin(); it != _points.end(); ++it ) {
+        if ( ! coordinates->push_back( *it ) ) {
+            return false;
+        }
+    }
+
+    _points.clear();
+    _coordinates.swap( coordinates );
+    _materialized = false;
+    return true;
+}
+
+///
+///
+///
+void LineString::materialize() const
+{
+    // materialization is rare, a single mutex is enough
+    static std::mutex mutex;
+    std::lock_guard< std::mutex > lock( mutex );
+
+    if ( _materialized.load( std::memory_order_relaxed ) ) {
+        return;
+    }
+
+    BOOST_ASSERT( _coordinates.get() );
+    _points.clear();
+    _points.reserve( _coordinates->size() );
+
+    for ( size_t i = 0; i < _coordinates->size(); i++ ) {
+        _points.push_back( new Point( _coordinates->pointN( i ) ) );
+    }
+
+    _materialized.store( true, std::memory_order_release );
+}
+
+///
+///
+///
+void LineString::uncompact()
+{
+    points();
+    _coordinates.reset();
+    _materialized = false;
+}
+
+///
+///
+///
+void LineString::addCompactPoint( const Point& p )
+{
+    BOOST_ASSERT( _coordinates.get() );
+
+    if ( _coordinates->empty() ) {
+        *_coordinates = detail::CoordinateBuffer( p.is3D(), p.isMeasured() );
+    }
+
+    if ( _coordinates->push_back( p ) ) {
+        // keep Point views up to date
+        if ( _materialized ) {
+            _points.push_back( p.clone() );
+        }
+
+        return;
+    }
+
+    uncompact();
+    _points.push_back( p.clone() );
+}
+
 
 ///
 ///
 ///
 void LineString::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
@@ -219,27 +360,25 @@ CGAL::Polygon_2< Kernel > LineString::toPolygon_2( bool fixOrientation ) const
         return CGAL::Polygon_2< Kernel >();
     }
 
-    Point_2_const_iterator pend = points_2_end();
     // skip the last point
-    pend--;
+    const size_t n = numPoints() - 1;
 
     // skip double points
     // TODO: what to do with cycles ?
     std::list<Kernel::Point_2> points;
     Kernel::Point_2 lastP;
 
-    for ( Point_2_const_iterator pit = points_2_begin(); pit != pend; ++pit ) {
-        if ( pit == points_2_begin() ) {
-            lastP = *pit;
-            points.push_back( *pit );
-            continue;
-        }
+    for ( size_t i = 0; i < n; ++i ) {
+        // compact LineStrings don't need Point objects
+        const Kernel::Point_2 p = _coordinates.get()
+                                  ? Kernel::Point_2( _coordinates->x( i ), _coordinates->y( i ) )
+                                  : _points[i].toPoint_2();
 
-        if ( lastP != *pit ) {
-            points.push_back( *pit );
+        if ( i == 0 || lastP != p ) {
+            points.push_back( p );
         }
 
-        lastP = *pit;
+        lastP = p;
     }
 
     CGAL::Polygon_2< Kernel > result( points.begin(), points.end() );
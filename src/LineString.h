@@ -21,6 +21,8 @@
 #ifndef _SFCGAL_LINESTRING_H_
 #define _SFCGAL_LINESTRING_H_
 
+#include <atomic>
+#include <memory>
 #include <vector>
 
 #include <boost/assert.hpp>
@@ -29,6 +31,7 @@
 #include <boost/ptr_container/serialize_ptr_vector.hpp>
 
 #include <SFCGAL/Point.h>
+#include <SFCGAL/detail/CoordinateBuffer.h>
 
 #include <CGAL/Polygon_2.h>
 
@@ -55,6 +58,10 @@ public:
      * LineString constructor
      */
     LineString( const Point& startPoint, const Point& endPoint ) ;
+    /**
+     * Compact LineString constructor (see compact())
+     */
+    explicit LineString( const detail::CoordinateBuffer& coordinates ) ;
     /**
      * Copy constructor
      */
@@ -102,7 +109,7 @@ public:
      * [SFA/OGC]Returns the number of points
      */
     inline size_t          numPoints() const {
-        return _points.size();
+        return _coordinates.get() ? _coordinates->size() : _points.size();
     }
     /**
      * Returns the number of segments
@@ -116,14 +123,16 @@ public:
      */
     inline const Point&    pointN( size_t const& n ) const {
         BOOST_ASSERT( n < numPoints() ) ;
-        return _points[n];
+        return points()[n];
     }
     /**
      * [SFA/OGC]Returns the n-th point
+     * @warning the returned Point may be modified, so that a compact LineString
+     * goes back to Point storage. Read through a const LineString& to keep it compact.
      */
     inline Point&          pointN( size_t const& n ) {
         BOOST_ASSERT( n < numPoints() ) ;
-        return _points[n];
+        return mutablePoints()[n];
     }
 
 
@@ -131,13 +140,14 @@ public:
      * [SFA/OGC]Returns the first point
      */
     inline const Point&    startPoint() const {
-        return _points.front();
+        return points().front();
     }
     /**
      * [SFA/OGC]Returns the first point
+     * @warning turns a compact LineString back to Point storage
      */
     inline Point&          startPoint() {
-        return _points.front();
+        return mutablePoints().front();
     }
 
 
@@ -145,13 +155,14 @@ public:
      * [SFA/OGC]Returns the first point
      */
     inline const Point&    endPoint() const {
-        return _points.back();
+        return points().back();
     }
     /**
      * [SFA/OGC]Returns the first point
+     * @warning turns a compact LineString back to Point storage
      */
     inline Point&          endPoint() {
-        return _points.back();
+        return mutablePoints().back();
     }
 
 
@@ -159,12 +170,25 @@ public:
      * append a Point to the LineString
      */
     inline void            addPoint( const Point& p ) {
+        touch();
+        if ( _coordinates.get() ) {
+            addCompactPoint( p );
+            return;
+        }
+
         _points.push_back( p.clone() ) ;
     }
     /**
      * append a Point to the LineString and takes ownership
      */
     inline void            addPoint( Point* p ) {
+        touch();
+        if ( _coordinates.get() ) {
+            addCompactPoint( *p );
+            delete p;
+            return;
+        }
+
         _points.push_back( p ) ;
     }
 
@@ -179,24 +203,53 @@ public:
 
     //-- iterators
 
+    /**
+     * @warning non const iterators turn a compact LineString back to Point storage
+     */
     inline iterator       begin() {
-        return _points.begin() ;
+        return mutablePoints().begin() ;
     }
     inline const_iterator begin() const {
-        return _points.begin() ;
+        return points().begin() ;
     }
 
     inline iterator       end() {
-        return _points.end() ;
+        return mutablePoints().end() ;
     }
     inline const_iterator end() const {
-        return _points.end() ;
+        return points().end() ;
     }
 
     //-- optimization
 
     void reserve( const size_t& n ) ;
 
+    /**
+     * Store the coordinates in a contiguous detail::CoordinateBuffer instead
+     * of one Point object per vertex. Point objects are then created on demand,
+     * on the first call to a const accessor returning a Point (pointN(),
+     * startPoint(), begin()...). Non const accessors returning a Point turn
+     * the LineString back to the regular storage.
+     *
+     * @return false (the LineString is left unchanged) if coordinates are
+     * not exactly representable by doubles or do not share the same type
+     */
+    bool compact() ;
+
+    /**
+     * true if coordinates are stored in a detail::CoordinateBuffer
+     */
+    inline bool isCompact() const {
+        return _coordinates.get() != NULL ;
+    }
+
+    /**
+     * Coordinate buffer of a compact LineString, NULL otherwise
+     */
+    inline const detail::CoordinateBuffer* coordinates() const {
+        return _coordinates.get() ;
+    }
+
 
     /**
      * Const iterator to 2D points
@@ -301,13 +354,63 @@ public:
     template <class Archive>
     void serialize( Archive& ar, const unsigned int /*version*/ ) {
         ar& boost::serialization::base_object<Geometry>( *this );
+
+        // compact LineStrings are serialized as Point objects
+        if ( Archive::is_saving::value ) {
+            points();
+        }
+        else {
+            _coordinates.reset();
+            _materialized = false;
+        }
+
         ar& _points;
     }
 private:
-    boost::ptr_vector< Point > _points ;
+    /**
+     * Point objects, or Point views of the coordinate buffer
+     */
+    mutable boost::ptr_vector< Point > _points ;
+    /**
+     * coordinate buffer of a compact LineString
+     */
+    std::unique_ptr< detail::CoordinateBuffer > _coordinates ;
+    /**
+     * true once _points has been built from _coordinates
+     */
+    mutable std::atomic< bool > _materialized ;
+
+    inline const boost::ptr_vector< Point >& points() const {
+        if ( _coordinates.get() && ! _materialized.load( std::memory_order_acquire ) ) {
+            materialize();
+        }
+
+        return _points;
+    }
+
+    inline boost::ptr_vector< Point >& mutablePoints() {
+        touch();
+        if ( _coordinates.get() ) {
+            uncompact();
+        }
+
+        return _points;
+    }
+
+    /**
+     * build Point views of the coordinate buffer (thread safe)
+     */
+    void materialize() const ;
+    /**
+     * go back to Point storage
+     */
+    void uncompact() ;
+    void addCompactPoint( const Point& p ) ;
 
     void swap( LineString& other ) {
         std::swap( _points, other._points );
+        std::swap( _coordinates, other._coordinates );
+        _materialized = other._materialized.exchange( _materialized );
     }
 };
 
@@ -46,6 +46,7 @@ MultiLineString::MultiLineString( MultiLineString const& other ):
 ///
 MultiLineString& MultiLineString::operator = ( MultiLineString other )
 {
+    touch();
     swap( other ) ;
     return *this ;
 }
@@ -95,6 +96,7 @@ bool           MultiLineString::isAllowed( Geometry const& g )
 ///
 void MultiLineString::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
@@ -47,6 +47,7 @@ MultiPoint::MultiPoint( MultiPoint const& other ):
 ///
 MultiPoint& MultiPoint::operator = ( MultiPoint other )
 {
+    touch();
     swap( other ) ;
     return *this ;
 }
@@ -98,6 +99,7 @@ bool           MultiPoint::isAllowed( Geometry const& g )
 ///
 void MultiPoint::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
@@ -46,6 +46,7 @@ MultiPolygon::MultiPolygon( MultiPolygon const& other ):
 ///
 MultiPolygon& MultiPolygon::operator = ( MultiPolygon other )
 {
+    touch();
     swap( other ) ;
     return *this ;
 }
@@ -95,6 +96,7 @@ bool           MultiPolygon::isAllowed( Geometry const& g )
 ///
 void MultiPolygon::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
@@ -46,6 +46,7 @@ MultiSolid::MultiSolid( MultiSolid const& other ):
 ///
 MultiSolid& MultiSolid::operator = ( MultiSolid other )
 {
+    touch();
     swap( other ) ;
     return *this ;
 }
@@ -95,6 +96,7 @@ bool           MultiSolid::isAllowed( Geometry const& g )
 ///
 void MultiSolid::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
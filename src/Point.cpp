@@ -137,6 +137,7 @@ Point::Point( const Point& other ):
 ///
 Point& Point::operator = ( const Point& other )
 {
+    touch();
     _coordinate = other._coordinate ;
     _m          = other._m ;
     return *this ;
@@ -221,6 +222,7 @@ bool  Point::isMeasured() const
 ///
 void Point::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
@@ -141,6 +141,7 @@ public:
      * Sets the m value
      */
     inline void      setM( const double& m ) {
+        touch();
         _m = m ;
     }
 
@@ -203,6 +204,7 @@ public:
     typename detail::TypeForDimension<D>::Point toPoint_d() const;
 
     inline Coordinate&        coordinate() {
+        touch();
         return _coordinate;
     }
     inline const Coordinate& coordinate() const {
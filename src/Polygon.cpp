@@ -141,6 +141,7 @@ Polygon::Polygon( const CGAL::Polygon_with_holes_2< Kernel >& poly )
 ///
 Polygon& Polygon::operator = ( Polygon other )
 {
+    touch();
     swap( other );
     return *this ;
 }
@@ -215,17 +216,33 @@ bool   Polygon::isMeasured() const
 ///
 void Polygon::reverse()
 {
+    touch();
     for ( size_t i = 0; i < numRings(); i++ ) {
         ringN( i ).reverse();
     }
 }
 
+///
+///
+///
+bool Polygon::compact()
+{
+    bool compacted = true;
+
+    for ( size_t i = 0; i < numRings(); i++ ) {
+        compacted = ringN( i ).compact() && compacted;
+    }
+
+    return compacted;
+}
+
 
 ///
 ///
 ///
 void Polygon::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
@@ -114,6 +114,12 @@ public:
      */
     void reverse() ;
 
+    /**
+     * compact the rings (see LineString::compact())
+     * @return false if one of the rings can't be compacted
+     */
+    bool compact() ;
+
 
     /**
      * [OGC/SFA]returns the exterior ring
@@ -125,18 +131,21 @@ public:
      * [OGC/SFA]returns the exterior ring
      */
     inline LineString&           exteriorRing() {
+        touch();
         return _rings.front();
     }
     /**
      * Sets the exterior ring
      */
     inline void  setExteriorRing( const LineString& ring ) {
+        touch();
         _rings.front() = ring ;
     }
     /**
      * Sets the exterior ring (takes ownership)
      */
     inline void  setExteriorRing( LineString* ring ) {
+        touch();
         _rings.replace( 0, ring );
     }
 
@@ -163,6 +172,7 @@ public:
      * [OGC/SFA]returns the exterior ring
      */
     inline LineString&           interiorRingN( const size_t& n ) {
+        touch();
         return _rings[n+1];
     }
 
@@ -185,6 +195,7 @@ public:
      * @warning not standard, avoid conditionnal to access rings
      */
     inline LineString&           ringN( const size_t& n ) {
+        touch();
         BOOST_ASSERT( n < _rings.size() );
         return _rings[n];
     }
@@ -193,12 +204,14 @@ public:
      * append a ring to the Polygon
      */
     inline void            addInteriorRing( const LineString& ls ) {
+        touch();
         _rings.push_back( ls.clone() ) ;
     }
     /**
      * append a ring to the Polygon (take ownership)
      */
     inline void            addInteriorRing( LineString* ls ) {
+        touch();
         BOOST_ASSERT( ls != NULL );
         _rings.push_back( ls ) ;
     }
@@ -208,6 +221,7 @@ public:
      * @deprecated addInteriorRing
      */
     inline void            addRing( const LineString& ls ) {
+        touch();
         _rings.push_back( ls.clone() ) ;
     }
     /**
@@ -215,11 +229,13 @@ public:
      * @deprecated addInteriorRing
      */
     inline void            addRing( LineString* ls ) {
+        touch();
         BOOST_ASSERT( ls != NULL );
         _rings.push_back( ls ) ;
     }
 
     inline iterator       begin() {
+        touch();
         return _rings.begin() ;
     }
     inline const_iterator begin() const {
@@ -227,6 +243,7 @@ public:
     }
 
     inline iterator       end() {
+        touch();
         return _rings.end() ;
     }
     inline const_iterator end() const {
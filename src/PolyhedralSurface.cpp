@@ -83,6 +83,7 @@ PolyhedralSurface::PolyhedralSurface( const MarkedPolyhedron& poly ) :
 ///
 PolyhedralSurface& PolyhedralSurface::operator = ( PolyhedralSurface other )
 {
+    touch();
     swap( other );
     return *this ;
 }
@@ -200,6 +201,7 @@ void  PolyhedralSurface::addPolygon( const Polygon& polygon )
 ///
 void  PolyhedralSurface::addPolygon( Polygon* polygon )
 {
+    touch();
     BOOST_ASSERT( polygon != NULL );
     _polygons.push_back( polygon );
 }
@@ -236,6 +238,7 @@ const Polygon&     PolyhedralSurface::geometryN( size_t const& n ) const
 ///
 Polygon& PolyhedralSurface::geometryN( size_t const& n )
 {
+    touch();
     return _polygons[n];
 }
 
@@ -244,6 +247,7 @@ Polygon& PolyhedralSurface::geometryN( size_t const& n )
 ///
 void PolyhedralSurface::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
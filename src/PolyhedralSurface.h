@@ -115,6 +115,7 @@ public:
      * @deprecated see geometryN()
      */
     inline Polygon&           polygonN( size_t const& n ) {
+        touch();
         BOOST_ASSERT( n < _polygons.size() );
         return _polygons[n];
     }
@@ -152,6 +153,7 @@ public:
     //-- iterators
 
     inline iterator       begin() {
+        touch();
         return _polygons.begin() ;
     }
     inline const_iterator begin() const {
@@ -159,6 +161,7 @@ public:
     }
 
     inline iterator       end() {
+        touch();
         return _polygons.end() ;
     }
     inline const_iterator end() const {
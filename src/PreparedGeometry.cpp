@@ -20,9 +20,43 @@
 
 #include <SFCGAL/PreparedGeometry.h>
 
-#include <SFCGAL/detail/io/WktWriter.h>
+#include <SFCGAL/io/ewkt.h>
+#include <SFCGAL/detail/PreparedIndex.h>
+#include <SFCGAL/detail/DistanceIndex.h>
+#include <SFCGAL/detail/SolidLocator.h>
 
 namespace SFCGAL {
+
+namespace {
+//
+// build a cached index on first use
+template <class Index>
+const Index& cachedIndex( std::unique_ptr<Index>& index, std::mutex& mutex, const Geometry& g )
+{
+    std::lock_guard<std::mutex> lock( mutex );
+
+    if ( ! index ) {
+        index.reset( new Index( g ) );
+    }
+
+    return *index;
+}
+
+//
+// build a cached index on first use, from the geometry and an other structure
+template <class Index, class Arg>
+const Index& cachedIndex( std::unique_ptr<Index>& index, std::mutex& mutex, const Geometry& g, const Arg& arg )
+{
+    std::lock_guard<std::mutex> lock( mutex );
+
+    if ( ! index ) {
+        index.reset( new Index( g, arg ) );
+    }
+
+    return *index;
+}
+}
+
 PreparedGeometry::PreparedGeometry() :
     _srid( 0 )
 {
@@ -71,32 +105,53 @@ const Envelope& PreparedGeometry::envelope() const
     return *_envelope;
 }
 
-void PreparedGeometry::invalidateCache()
+template <>
+const detail::PreparedIndex<2>& PreparedGeometry::index<2>() const
 {
-    _envelope.reset();
+    return cachedIndex( _index2D, _indexMutex, geometry() );
 }
 
-std::string PreparedGeometry::asEWKT( const int& numDecimals ) const
+template <>
+const detail::PreparedIndex<3>& PreparedGeometry::index<3>() const
 {
-    std::ostringstream oss;
+    // points are located in the solids with the cached solid locator
+    const detail::SolidLocator* solids = &solidLocator();
+    return cachedIndex( _index3D, _indexMutex, geometry(), solids );
+}
 
-    if ( numDecimals >= 0 ) {
-        oss << std::fixed ;
-        oss.precision( numDecimals );
-    }
+template <>
+const detail::DistanceIndex<2>& PreparedGeometry::distanceIndex<2>() const
+{
+    return cachedIndex( _distanceIndex2D, _indexMutex, geometry() );
+}
 
-    if ( _srid != 0 ) {
-        oss << "SRID=" << _srid << ";";
-    }
+template <>
+const detail::DistanceIndex<3>& PreparedGeometry::distanceIndex<3>() const
+{
+    return cachedIndex( _distanceIndex3D, _indexMutex, geometry() );
+}
 
-    detail::io::WktWriter writer( oss );
-    bool exactWrite = false;
+const detail::SolidLocator& PreparedGeometry::solidLocator() const
+{
+    return cachedIndex( _solidLocator, _indexMutex, geometry() );
+}
 
-    if ( numDecimals == -1 ) {
-        exactWrite = true;
-    }
+void PreparedGeometry::invalidateCache()
+{
+    _envelope.reset();
 
-    writer.write( *_geometry, exactWrite );
-    return oss.str();
+    std::lock_guard<std::mutex> lock( _indexMutex );
+    _index2D.reset();
+    _index3D.reset();
+    _distanceIndex2D.reset();
+    _distanceIndex3D.reset();
+    _solidLocator.reset();
+}
+
+std::string PreparedGeometry::asEWKT( const int& numDecimals ) const
+{
+    std::string ewkt;
+    io::writeEwkt( *this, ewkt, numDecimals );
+    return ewkt;
 }
 }
@@ -29,11 +29,19 @@
 #include <boost/optional.hpp>
 #include <boost/noncopyable.hpp>
 
+#include <memory>
+#include <mutex>
+
 #include <stdint.h> // uint32_t
 
 namespace SFCGAL {
 
 class Geometry;
+namespace detail {
+template <int Dim> class PreparedIndex;
+template <int Dim> class DistanceIndex;
+class SolidLocator;
+}
 
 typedef uint32_t srid_t;
 
@@ -41,6 +49,11 @@ typedef uint32_t srid_t;
  * A PreparedGeometry is a shell around a SFCGAL::Geometry.
  * It is used to store annex data, like SRID or cached computations
  *
+ * Spatial indexes are built on first use and kept until the geometry is reset
+ * or the cache invalidated. They make repeated intersects, distance and covers tests
+ * against the same geometry cheaper (see algorithm::intersects( const PreparedGeometry&, const Geometry& )).
+ * Building them is thread safe, invalidating them while they are used is not.
+ *
  * It is noncopyable since it stores a std::unique_ptr<SFCGAL::Geometry>
  *
  */
@@ -95,6 +108,23 @@ public:
      */
     const Envelope& envelope() const;
 
+    /**
+     * Index for intersects and covers tests (using cache)
+     */
+    template <int Dim>
+    const detail::PreparedIndex<Dim>& index() const;
+
+    /**
+     * Index for distance computations (using cache)
+     */
+    template <int Dim>
+    const detail::DistanceIndex<Dim>& distanceIndex() const;
+
+    /**
+     * Point locator in the solids of the geometry (using cache)
+     */
+    const detail::SolidLocator& solidLocator() const;
+
     /**
      * Resets the cache
      */
@@ -122,6 +152,7 @@ public:
         Geometry* pgeom;
         ar& pgeom;
         _geometry.reset( pgeom );
+        invalidateCache();
     }
 
     template <class Archive>
@@ -138,8 +169,21 @@ protected:
 
     // bbox of the geometry
     mutable boost::optional<Envelope> _envelope;
+
+    // spatial indexes of the geometry
+    mutable std::mutex _indexMutex;
+    mutable std::unique_ptr< detail::PreparedIndex<2> > _index2D;
+    mutable std::unique_ptr< detail::PreparedIndex<3> > _index3D;
+    mutable std::unique_ptr< detail::DistanceIndex<2> > _distanceIndex2D;
+    mutable std::unique_ptr< detail::DistanceIndex<3> > _distanceIndex3D;
+    mutable std::unique_ptr< detail::SolidLocator >     _solidLocator;
 };
 
+template <> const detail::PreparedIndex<2>& PreparedGeometry::index<2>() const;
+template <> const detail::PreparedIndex<3>& PreparedGeometry::index<3>() const;
+template <> const detail::DistanceIndex<2>& PreparedGeometry::distanceIndex<2>() const;
+template <> const detail::DistanceIndex<3>& PreparedGeometry::distanceIndex<3>() const;
+
 }
 
 #endif
@@ -78,6 +78,7 @@ Solid::Solid( const Solid& other ):
 ///
 Solid& Solid::operator = ( Solid other )
 {
+    touch();
     swap( other );
     return *this ;
 }
@@ -162,6 +163,7 @@ bool  Solid::isMeasured() const
 ///
 void Solid::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
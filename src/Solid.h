@@ -102,6 +102,7 @@ public:
      * Returns the exterior shell
      */
     inline PolyhedralSurface&           exteriorShell() {
+        touch();
         return _shells[0] ;
     }
 
@@ -121,18 +122,21 @@ public:
      * Returns the n-th interior shell
      */
     inline PolyhedralSurface&           interiorShellN( size_t const& n ) {
+        touch();
         return _shells[n+1];
     }
     /**
      * add a polygon to the PolyhedralSurface
      */
     inline void                         addInteriorShell( const PolyhedralSurface& shell ) {
+        touch();
         _shells.push_back( shell.clone() );
     }
     /**
      * add a polygon to the PolyhedralSurface
      */
     inline void                         addInteriorShell( PolyhedralSurface* shell ) {
+        touch();
         BOOST_ASSERT( shell != NULL );
         _shells.push_back( shell );
     }
@@ -156,6 +160,7 @@ public:
      * @warning not standard, avoid conditionnal to access rings
      */
     inline PolyhedralSurface&         shellN( const size_t& n ) {
+        touch();
         BOOST_ASSERT( n < numShells() );
         return _shells[n];
     }
@@ -163,6 +168,7 @@ public:
     //-- iterators
 
     inline iterator       begin() {
+        touch();
         return _shells.begin() ;
     }
     inline const_iterator begin() const {
@@ -170,6 +176,7 @@ public:
     }
 
     inline iterator       end() {
+        touch();
         return _shells.end() ;
     }
     inline const_iterator end() const {
@@ -88,6 +88,7 @@ Triangle::Triangle( const Triangle& other )
 ///
 Triangle& Triangle::operator = ( const Triangle& other )
 {
+    touch();
     _vertices[0] = other._vertices[0] ;
     _vertices[1] = other._vertices[1] ;
     _vertices[2] = other._vertices[2] ;
@@ -170,6 +171,7 @@ bool  Triangle::isMeasured() const
 ///
 void  Triangle::reverse()
 {
+    touch();
     //note : first point kept to simplify testing
     std::swap( _vertices[1], _vertices[2] );
 }
@@ -198,6 +200,7 @@ Polygon  Triangle::toPolygon() const
 ///
 void Triangle::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
@@ -112,6 +112,7 @@ public:
      * returns the i-th vertex
      */
     inline Point&        vertex( const int& i ) {
+        touch();
         return _vertices[ i % 3 ];
     }
 
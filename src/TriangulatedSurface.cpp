@@ -59,6 +59,7 @@ TriangulatedSurface::TriangulatedSurface( const TriangulatedSurface& other ):
 ///
 TriangulatedSurface& TriangulatedSurface::operator = ( TriangulatedSurface other )
 {
+    touch();
     swap( other );
     return *this ;
 }
@@ -152,6 +153,16 @@ void  TriangulatedSurface::addTriangles( const TriangulatedSurface& other )
     }
 }
 
+///
+///
+///
+void  TriangulatedSurface::transferTriangles( TriangulatedSurface& other )
+{
+    touch();
+    other.touch();
+    _triangles.transfer( _triangles.end(), other._triangles );
+}
+
 
 ///
 ///
@@ -175,6 +186,7 @@ const Triangle&    TriangulatedSurface::geometryN( size_t const& n ) const
 ///
 Triangle&    TriangulatedSurface::geometryN( size_t const& n )
 {
+    touch();
     BOOST_ASSERT( n < numGeometries() );
     return _triangles[n];
 }
@@ -192,6 +204,7 @@ void TriangulatedSurface::reserve( const size_t& n )
 ///
 void TriangulatedSurface::accept( GeometryVisitor& visitor )
 {
+    touch();
     return visitor.visit( *this );
 }
 
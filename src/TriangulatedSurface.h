@@ -108,6 +108,7 @@ public:
      * @deprecated see geometryN()
      */
     inline Triangle&          triangleN( size_t const& n ) {
+        touch();
         BOOST_ASSERT( n < _triangles.size() );
         return _triangles[n];
     }
@@ -115,18 +116,24 @@ public:
     * add a Triangle to the TriangulatedSurface
     */
     inline void               addTriangle( const Triangle& triangle ) {
+        touch();
         addTriangle( triangle.clone() );
     }
     /**
     * add a Triangle to the TriangulatedSurface
     */
     inline void               addTriangle( Triangle* triangle ) {
+        touch();
         _triangles.push_back( triangle );
     }
     /**
      * add triangles from an other TriangulatedSurface
      */
     void                      addTriangles( const TriangulatedSurface& other ) ;
+    /**
+     * move the triangles of an other TriangulatedSurface (left empty) to the end of this one, without copy
+     */
+    void                      transferTriangles( TriangulatedSurface& other ) ;
 
 
     //-- SFCGAL::Geometry
@@ -144,6 +151,7 @@ public:
     //-- iterators
 
     inline iterator       begin() {
+        touch();
         return _triangles.begin() ;
     }
     inline const_iterator begin() const {
@@ -151,6 +159,7 @@ public:
     }
 
     inline iterator       end() {
+        touch();
         return _triangles.end() ;
     }
     inline const_iterator end() const {
@@ -143,13 +143,20 @@ void BoundaryVisitor::visit( const MultiLineString& g )
     /*
      * create a GeometryGraph and rely on vertex degree (1 means boundary)
      */
-    graph::GeometryGraph        graph ;
-    graph::GeometryGraphBuilder graphBuilder( graph ) ;
+    size_t numPoints = 0 ;
+
+    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+        numPoints += g.lineStringN( i ).numPoints() ;
+    }
+
+    graph::CompactGeometryGraph        graph ;
+    graph::CompactGeometryGraphBuilder graphBuilder( graph, numPoints ) ;
 
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
         graphBuilder.addLineString( g.lineStringN( i ) );
     }
 
+    graph.buildAdjacency();
     getBoundaryFromLineStrings( graph ) ;
 }
 
@@ -158,13 +165,24 @@ void BoundaryVisitor::visit( const MultiLineString& g )
 ///
 void BoundaryVisitor::visit( const MultiPolygon& g )
 {
-    graph::GeometryGraph        graph ;
-    graph::GeometryGraphBuilder graphBuilder( graph ) ;
+    size_t numPoints = 0 ;
+
+    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+        const Polygon& polygon = g.polygonN( i ) ;
+
+        for ( size_t j = 0; j < polygon.numRings(); j++ ) {
+            numPoints += polygon.ringN( j ).numPoints() ;
+        }
+    }
+
+    graph::CompactGeometryGraph        graph ;
+    graph::CompactGeometryGraphBuilder graphBuilder( graph, numPoints ) ;
 
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
         graphBuilder.addPolygon( g.polygonN( i ) );
     }
 
+    graph.buildAdjacency();
     getBoundaryFromPolygons( graph ) ;
 }
 
@@ -193,10 +211,11 @@ void BoundaryVisitor::visit( const GeometryCollection& g )
 ///
 void BoundaryVisitor::visit( const PolyhedralSurface& g )
 {
-    graph::GeometryGraph        graph ;
-    graph::GeometryGraphBuilder graphBuilder( graph ) ;
+    graph::CompactGeometryGraph        graph ;
+    graph::CompactGeometryGraphBuilder graphBuilder( graph ) ;
 
     graphBuilder.addPolyhedralSurface( g );
+    graph.buildAdjacency();
     getBoundaryFromPolygons( graph ) ;
 }
 
@@ -205,10 +224,11 @@ void BoundaryVisitor::visit( const PolyhedralSurface& g )
 ///
 void BoundaryVisitor::visit( const TriangulatedSurface& g )
 {
-    graph::GeometryGraph        graph ;
-    graph::GeometryGraphBuilder graphBuilder( graph ) ;
+    graph::CompactGeometryGraph        graph ;
+    graph::CompactGeometryGraphBuilder graphBuilder( graph, 3 * g.numTriangles() ) ;
 
     graphBuilder.addTriangulatedSurface( g );
+    graph.buildAdjacency();
     getBoundaryFromPolygons( graph ) ;
 }
 
@@ -230,19 +250,13 @@ Geometry* BoundaryVisitor::releaseBoundary()
 ///
 ///
 ///
-void BoundaryVisitor::getBoundaryFromLineStrings( const graph::GeometryGraph& graph )
+void BoundaryVisitor::getBoundaryFromLineStrings( const graph::CompactGeometryGraph& graph )
 {
-    typedef graph::GeometryGraph::vertex_descriptor vertex_descriptor ;
-    typedef graph::GeometryGraph::vertex_iterator   vertex_iterator ;
-
+    typedef graph::CompactGeometryGraph::vertex_descriptor vertex_descriptor ;
 
     std::vector< vertex_descriptor > vertices ;
 
-    vertex_iterator it,end ;
-
-    for ( boost::tie( it,end ) = graph.vertices(); it != end; ++it ) {
-        vertex_descriptor vertex = *it ;
-
+    for ( vertex_descriptor vertex = 0; vertex < graph.numVertices(); vertex++ ) {
         if ( graph.degree( vertex ) == 1 ) {
             vertices.push_back( vertex );
         }
@@ -269,21 +283,16 @@ void BoundaryVisitor::getBoundaryFromLineStrings( const graph::GeometryGraph& gr
 ///
 ///
 ///
-void BoundaryVisitor::getBoundaryFromPolygons( const graph::GeometryGraph& g )
+void BoundaryVisitor::getBoundaryFromPolygons( const graph::CompactGeometryGraph& g )
 {
-    typedef graph::GeometryGraph::vertex_descriptor vertex_descriptor ;
-    //typedef graph::GeometryGraph::vertex_iterator   vertex_iterator ;
-    typedef graph::GeometryGraph::edge_descriptor   edge_descriptor ;
-    typedef graph::GeometryGraph::edge_iterator     edge_iterator ;
-
+    typedef graph::CompactGeometryGraph::vertex_descriptor vertex_descriptor ;
+    typedef graph::CompactGeometryGraph::edge_descriptor   edge_descriptor ;
 
     std::vector< edge_descriptor > boundaryEdges ;
 
-    edge_iterator it, end ;
-
-    for ( boost::tie( it, end ) = g.edges(); it != end ; ++it ) {
-        if ( g.edges( g.source( *it ), g.target( *it ) ).size() == 1U ) {
-            boundaryEdges.push_back( *it ) ;
+    for ( edge_descriptor edge = 0; edge < g.numEdges(); edge++ ) {
+        if ( g.numEdges( g.source( edge ), g.target( edge ) ) == 1U ) {
+            boundaryEdges.push_back( edge ) ;
         }
     }
 
@@ -23,8 +23,8 @@
 
 #include <SFCGAL/GeometryVisitor.h>
 
-#include <SFCGAL/detail/graph/GeometryGraph.h>
-#include <SFCGAL/detail/graph/GeometryGraphBuilder.h>
+#include <SFCGAL/detail/graph/CompactGeometryGraph.h>
+#include <SFCGAL/detail/graph/CompactGeometryGraphBuilder.h>
 
 
 namespace SFCGAL {
@@ -80,13 +80,12 @@ protected:
     /**
      * get the boundary vertices for a set of LineString in a GeometryGraph
      */
-    void getBoundaryFromLineStrings( const graph::GeometryGraph& g );
+    void getBoundaryFromLineStrings( const graph::CompactGeometryGraph& g );
     /**
      * get the boundary edges for a set of Polygons in a GeometryGraph
-     * @warning not optimal (edges could be counted using complex< vertex_descriptor >)
      * @todo merge resulting edges
      */
-    void getBoundaryFromPolygons( const graph::GeometryGraph& g );
+    void getBoundaryFromPolygons( const graph::CompactGeometryGraph& g );
 
 private:
     std::unique_ptr< Geometry > _boundary ;
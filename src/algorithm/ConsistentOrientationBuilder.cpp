@@ -17,20 +17,37 @@
  *   You should have received a copy of the GNU Library General Public
  *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
  */
-
 #include <SFCGAL/algorithm/ConsistentOrientationBuilder.h>
-#include <SFCGAL/detail/graph/algorithm/orientation.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/detail/CoordinateHash.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/functional/hash.hpp>
 
 namespace SFCGAL {
 namespace algorithm {
 
+namespace {
+
+typedef std::pair< size_t, size_t > EdgeKey;
+
+}
+
 ///
 ///
 ///
 ConsistentOrientationBuilder::ConsistentOrientationBuilder():
-    _graph(),
-    _graphBuilder( _graph ),
-    _triangles()
+    _corners(),
+    _vertices(),
+    _nextHalfEdges(),
+    _reversed(),
+    _oriented()
 {
 
 }
@@ -40,7 +57,11 @@ ConsistentOrientationBuilder::ConsistentOrientationBuilder():
 ///
 void ConsistentOrientationBuilder::addTriangle( const Triangle& triangle )
 {
-    _triangles.push_back( _graphBuilder.addTriangle( triangle, graph::Edge( _triangles.size() ) ) ) ;
+    for ( int i = 0; i < 3; i++ ) {
+        _corners.push_back( triangle.vertex( i ).coordinate() );
+    }
+
+    _reversed.push_back( false );
 }
 
 ///
@@ -48,6 +69,9 @@ void ConsistentOrientationBuilder::addTriangle( const Triangle& triangle )
 ///
 void ConsistentOrientationBuilder::addTriangulatedSurface( const TriangulatedSurface& triangulatedSurface )
 {
+    _corners.reserve( _corners.size() + 3 * triangulatedSurface.numGeometries() );
+    _reversed.reserve( _reversed.size() + triangulatedSurface.numGeometries() );
+
     for ( size_t i = 0; i < triangulatedSurface.numGeometries(); i++ ) {
         addTriangle( triangulatedSurface.geometryN( i ) ) ;
     }
@@ -60,6 +84,7 @@ TriangulatedSurface ConsistentOrientationBuilder::buildTriangulatedSurface()
 {
     _makeOrientationConsistent() ;
     TriangulatedSurface triangulatedSurface ;
+    triangulatedSurface.reserve( numTriangles() );
 
     for ( size_t i = 0; i < numTriangles(); i++ ) {
         triangulatedSurface.addTriangle( triangleN( i ) );
@@ -73,114 +98,119 @@ TriangulatedSurface ConsistentOrientationBuilder::buildTriangulatedSurface()
 ///
 Triangle  ConsistentOrientationBuilder::triangleN( const size_t& n ) const
 {
-    const edge_descriptor& ab = _triangles[n][0] ;
-    const edge_descriptor& bc = _triangles[n][1] ;
-    const edge_descriptor& ca = _triangles[n][2] ;
-
-    return Triangle(
-               Point( _graph[ _graph.source( ab ) ].coordinate ),
-               Point( _graph[ _graph.source( bc ) ].coordinate ),
-               Point( _graph[ _graph.source( ca ) ].coordinate )
-           );
-}
+    BOOST_ASSERT( n < numTriangles() );
+
+    const Coordinate* corners = &_corners[ 3 * n ];
 
+    if ( _reversed[n] ) {
+        return Triangle( Point( corners[0] ), Point( corners[2] ), Point( corners[1] ) );
+    }
+
+    return Triangle( Point( corners[0] ), Point( corners[1] ), Point( corners[2] ) );
+}
 
 ///
 ///
 ///
-void ConsistentOrientationBuilder::_makeOrientationConsistent()
+std::vector< size_t > ConsistentOrientationBuilder::neighbors( const size_t& n ) const
 {
-    if ( _triangles.empty() ) {
-        return ;
-    }
-
-    /*
-     * mark all triangles as not oriented and not visited
-     */
-    _visited.resize( numTriangles() ) ;
-    _oriented.resize( numTriangles() ) ;
+    BOOST_ASSERT( _nextHalfEdges.size() == 3 * numTriangles() );
 
-    for ( size_t i = 0; i < numTriangles(); i++ ) {
-        _visited[i]  = false ;
-        _oriented[i] = false ;
-    }
+    std::vector< size_t > result;
 
-    _computeNeighbors();
+    for ( size_t k = 0; k < 3; k++ ) {
+        const size_t halfEdge = 3 * n + k;
 
-    // mark first one as oriented (reference)
-    int currentTriangle = -1 ;
-
-    while ( ( currentTriangle = _findNextTriangle() ) != -1 ) {
-        //mark triangle as visited
-        _visited[ currentTriangle ] = true ;
-
-        //orient neighbors
-        const std::set< size_t >& neighbors = _neighbors[ currentTriangle ] ;
-
-        for ( std::set< size_t >::const_iterator it = neighbors.begin(); it != neighbors.end(); ++it ) {
-            bool hasOppositeEdge, hasParallelEdge ;
-            graph::algorithm::studyOrientation(
-                _graph,
-                _triangles[ currentTriangle ],
-                _triangles[ ( *it ) ],
-                hasOppositeEdge,
-                hasParallelEdge
-            );
-
-            // orientation is consistent
-            if ( ! hasParallelEdge ) {
-                _oriented[ *it ] = true ;
-                continue ;
+        for ( size_t other = _nextHalfEdges[halfEdge]; other != halfEdge; other = _nextHalfEdges[other] ) {
+            if ( other / 3 != n ) {
+                result.push_back( other / 3 );
             }
-
-            // orientation can't be consistent
-            if ( hasOppositeEdge && hasParallelEdge ) {
-                BOOST_THROW_EXCEPTION( Exception(
-                                           "can't build consistent orientation from triangle set"
-                                       ) );
-            }
-
-            // orientation has already been fixed (moebius)
-            if ( hasParallelEdge && _oriented[ *it ] ) {
-                BOOST_THROW_EXCEPTION( Exception(
-                                           "can't build consistent orientation from triangle set, inconsistent orientation for triangle"
-                                       ) );
-            }
-
-            //here, neighbor triangle should be reversed
-            _graph.reverse( _triangles[ ( *it ) ] );
-            _oriented[ *it ] = true ;
         }
     }
+
+    std::sort( result.begin(), result.end() );
+    result.erase( std::unique( result.begin(), result.end() ), result.end() );
+    return result;
 }
 
+
 ///
 ///
 ///
-void ConsistentOrientationBuilder::_computeNeighbors()
+void ConsistentOrientationBuilder::_makeOrientationConsistent()
 {
-    _neighbors.clear() ;
-    _neighbors.resize( numTriangles() );
+    if ( _reversed.empty() ) {
+        return ;
+    }
 
-    for ( size_t i = 0; i < _triangles.size(); i++ ) {
-        const std::vector< edge_descriptor >& triangle = _triangles[i] ;
+    _computeNeighbors();
 
-        for ( size_t j = 0; j < triangle.size(); j++ ) {
-            vertex_descriptor source = _graph.source( triangle[j] ) ;
-            vertex_descriptor target = _graph.target( triangle[j] ) ;
+    /*
+     * mark all triangles as not oriented
+     */
+    _oriented.assign( numTriangles(), false );
 
-            //get neighbor edges
-            std::vector< directed_edge_descriptor > neighborEdges = _graph.edges( source, target );
+    // triangles reached but not visited
+    std::vector< size_t > frontier ;
 
-            //use marker to fill neighborGraph
-            for ( size_t k = 0; k < neighborEdges.size(); k++ ) {
-                size_t idOtherTriangle = ( size_t )_graph[ neighborEdges[k].first ].face;
+    for ( size_t reference = 0; reference < numTriangles(); reference++ ) {
+        if ( _oriented[ reference ] ) {
+            continue ;
+        }
 
-                if ( idOtherTriangle == i ) {
-                    continue ;
+        /*
+         * here, a new connected part begins
+         */
+        _oriented[ reference ] = true ;
+        frontier.clear();
+        frontier.push_back( reference );
+
+        for ( size_t head = 0; head < frontier.size(); head++ ) {
+            const size_t currentTriangle = frontier[ head ] ;
+
+            //orient neighbors
+            for ( size_t k = 0; k < 3; k++ ) {
+                const size_t halfEdge = 3 * currentTriangle + k ;
+
+                for ( size_t other = _nextHalfEdges[ halfEdge ]; other != halfEdge; other = _nextHalfEdges[ other ] ) {
+                    const size_t neighbor = other / 3 ;
+
+                    if ( neighbor == currentTriangle ) {
+                        continue ;
+                    }
+
+                    const bool isParallel = _source( other ) == _source( halfEdge ) && _target( other ) == _target( halfEdge ) ;
+                    const bool isOpposite = _source( other ) == _target( halfEdge ) && _target( other ) == _source( halfEdge ) ;
+
+                    // orientation is consistent
+                    if ( ! isParallel ) {
+                        if ( ! _oriented[ neighbor ] ) {
+                            _oriented[ neighbor ] = true ;
+                            frontier.push_back( neighbor );
+                        }
+
+                        continue ;
+                    }
+
+                    // orientation can't be consistent
+                    if ( isOpposite ) {
+                        BOOST_THROW_EXCEPTION( Exception(
+                                                   "can't build consistent orientation from triangle set"
+                                               ) );
+                    }
+
+                    // orientation has already been fixed (moebius)
+                    if ( _oriented[ neighbor ] ) {
+                        BOOST_THROW_EXCEPTION( Exception(
+                                                   "can't build consistent orientation from triangle set, inconsistent orientation for triangle"
+                                               ) );
+                    }
+
+                    //here, neighbor triangle should be reversed
+                    _reversed[ neighbor ] = ! _reversed[ neighbor ] ;
+                    _oriented[ neighbor ] = true ;
+                    frontier.push_back( neighbor );
                 }
-
-                _neighbors[i].insert( idOtherTriangle );
             }
         }
     }
@@ -189,43 +219,64 @@ void ConsistentOrientationBuilder::_computeNeighbors()
 ///
 ///
 ///
-int ConsistentOrientationBuilder::_findNextTriangle()
+void ConsistentOrientationBuilder::_computeNeighbors()
 {
-    int result = -1 ;
+    const size_t numHalfEdges = _corners.size() ;
 
     /*
-     * find an oriented triangle (reached) and not visited
+     * index vertices
      */
-    for ( size_t i = 0; i < numTriangles(); i++ ) {
-        if ( ! _oriented[i] || _visited[i] ) {
-            continue ;
-        }
-
-        result = i ;
-        break ;
-    }
+    std::unordered_map< Coordinate, size_t, detail::CoordinateHash > vertexIndex ;
+    vertexIndex.reserve( numHalfEdges / 2 );
+    _vertices.resize( numHalfEdges );
 
-    //triangle found
-    if ( result != -1 ) {
-        return result ;
+    for ( size_t i = 0; i < numHalfEdges; i++ ) {
+        _vertices[i] = vertexIndex.insert( std::make_pair( _corners[i], vertexIndex.size() ) ).first->second ;
     }
 
     /*
-     * here, a new connected part begins
+     * link half-edges sharing the same (undirected) edge
      */
-    for ( size_t i = 0; i < numTriangles(); i++ ) {
-        if ( ! _oriented[i] ) {
-            _oriented[i] = true ;
-            return i ;
+    std::unordered_map< EdgeKey, size_t, boost::hash< EdgeKey > > edgeIndex ;
+    edgeIndex.reserve( numHalfEdges );
+    _nextHalfEdges.resize( numHalfEdges );
+
+    for ( size_t i = 0; i < numHalfEdges; i++ ) {
+        const size_t a = _vertices[i] ;
+        const size_t b = _vertices[ i - i % 3 + ( i + 1 ) % 3 ] ;
+        std::pair< std::unordered_map< EdgeKey, size_t, boost::hash< EdgeKey > >::iterator, bool > inserted =
+            edgeIndex.insert( std::make_pair( std::make_pair( std::min( a, b ), std::max( a, b ) ), i ) );
+
+        if ( inserted.second ) {
+            _nextHalfEdges[i] = i ;
+        }
+        else {
+            const size_t first = inserted.first->second ;
+            _nextHalfEdges[i] = _nextHalfEdges[ first ] ;
+            _nextHalfEdges[ first ] = i ;
         }
     }
-
-    BOOST_ASSERT( result == -1 );
-    return result ;
 }
 
+///
+///
+///
+size_t ConsistentOrientationBuilder::_source( const size_t& halfEdge ) const
+{
+    const size_t k = halfEdge % 3 ;
+    const size_t first = halfEdge - k ;
+    return _vertices[ first + ( _reversed[ halfEdge / 3 ] ? ( k + 1 ) % 3 : k ) ] ;
+}
 
-
+///
+///
+///
+size_t ConsistentOrientationBuilder::_target( const size_t& halfEdge ) const
+{
+    const size_t k = halfEdge % 3 ;
+    const size_t first = halfEdge - k ;
+    return _vertices[ first + ( _reversed[ halfEdge / 3 ] ? k : ( k + 1 ) % 3 ) ] ;
+}
 
 }//algorithm
 }//SFCGAL
@@ -23,24 +23,25 @@
 
 #include <SFCGAL/config.h>
 
-#include <SFCGAL/Geometry.h>
+#include <vector>
 
-#include <SFCGAL/detail/graph/GeometryGraph.h>
-#include <SFCGAL/detail/graph/GeometryGraphBuilder.h>
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Coordinate.h>
 
 namespace SFCGAL {
 namespace algorithm {
 
 /**
  * Make orientation consistent in a triangle set
+ *
+ * Triangles are linked by their shared edges (half-edges of the same edge are
+ * chained in a circular list) and each connected part is oriented by a
+ * breadth first traversal, so that the cost is linear in the number of triangles.
+ *
  * @ingroup detail
  */
 class SFCGAL_API ConsistentOrientationBuilder {
 public:
-    typedef graph::GeometryGraph::vertex_descriptor        vertex_descriptor ;
-    typedef graph::GeometryGraph::edge_descriptor          edge_descriptor ;
-    typedef graph::GeometryGraph::directed_edge_descriptor directed_edge_descriptor ;
-
     /**
      * default constructor
      */
@@ -67,7 +68,7 @@ public:
      * returns the number of triangles
      */
     inline size_t  numTriangles() const {
-        return _triangles.size();
+        return _reversed.size();
     }
     /**
      * returns the n-th triangle
@@ -76,17 +77,27 @@ public:
 
 
     /**
-     * [advanced]use after buildTriangulatedSurface
+     * [advanced]use after buildTriangulatedSurface, returns the sorted
+     * indices of the triangles sharing an edge with the n-th triangle
      */
-    const std::set< size_t >& neighbors( const size_t& n ) const ;
+    std::vector< size_t > neighbors( const size_t& n ) const ;
 private:
-    graph::GeometryGraph                          _graph ;
-    graph::GeometryGraphBuilder                   _graphBuilder ;
-    std::vector< std::vector< edge_descriptor > > _triangles ;
+    /**
+     * corners of the triangles, as added (3 per triangle)
+     */
+    std::vector< Coordinate > _corners ;
+    /**
+     * vertex index of each corner (3 per triangle)
+     */
+    std::vector< size_t >     _vertices ;
+    /**
+     * next half-edge on the same edge. The half-edge 3*t+k goes from the corner k
+     * to the corner (k+1)%3 of the triangle t, the list is circular.
+     */
+    std::vector< size_t >     _nextHalfEdges ;
 
-    std::vector< bool >                           _visited ;
-    std::vector< bool >                           _oriented ;
-    std::vector< std::set< size_t > >             _neighbors ;
+    std::vector< bool >       _reversed ;
+    std::vector< bool >       _oriented ;
 
 
     /**
@@ -95,15 +106,18 @@ private:
     void _makeOrientationConsistent() ;
 
     /**
-     * compute neighbors for each triangles
+     * index vertices and link half-edges sharing the same edge
      */
     void _computeNeighbors() ;
 
     /**
-     * find the next triangle to visit (may select a new reference triangle)
+     * source vertex of a half-edge, according to the current orientation
      */
-    int _findNextTriangle() ;
-
+    size_t _source( const size_t& halfEdge ) const ;
+    /**
+     * target vertex of a half-edge, according to the current orientation
+     */
+    size_t _target( const size_t& halfEdge ) const ;
 };
 
 
@@ -32,6 +32,9 @@
 #include <SFCGAL/algorithm/plane.h>
 #include <SFCGAL/algorithm/isValid.h>
 
+#include <SFCGAL/detail/ApproximateLineString.h>
+#include <SFCGAL/detail/CompensatedSum.h>
+
 #include <CGAL/Point_2.h>
 #include <CGAL/Triangle_2.h>
 #include <CGAL/Polygon_2.h>
@@ -43,6 +46,8 @@
 #include <SFCGAL/Exception.h>
 #include <boost/format.hpp>
 
+#include <cmath>
+
 namespace SFCGAL {
 namespace algorithm {
 
@@ -54,6 +59,110 @@ typedef CGAL::Point_3< SFCGAL::Kernel >    Point_3 ;
 typedef CGAL::Triangle_3< SFCGAL::Kernel > Triangle_3 ;
 typedef CGAL::Plane_3< SFCGAL::Kernel >    Plane_3 ;
 
+namespace {
+
+using detail::ApproximateLineString ;
+using detail::CompensatedSum ;
+
+/**
+ * true if value is guaranteed to be within MEASURE_RELATIVE_ERROR of the exact result
+ */
+inline bool isAccurate( const double& value, const double& bound )
+{
+    return bound <= detail::MEASURE_RELATIVE_ERROR * std::abs( value ) ;
+}
+
+/**
+ * Norm of the vector area of a ring (the area of a planar ring in 3D) :
+ * its components are the signed areas of the projections on the
+ * coordinate planes
+ */
+bool vectorArea( const ApproximateLineString& ring, double& area, double& bound )
+{
+    double a[3], b[3] ;
+
+    if ( ! ring.signedArea( 1, 2, a[0], b[0] )
+            || ! ring.signedArea( 2, 0, a[1], b[1] )
+            || ! ring.signedArea( 0, 1, a[2], b[2] ) ) {
+        return false ;
+    }
+
+    double squaredNorm = 0.0 ;
+
+    for ( int i = 0; i < 3; i++ ) {
+        // the square must neither underflow nor overflow
+        if ( a[i] != 0.0 && ( std::abs( a[i] ) < 1.0e-150 || std::abs( a[i] ) > 1.0e150 ) ) {
+            return false ;
+        }
+
+        squaredNorm += a[i] * a[i] ;
+    }
+
+    // the norm is 1-Lipschitz and evaluated with a relative error of gamma( 4 )
+    area  = std::sqrt( squaredNorm ) ;
+    bound = ( b[0] + b[1] + b[2] + CompensatedSum::gamma( 4 ) * area ) * ( 1.0 + CompensatedSum::gamma( 4 ) ) ;
+    return true ;
+}
+
+/**
+ * Area of a polygon evaluated with doubles (signed areas of the rings in 2D,
+ * vector areas in 3D)
+ * @return false if the result can't be guaranteed to be within
+ * MEASURE_RELATIVE_ERROR of the exact area
+ */
+bool approximateArea( const Polygon& g, const int& dimension, double& result )
+{
+    ApproximateLineString ring ;
+    CompensatedSum sum ;
+    double bound = 0.0 ;
+
+    for ( size_t i = 0; i < g.numRings(); i++ ) {
+        double ringArea, ringBound ;
+
+        if ( ! ring.assign( g.ringN( i ), dimension ) ) {
+            return false ;
+        }
+
+        if ( dimension == 3 ? ! vectorArea( ring, ringArea, ringBound ) : ! ring.signedArea( 0, 1, ringArea, ringBound ) ) {
+            return false ;
+        }
+
+        // the absolute value requires the sign of the ring area
+        if ( ringBound >= std::abs( ringArea ) ) {
+            return false ;
+        }
+
+        sum.add( i == 0 ? std::abs( ringArea ) : - std::abs( ringArea ) );
+        bound += ringBound ;
+    }
+
+    result = sum.value() ;
+    return isAccurate( result, ( bound + sum.errorBound() ) * ( 1.0 + CompensatedSum::gamma( g.numRings() + 1 ) ) ) ;
+}
+
+/**
+ * Area of a triangle evaluated with doubles
+ * @see approximateArea( const Polygon&, const int&, double& )
+ */
+bool approximateArea( const Triangle& g, const int& dimension, double& result )
+{
+    ApproximateLineString ring ;
+    double bound ;
+
+    if ( ! ring.assign( g, dimension ) ) {
+        return false ;
+    }
+
+    if ( dimension == 3 ? ! vectorArea( ring, result, bound ) : ! ring.signedArea( 0, 1, result, bound ) ) {
+        return false ;
+    }
+
+    result = std::abs( result ) ;
+    return isAccurate( result, bound ) ;
+}
+
+} // namespace
+
 
 ///
 ///
@@ -121,6 +230,12 @@ Kernel::FT signedArea( const LineString& g )
 ///
 double area( const Triangle& g )
 {
+    double result ;
+
+    if ( approximateArea( g, 2, result ) ) {
+        return result ;
+    }
+
     return CGAL::to_double( CGAL::abs( signedArea( g ) ) ) ;
 }
 
@@ -129,6 +244,12 @@ double area( const Triangle& g )
 ///
 double area( const Polygon& g )
 {
+    double approximation ;
+
+    if ( approximateArea( g, 2, approximation ) ) {
+        return approximation ;
+    }
+
     Kernel::RT result = 0.0 ;
 
     for ( size_t i = 0; i < g.numRings(); i++ ) {
@@ -248,6 +369,12 @@ double area3D( const Polygon& g )
         return result ;
     }
 
+    double approximation ;
+
+    if ( approximateArea( g, 3, approximation ) ) {
+        return approximation ;
+    }
+
     CGAL::Point_3< Kernel > a, b, c ;
     algorithm::plane3D< Kernel >( g, a, b, c );
 
@@ -301,6 +428,12 @@ double area3D( const Polygon& g )
 ///
 double area3D( const Triangle& g )
 {
+    double result ;
+
+    if ( approximateArea( g, 3, result ) ) {
+        return result ;
+    }
+
     CGAL::Triangle_3< Kernel > triangle(
         g.vertex( 0 ).toPoint_3(),
         g.vertex( 1 ).toPoint_3(),
@@ -34,6 +34,9 @@ struct NoValidityCheck;
  * @warning Z component is ignored, there is no 2D projection for 3D geometries
  * @ingroup public_api
  * @pre g is a valid geometry
+ * @note the areas of polygons and triangles are evaluated with compensated double
+ * sums and are within a relative error of detail::MEASURE_RELATIVE_ERROR (2^-42)
+ * of the exact area. Exact arithmetic is only used when this can't be guaranteed.
  */
 SFCGAL_API double     area( const Geometry& g ) ;
 
@@ -91,6 +94,9 @@ SFCGAL_API double      area( const PolyhedralSurface& g ) ;
  * @warning Solid area is set to 0 (might be defined as the area of the surface)
  * @ingroup public_api
  * @pre g is a valid geometry
+ * @note polygons are measured by the norm of their vector area (the area of
+ * their projection on their mean plane), see area( const Geometry& ) for the
+ * error bound
  */
 SFCGAL_API double         area3D( const Geometry& g ) ;
 
@@ -29,96 +29,98 @@
 #include <SFCGAL/TriangulatedSurface.h>
 
 #include <limits>
+#include <utility>
 
 namespace SFCGAL {
 namespace algorithm {
 
 const size_t SurfaceGraph::INVALID_INDEX = std::numeric_limits< size_t >::max();
 
+void SurfaceGraph::reserve( size_t numPoints )
+{
+    // each vertex is shared by several faces and each edge by two faces
+    _coordinateMap.reserve( numPoints / 2 );
+    _edgeMap.reserve( numPoints / 2 );
+}
+
+void SurfaceGraph::addVertex( const Coordinate& coordinate )
+{
+    const std::pair< CoordinateMap::iterator, bool > inserted = _coordinateMap.insert( std::make_pair( coordinate, _numVertices ) );
+
+    if ( inserted.second ) {
+        ++_numVertices ;
+    }
+
+    _ringVertices.push_back( inserted.first->second );
+}
+
 void SurfaceGraph::addRing( const LineString& ring, FaceIndex faceIndex )
 {
     const size_t numSegments = ring.numSegments() ;
 
+    _ringVertices.clear();
+
+    for ( size_t s = 0; s != numSegments; ++s ) {
+        addVertex( ring.pointN( s ).coordinate() );
+    }
+
+    addRingEdges( faceIndex );
+}
+
+void SurfaceGraph::addRingEdges( FaceIndex faceIndex )
+{
+    const size_t numSegments = _ringVertices.size() ;
+
     for ( size_t s = 0; s != numSegments; ++s ) { // for each segment
-        const Coordinate startCoord = ring.pointN( s ).coordinate() ;
-        const Coordinate endCoord = ring.pointN( ( s + 1 ) % numSegments ).coordinate() ; // possible optimization: store the index of ring start point instead of finding it
-        const CoordinateMap::const_iterator startFound = _coordinateMap.find( startCoord ) ;
-        const CoordinateMap::const_iterator endFound = _coordinateMap.find( endCoord ) ;
-        BOOST_ASSERT( s + 1 != numSegments || endFound != _coordinateMap.end() ); // ring not closed
-
-        if ( startFound != _coordinateMap.end() && endFound != _coordinateMap.end() ) {
-            // found both end, we look for the edge
-            const VertexIndex startIndex = startFound->second ;
-            const VertexIndex endIndex = endFound->second ;
-            const std::pair< VertexIndex, VertexIndex > edge( startIndex, endIndex );
-            const EdgeMap::const_iterator foundEdgeWithBadOrientation = _edgeMap.find( edge );
-
-            if ( foundEdgeWithBadOrientation != _edgeMap.end() ) {
-                _isValid = Validity::invalid(
-                               ( boost::format( "inconsistent orientation of PolyhedralSurface detected at edge %d (%d-%d) of polygon %d" ) % s % edge.first % edge.second % faceIndex ).str()
-                           );
-            }
-
-            const std::pair< VertexIndex, VertexIndex > reversedEdge( endIndex, startIndex );
-
-            const EdgeMap::iterator foundEdge = _edgeMap.find( reversedEdge );
-
-            if ( foundEdge != _edgeMap.end() ) {
-                // edit edge
-                foundEdge->second.second = faceIndex;
-                // we have two faces connected, this is an edge of the graph
-                boost::add_edge( foundEdge->second.first, foundEdge->second.second, _graph );
-                //std::cerr << "face " << foundEdge->second.first << "->" << foundEdge->second.second << "\n";
-            }
-            else {
-                // create edge
-                _edgeMap.insert( std::make_pair( edge, std::make_pair( faceIndex, INVALID_INDEX ) ) );
-                //std::cerr << "face " << faceIndex << " edge " << edge.first << "-" << edge.second << "\n";
-            }
+        const VertexIndex startIndex = _ringVertices[ s ] ;
+        const VertexIndex endIndex = _ringVertices[ ( s + 1 ) % numSegments ] ;
+        const Edge edge( startIndex, endIndex );
+
+        // we look for the edge
+        const EdgeMap::const_iterator foundEdgeWithBadOrientation = _edgeMap.find( edge );
+
+        if ( foundEdgeWithBadOrientation != _edgeMap.end() ) {
+            _isValid = Validity::invalid(
+                           ( boost::format( "inconsistent orientation of PolyhedralSurface detected at edge %d (%d-%d) of polygon %d" ) % s % edge.first % edge.second % faceIndex ).str()
+                       );
         }
-        else {
-            // one end at least is missing, create the edge
-            VertexIndex startIndex ;
-
-            if ( startFound == _coordinateMap.end() ) {
-                _coordinateMap.insert( std::make_pair( startCoord, _numVertices ) ) ;
-                startIndex = _numVertices;
-                ++_numVertices ;
-            }
-            else {
-                startIndex = startFound->second;
-            }
-
-            VertexIndex endIndex ;
-
-            if ( endFound == _coordinateMap.end() ) {
-                _coordinateMap.insert( std::make_pair( endCoord, _numVertices ) ) ;
-                endIndex = _numVertices;
-                ++_numVertices ;
-            }
-            else {
-                endIndex = endFound-> second;
-            }
-
-            const std::pair< VertexIndex, VertexIndex > edge( startIndex, endIndex );
 
-            _edgeMap.insert( std::make_pair( edge, std::make_pair( faceIndex, INVALID_INDEX ) ) );
+        const Edge reversedEdge( endIndex, startIndex );
+
+        const EdgeMap::iterator foundEdge = _edgeMap.find( reversedEdge );
 
-            //std::cerr << "face " << faceIndex << " edge " << edge.first << "-" << edge.second << "\n";
+        if ( foundEdge != _edgeMap.end() ) {
+            // edit edge
+            foundEdge->second.second = faceIndex;
+            // we have two faces connected, this is an edge of the graph
+            boost::add_edge( foundEdge->second.first, foundEdge->second.second, _graph );
+        }
+        else {
+            // create edge
+            _edgeMap.insert( std::make_pair( edge, std::make_pair( faceIndex, INVALID_INDEX ) ) );
         }
     }
 }
 
 SurfaceGraph::SurfaceGraph( const PolyhedralSurface& surf ) :
+    _graph( surf.numPolygons() ),
     _numVertices( 0 ),
     _isValid( Validity::valid() )
 {
     const size_t numPolygons = surf.numPolygons() ;
+    size_t numPoints = 0 ;
+
+    for ( size_t p = 0; p != numPolygons; ++p ) {
+        const Polygon& polygon = surf.polygonN( p ) ;
+
+        for ( size_t r = 0; r != polygon.numRings(); ++r ) {
+            numPoints += polygon.ringN( r ).numPoints() ;
+        }
+    }
+
+    reserve( numPoints );
 
     for ( size_t p = 0; p != numPolygons; ++p ) { // for each polygon
-        const FaceIndex idx = boost::add_vertex( _graph );
-        BOOST_ASSERT( idx == p );
-        ( void )idx;
         const Polygon& polygon = surf.polygonN( p ) ;
         const size_t numRings = polygon.numRings() ;
 
@@ -126,21 +128,33 @@ SurfaceGraph::SurfaceGraph( const PolyhedralSurface& surf ) :
             addRing( polygon.ringN( r ), p );
         }
     }
+
+    // only used during construction
+    CoordinateMap().swap( _coordinateMap );
 }
 
 SurfaceGraph::SurfaceGraph( const TriangulatedSurface& tin ) :
+    _graph( tin.numTriangles() ),
     _numVertices( 0 ),
     _isValid( Validity::valid() )
 {
     const size_t numTriangles = tin.numTriangles() ;
+    reserve( 3 * numTriangles );
 
     for ( size_t t = 0; t != numTriangles; ++t ) { // for each polygon
-        const FaceIndex idx = boost::add_vertex( _graph );
-        BOOST_ASSERT( idx == t );
-        ( void )idx;
         const Triangle& triangle = tin.triangleN( t ) ;
-        addRing( triangle.toPolygon().exteriorRing(), t );
+
+        _ringVertices.clear();
+
+        for ( int i = 0; i < 3; ++i ) {
+            addVertex( triangle.vertex( i ).coordinate() );
+        }
+
+        addRingEdges( t );
     }
+
+    // only used during construction
+    CoordinateMap().swap( _coordinateMap );
 }
 
 bool isConnected( const SurfaceGraph& graph )
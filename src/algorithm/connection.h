@@ -24,16 +24,23 @@
 #include <SFCGAL/Geometry.h>
 #include <SFCGAL/Coordinate.h>
 #include <SFCGAL/Validity.h>
+#include <SFCGAL/detail/CoordinateHash.h>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/connected_components.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/noncopyable.hpp>
-#include <map>
+#include <unordered_map>
+#include <vector>
 
 namespace SFCGAL {
 namespace algorithm {
 
 /**
  * Represents a polyhedral surface as a graph where faces are nodes and egde are graph edges
+ *
+ * Vertices and edges are matched with hash tables (coordinates are hashed on their
+ * double approximation and compared exactly).
+ *
  * @pre the polygons are valid
  * @todo unittest
  * @ingroup detail
@@ -43,14 +50,15 @@ class SFCGAL_API SurfaceGraph : boost::noncopyable {
 public:
     typedef size_t VertexIndex;
     typedef size_t FaceIndex;
-    typedef std::map< Coordinate, VertexIndex >  CoordinateMap ;
+    typedef std::unordered_map< Coordinate, VertexIndex, detail::CoordinateHash >  CoordinateMap ;
     static const size_t INVALID_INDEX;
     // an edge is inserted with vtx ordered by the first polygon we treat,
     // we search the edge with reverse ordered vtx indexes.
     // as a result, an inconsistent orientation between polygons can be spotted by
     // finding the edge in the same order
     // note that this situation may be caused if a face is duplicated
-    typedef std::map< std::pair < VertexIndex, VertexIndex > , std::pair< FaceIndex, FaceIndex > >  EdgeMap ;
+    typedef std::pair< VertexIndex, VertexIndex > Edge ;
+    typedef std::unordered_map< Edge, std::pair< FaceIndex, FaceIndex >, boost::hash< Edge > >  EdgeMap ;
     typedef boost::adjacency_list< boost::vecS, boost::vecS, boost::undirectedS > FaceGraph;
     /*
      * Construct from PolyHedralSurface
@@ -83,7 +91,13 @@ private:
 
     Validity _isValid ;
 
+    // vertices of the ring being added (first point not repeated)
+    std::vector< VertexIndex > _ringVertices ;
+
+    void reserve( size_t numPoints ); // helper for ctor
     void addRing( const LineString& ring, FaceIndex faceIndex ); // helper for ctor
+    void addVertex( const Coordinate& coordinate ); // append a vertex to _ringVertices
+    void addRingEdges( FaceIndex faceIndex ); // add the edges of _ringVertices
 };
 
 /**
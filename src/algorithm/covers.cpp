@@ -26,8 +26,10 @@
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/detail/TypeForDimension.h>
 #include <SFCGAL/detail/GeometrySet.h>
-
-#include <CGAL/box_intersection_d.h>
+#include <SFCGAL/detail/PreparedIndex.h>
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/detail/GetPointsVisitor.h>
+#include <SFCGAL/Point.h>
 
 using namespace SFCGAL::detail;
 
@@ -211,6 +213,12 @@ bool covers( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
         return false;
     }
 
+    // disjoint sets, stops at the first pair of intersecting primitives
+    // without computing the intersection
+    if ( ! intersects( a, b ) ) {
+        return false;
+    }
+
     //
     // This is a very naive (not efficient) implementation of covers() !
     //
@@ -265,5 +273,43 @@ bool covers3D( const Geometry& ga, const Geometry& gb )
 
     return covers( gsa, gsb );
 }
+
+template <int Dim>
+bool coversImpl( const PreparedGeometry& pa, const Geometry& gb )
+{
+    if ( pa.geometry().isEmpty() || gb.isEmpty() ) {
+        return false;
+    }
+
+    const PreparedIndex<Dim>& index = pa.index<Dim>();
+
+    // every point of gb has to intersect pa, which is cheap to test with
+    // the point locators and is enough for points
+    GetPointsVisitor getPoints;
+    gb.accept( getPoints );
+
+    for ( GetPointsVisitor::const_iterator it = getPoints.points.begin(); it != getPoints.points.end(); ++it ) {
+        if ( ! ( *it )->isEmpty() && ! index.intersects( ( *it )->toPoint_d<Dim>() ) ) {
+            return false;
+        }
+    }
+
+    if ( gb.dimension() == 0 ) {
+        return true;
+    }
+
+    GeometrySet<Dim> gsb( gb );
+    return covers( index.geometrySet(), gsb );
+}
+
+bool covers( const PreparedGeometry& pa, const Geometry& gb )
+{
+    return coversImpl<2>( pa, gb );
+}
+
+bool covers3D( const PreparedGeometry& pa, const Geometry& gb )
+{
+    return coversImpl<3>( pa, gb );
+}
 }
 }
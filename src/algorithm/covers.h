@@ -27,6 +27,7 @@
 
 namespace SFCGAL {
 class Geometry;
+class PreparedGeometry;
 class Solid;
 class Point;
 namespace detail {
@@ -46,6 +47,18 @@ SFCGAL_API bool covers( const Geometry& ga, const Geometry& gb );
  */
 SFCGAL_API bool covers3D( const Geometry& ga, const Geometry& gb );
 
+/**
+ * Cover test on 2D geometries, using the index of a PreparedGeometry (built on first use)
+ * @pre pa is a valid geometry
+ */
+SFCGAL_API bool covers( const PreparedGeometry& pa, const Geometry& gb );
+
+/**
+ * Cover test on 3D geometries, using the index of a PreparedGeometry (built on first use)
+ * @pre pa is a valid geometry
+ */
+SFCGAL_API bool covers3D( const PreparedGeometry& pa, const Geometry& gb );
+
 /**
  * @ingroup@ detail
  */
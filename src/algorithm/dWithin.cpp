@@ -0,0 +1,130 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/algorithm/dWithin.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+#include <SFCGAL/detail/DistanceIndex.h>
+
+#include <vector>
+
+using namespace SFCGAL::detail;
+
+namespace SFCGAL {
+namespace algorithm {
+
+namespace {
+
+//
+// false if the boxes of a inflated by distance do not intersect the boxes of b.
+// In that case, a and b are further than distance from each other.
+template <int Dim>
+bool inflatedBoxesIntersect( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b, const double& distance )
+{
+    typename HandleCollection<Dim>::Type handlesA, handlesB;
+    typename BoxCollection<Dim>::Type boxesA, boxesB;
+    a.computeBoundingBoxes( handlesA, boxesA );
+    b.computeBoundingBoxes( handlesB, boxesB );
+
+    return inflated_boxes_intersect<Dim>( boxesA.begin(), boxesA.end(), boxesB.begin(), boxesB.end(), distance );
+}
+
+template <int Dim>
+bool dWithinImpl( const Geometry& ga, const Geometry& gb, const double& distance )
+{
+    if ( ga.isEmpty() || gb.isEmpty() || ! ( distance >= 0.0 ) ) {
+        return false;
+    }
+
+    // double precision mirror, if coordinates allow it
+    {
+        InexactGeometrySet<Dim> iga, igb;
+
+        if ( iga.build( ga ) && igb.build( gb ) ) {
+            const boost::tribool within = dWithin( iga, igb, distance );
+
+            if ( ! boost::indeterminate( within ) ) {
+                return within;
+            }
+        }
+    }
+
+    const GeometrySet<Dim> gsa( ga );
+    const GeometrySet<Dim> gsb( gb );
+
+    // conservative double boxes decide when the geometries are far away
+    if ( ! inflatedBoxesIntersect( gsa, gsb, distance ) ) {
+        return false;
+    }
+
+    if ( intersects( gsa, gsb ) ) {
+        return true;
+    }
+
+    // the geometries do not intersect, the distance is reached on their boundaries
+    // (exact squared distances, the rounded ones may be on the wrong side of distance)
+    return elementsWithin<Dim>( ga, gb, distance );
+}
+
+} // namespace
+
+///
+///
+///
+bool dWithin( const Geometry& ga, const Geometry& gb, const double& distance )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( ga );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gb );
+
+    return dWithinImpl<2>( ga, gb, distance );
+}
+
+///
+///
+///
+bool dWithin3D( const Geometry& ga, const Geometry& gb, const double& distance )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( ga );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gb );
+
+    return dWithinImpl<3>( ga, gb, distance );
+}
+
+///
+///
+///
+bool dWithin( const Geometry& ga, const Geometry& gb, const double& distance, NoValidityCheck )
+{
+    return dWithinImpl<2>( ga, gb, distance );
+}
+
+///
+///
+///
+bool dWithin3D( const Geometry& ga, const Geometry& gb, const double& distance, NoValidityCheck )
+{
+    return dWithinImpl<3>( ga, gb, distance );
+}
+
+}
+}
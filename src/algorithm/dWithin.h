@@ -0,0 +1,67 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SFCGAL_DWITHIN_ALGORITHM
+#define SFCGAL_DWITHIN_ALGORITHM
+
+#include <SFCGAL/config.h>
+
+namespace SFCGAL {
+class Geometry;
+namespace algorithm {
+// defined in isValid.h
+struct NoValidityCheck;
+
+/**
+ * Distance threshold test on 2D geometries : true if distance( ga, gb ) <= distance,
+ * without computing the distance when boxes decide. Force projection to z=0 if needed
+ * @pre ga and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API bool dWithin( const Geometry& ga, const Geometry& gb, const double& distance );
+
+/**
+ * Distance threshold test on 3D geometries : true if distance3D( ga, gb ) <= distance,
+ * without computing the distance when boxes decide. Assume z = 0 if needed
+ * @pre ga and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API bool dWithin3D( const Geometry& ga, const Geometry& gb, const double& distance );
+
+/**
+ * Distance threshold test on 2D geometries. Force projection to z=0 if needed
+ * @pre ga and gb are valid geometries
+ * @ingroup detail
+ * @warning the validity is assumed, no actual check is done
+ */
+SFCGAL_API bool dWithin( const Geometry& ga, const Geometry& gb, const double& distance, NoValidityCheck );
+
+/**
+ * Distance threshold test on 3D geometries. Assume z = 0 if needed
+ * @pre ga and gb are valid geometries
+ * @ingroup detail
+ * @warning the validity is assumed, no actual check is done
+ */
+SFCGAL_API bool dWithin3D( const Geometry& ga, const Geometry& gb, const double& distance, NoValidityCheck );
+
+}
+}
+
+#endif
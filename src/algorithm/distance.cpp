@@ -30,6 +30,10 @@
 #include <SFCGAL/GeometryCollection.h>
 
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+#include <SFCGAL/detail/PreparedIndex.h>
+#include <SFCGAL/detail/DistanceIndex.h>
+#include <SFCGAL/PreparedGeometry.h>
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Exception.h>
 
@@ -58,6 +62,15 @@ namespace algorithm {
 ///
 double distance( const Geometry& gA, const Geometry& gB, NoValidityCheck )
 {
+    // double precision mirror, if coordinates allow it
+    {
+        detail::InexactGeometrySet<2> igA, igB;
+
+        if ( igA.build( gA ) && igB.build( gB ) ) {
+            return distance( igA, igB );
+        }
+    }
+
     switch ( gA.geometryTypeId() ) {
     case TYPE_POINT:
         return distancePointGeometry( gA.as< Point >(), gB ) ;
@@ -97,6 +110,56 @@ double distance( const Geometry& gA, const Geometry& gB )
     return distance( gA, gB, NoValidityCheck() );
 }
 
+///
+///
+///
+double distance( const Geometry& gA, const Geometry& gB, const double& maxDistance )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gA );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gB );
+
+    if ( gA.isEmpty() || gB.isEmpty() ) {
+        return std::numeric_limits< double >::infinity() ;
+    }
+
+    // double precision mirror, if coordinates allow it
+    {
+        detail::InexactGeometrySet<2> igA, igB;
+
+        if ( igA.build( gA ) && igB.build( gB ) ) {
+            return distance( igA, igB, maxDistance );
+        }
+    }
+
+    if ( intersects( gA, gB, NoValidityCheck() ) ) {
+        return 0.0 ;
+    }
+
+    // the geometries do not intersect, the distance is reached on their boundaries
+    return detail::elementsDistance<2>( gA, gB, maxDistance );
+}
+
+///
+///
+///
+double distance( const PreparedGeometry& pA, const Geometry& gB )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gB );
+
+    const detail::PreparedIndex<2>& index = pA.index<2>();
+
+    if ( index.isEmpty() || gB.isEmpty() ) {
+        return std::numeric_limits< double >::infinity() ;
+    }
+
+    if ( index.intersects( gB ) ) {
+        return 0.0 ;
+    }
+
+    // the geometries do not intersect, the distance is reached on their boundaries
+    return pA.distanceIndex<2>().distance( gB );
+}
+
 ///
 ///
 ///
@@ -263,24 +326,7 @@ double distanceLineStringLineString( const LineString& gA, const LineString& gB
         return std::numeric_limits< double >::infinity() ;
     }
 
-    size_t nsA = gA.numSegments() ;
-    size_t nsB = gB.numSegments() ;
-
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < nsA; i++ ) {
-        for ( size_t j = 0; j < nsB; j++ ) {
-            dMin = std::min(
-                       dMin,
-                       distanceSegmentSegment(
-                           gA.pointN( i ), gA.pointN( i+1 ),
-                           gB.pointN( j ), gB.pointN( j+1 )
-                       )
-                   ) ;
-        }
-    }
-
-    return dMin ;
+    return detail::elementsDistance<2>( gA, gB );
 }
 
 
@@ -297,17 +343,8 @@ double distanceLineStringPolygon( const LineString& gA, const Polygon& gB )
         return 0.0 ;
     }
 
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < gB.numRings(); i++ ) {
-        double d = distanceLineStringLineString( gA, gB.ringN( i ) );
-
-        if ( d < dMin ) {
-            dMin = d ;
-        }
-    }
-
-    return dMin ;
+    // the distance is reached on the rings of gB
+    return detail::elementsDistance<2>( gA, gB );
 }
 
 
@@ -378,19 +415,8 @@ double distancePolygonPolygon( const Polygon& gA, const Polygon& gB )
         return 0.0 ;
     }
 
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < gA.numRings(); i++ ) {
-        for ( size_t j = 0; j < gB.numRings(); j++ ) {
-            double d = distanceLineStringLineString( gA.ringN( i ), gB.ringN( j ) );
-
-            if ( d < dMin ) {
-                dMin = d ;
-            }
-        }
-    }
-
-    return dMin ;
+    // the distance is reached on the rings
+    return detail::elementsDistance<2>( gA, gB );
 }
 
 ///
@@ -27,6 +27,7 @@
 
 
 namespace SFCGAL {
+class PreparedGeometry;
 namespace algorithm {
 struct NoValidityCheck;
 
@@ -47,6 +48,25 @@ SFCGAL_API double distance( const Geometry& gA, const Geometry& gB ) ;
  */
 SFCGAL_API double distance( const Geometry& gA, const Geometry& gB, NoValidityCheck ) ;
 
+/**
+ * Compute the distance between two Geometries with an early cutoff : parts of the
+ * geometries further than maxDistance from each other are not compared (ST_DWithin semantics)
+ * @ingroup public_api
+ * @return the distance if it is lower or equal to maxDistance, a value greater than maxDistance otherwise
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API double distance( const Geometry& gA, const Geometry& gB, const double& maxDistance ) ;
+
+/**
+ * Compute the distance between two Geometries, using the indexes of a
+ * PreparedGeometry (built on first use)
+ * @ingroup public_api
+ * @pre pA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API double distance( const PreparedGeometry& pA, const Geometry& gB ) ;
+
 /**
  * dispatch distance from Point to Geometry
  * @ingroup detail
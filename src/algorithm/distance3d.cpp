@@ -37,6 +37,10 @@
 #include <SFCGAL/detail/transform/AffineTransform3.h>
 #include <SFCGAL/algorithm/intersects.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+#include <SFCGAL/detail/PreparedIndex.h>
+#include <SFCGAL/detail/DistanceIndex.h>
+#include <SFCGAL/PreparedGeometry.h>
 #include <SFCGAL/triangulate/triangulatePolygon.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
 
@@ -58,6 +62,15 @@ namespace algorithm {
 ///
 double distance3D( const Geometry& gA, const Geometry& gB, NoValidityCheck )
 {
+    // double precision mirror, if coordinates allow it
+    {
+        detail::InexactGeometrySet<3> igA, igB;
+
+        if ( igA.build( gA ) && igB.build( gB ) ) {
+            return distance( igA, igB );
+        }
+    }
+
     //SFCGAL_DEBUG( boost::format("dispatch distance3D(%s,%s)") % gA.asText() % gB.asText() );
 
     switch ( gA.geometryTypeId() ) {
@@ -101,6 +114,57 @@ double distance3D( const Geometry& gA, const Geometry& gB )
 
     return distance3D( gA, gB, NoValidityCheck() );
 }
+
+///
+///
+///
+double distance3D( const Geometry& gA, const Geometry& gB, const double& maxDistance )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gA );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gB );
+
+    if ( gA.isEmpty() || gB.isEmpty() ) {
+        return std::numeric_limits< double >::infinity() ;
+    }
+
+    // double precision mirror, if coordinates allow it
+    {
+        detail::InexactGeometrySet<3> igA, igB;
+
+        if ( igA.build( gA ) && igB.build( gB ) ) {
+            return distance( igA, igB, maxDistance );
+        }
+    }
+
+    // needed for points and surfaces inside solids
+    if ( intersects3D( gA, gB, NoValidityCheck() ) ) {
+        return 0.0 ;
+    }
+
+    // the geometries do not intersect, the distance is reached on their boundaries
+    return detail::elementsDistance<3>( gA, gB, maxDistance );
+}
+
+///
+///
+///
+double distance3D( const PreparedGeometry& pA, const Geometry& gB )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gB );
+
+    const detail::PreparedIndex<3>& index = pA.index<3>();
+
+    if ( index.isEmpty() || gB.isEmpty() ) {
+        return std::numeric_limits< double >::infinity() ;
+    }
+
+    if ( index.intersects( gB ) ) {
+        return 0.0 ;
+    }
+
+    // the geometries do not intersect, the distance is reached on their boundaries
+    return pA.distanceIndex<3>().distance( gB );
+}
 ///
 ///
 ///
@@ -196,9 +260,8 @@ double distancePointPolygon3D( const Point& gA, const Polygon& gB )
         return std::numeric_limits< double >::infinity() ;
     }
 
-    TriangulatedSurface triangulateSurfaceB ;
-    triangulate::triangulatePolygon3D( gB, triangulateSurfaceB ) ;
-    return distanceGeometryCollectionToGeometry3D( triangulateSurfaceB, gA );
+    // gA against the triangles of gB
+    return detail::elementsDistance<3>( gA, gB );
 }
 
 
@@ -276,24 +339,7 @@ double distanceLineStringLineString3D( const LineString& gA, const LineString& g
         return std::numeric_limits< double >::infinity() ;
     }
 
-    size_t nsA = gA.numSegments() ;
-    size_t nsB = gB.numSegments() ;
-
-    double dMin = std::numeric_limits< double >::infinity() ;
-
-    for ( size_t i = 0; i < nsA; i++ ) {
-        for ( size_t j = 0; j < nsB; j++ ) {
-            dMin = std::min(
-                       dMin,
-                       distanceSegmentSegment3D(
-                           gA.pointN( i ), gA.pointN( i+1 ),
-                           gB.pointN( j ), gB.pointN( j+1 )
-                       )
-                   ) ;
-        }
-    }
-
-    return dMin ;
+    return detail::elementsDistance<3>( gA, gB );
 }
 
 ///
@@ -327,9 +373,8 @@ double distanceLineStringPolygon3D( const LineString& gA, const Polygon& gB )
         return std::numeric_limits< double >::infinity() ;
     }
 
-    TriangulatedSurface triangulateSurfaceB ;
-    triangulate::triangulatePolygon3D( gB, triangulateSurfaceB ) ;
-    return distanceGeometryCollectionToGeometry3D( triangulateSurfaceB, gA );
+    // segments of gA against the triangles of gB
+    return detail::elementsDistance<3>( gA, gB );
 }
 
 ///
@@ -428,8 +473,20 @@ double distancePolygonGeometry3D( const Polygon& gA, const Geometry& gB )
         return std::numeric_limits< double >::infinity() ;
     }
 
+    switch ( gB.geometryTypeId() ) {
+    case TYPE_POINT:
+    case TYPE_LINESTRING:
+    case TYPE_TRIANGLE:
+    case TYPE_POLYGON:
+        // triangles of gA against the elements of gB, without volume
+        return detail::elementsDistance<3>( gA, gB );
+
+    default:
+        break;
+    }
+
     TriangulatedSurface triangulateSurfaceA ;
-    triangulate::triangulatePolygon3D( gA, triangulateSurfaceA ) ;
+    triangulate::triangulatePolygon3D( gA, triangulateSurfaceA, triangulate::TRIANGULATION_FAST ) ;
     return distanceGeometryCollectionToGeometry3D( triangulateSurfaceA, gB );
 }
 
@@ -24,8 +24,10 @@
 #include <SFCGAL/config.h>
 
 #include <SFCGAL/Geometry.h>
+#include <SFCGAL/Kernel.h>
 
 namespace SFCGAL {
+class PreparedGeometry;
 namespace algorithm {
 struct NoValidityCheck;
 
@@ -48,6 +50,25 @@ SFCGAL_API double distance3D( const Geometry& gA, const Geometry& gB ) ;
  */
 SFCGAL_API double distance3D( const Geometry& gA, const Geometry& gB, NoValidityCheck ) ;
 
+/**
+ * Compute the 3D distance between two Geometries with an early cutoff : parts of the
+ * geometries further than maxDistance from each other are not compared (ST_3DDWithin semantics)
+ * @ingroup public_api
+ * @return the distance if it is lower or equal to maxDistance, a value greater than maxDistance otherwise
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API double distance3D( const Geometry& gA, const Geometry& gB, const double& maxDistance ) ;
+
+/**
+ * Compute distance between two 3D Geometries, using the indexes of a
+ * PreparedGeometry (built on first use)
+ * @ingroup public_api
+ * @pre pA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API double distance3D( const PreparedGeometry& pA, const Geometry& gB ) ;
+
 /**
  * dispatch distance from Point to Geometry
  * @ingroup detail
@@ -170,6 +191,22 @@ SFCGAL_API double distanceSegmentTriangle3D(
  */
 SFCGAL_API double distanceTriangleTriangle3D( const Triangle& gA, const Triangle& gB ) ;
 
+/**
+ * exact squared distance between a point and a triangle
+ * @ingroup detail
+ */
+SFCGAL_API Kernel::FT squaredDistancePointTriangle3D( const Kernel::Point_3& p, const Kernel::Triangle_3& abc ) ;
+/**
+ * exact squared distance between a segment and a triangle
+ * @ingroup detail
+ */
+SFCGAL_API Kernel::FT squaredDistanceSegmentTriangle3D( const Kernel::Segment_3& sAB, const Kernel::Triangle_3& tABC ) ;
+/**
+ * exact squared distance between two triangles
+ * @ingroup detail
+ */
+SFCGAL_API Kernel::FT squaredDistanceTriangleTriangle3D( const Kernel::Triangle_3& triangleA, const Kernel::Triangle_3& triangleB ) ;
+
 
 
 }//namespace algorithm
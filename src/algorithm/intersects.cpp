@@ -20,6 +20,7 @@
 
 #include <map>
 #include <sstream>
+#include <vector>
 
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/algorithm/intersects.h>
@@ -29,14 +30,15 @@
 #include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/detail/triangulate/triangulateInGeometrySet.h>
 #include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+#include <SFCGAL/detail/PreparedIndex.h>
+#include <SFCGAL/PreparedGeometry.h>
 #include <SFCGAL/Envelope.h>
 #include <SFCGAL/Exception.h>
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/PolyhedralSurface.h>
 
-#include <CGAL/box_intersection_d.h>
-
 #include <SFCGAL/detail/Point_inside_polyhedron.h>
 
 using namespace SFCGAL::detail;
@@ -347,15 +349,11 @@ bool intersects( const PrimitiveHandle<Dim>& pa, const PrimitiveHandle<Dim>& pb
     return dispatch_intersects_sym( pa, pb );
 }
 
-struct found_an_intersection {};
-
 template <int Dim>
 struct intersects_cb {
-    void operator()( const typename PrimitiveBox<Dim>::Type& a,
-                     const typename PrimitiveBox<Dim>::Type& b ) {
-        if ( dispatch_intersects_sym( *a.handle(), *b.handle() ) ) {
-            throw found_an_intersection();
-        }
+    bool operator()( const typename PrimitiveBox<Dim>::Type& a,
+                     const typename PrimitiveBox<Dim>::Type& b ) const {
+        return dispatch_intersects_sym( *a.handle(), *b.handle() );
     }
 };
 
@@ -367,17 +365,9 @@ bool intersects( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
     a.computeBoundingBoxes( ahandles, aboxes );
     b.computeBoundingBoxes( bhandles, bboxes );
 
-    try {
-        intersects_cb<Dim> cb;
-        CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
-                                  bboxes.begin(), bboxes.end(),
-                                  cb );
-    }
-    catch ( found_an_intersection& e ) {
-        return true;
-    }
-
-    return false;
+    return box_intersection_until( aboxes.begin(), aboxes.end(),
+                                   bboxes.begin(), bboxes.end(),
+                                   intersects_cb<Dim>() );
 }
 
 template bool intersects<2>( const GeometrySet<2>& a, const GeometrySet<2>& b );
@@ -386,15 +376,30 @@ template bool intersects<3>( const GeometrySet<3>& a, const GeometrySet<3>& b );
 template bool intersects<2>( const PrimitiveHandle<2>& a, const PrimitiveHandle<2>& b );
 template bool intersects<3>( const PrimitiveHandle<3>& a, const PrimitiveHandle<3>& b );
 
+//
+// Use the double precision mirror when both geometries can be mirrored,
+// the exact GeometrySet otherwise
+template <int Dim>
+bool intersectsImpl( const Geometry& ga, const Geometry& gb )
+{
+    InexactGeometrySet<Dim> iga, igb;
+
+    if ( iga.build( ga ) && igb.build( gb ) ) {
+        return intersects( iga, igb );
+    }
+
+    GeometrySet<Dim> gsa( ga );
+    GeometrySet<Dim> gsb( gb );
+
+    return intersects( gsa, gsb );
+}
+
 bool intersects( const Geometry& ga, const Geometry& gb )
 {
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( ga );
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gb );
 
-    GeometrySet<2> gsa( ga );
-    GeometrySet<2> gsb( gb );
-
-    return intersects( gsa, gsb );
+    return intersectsImpl<2>( ga, gb );
 }
 
 bool intersects3D( const Geometry& ga, const Geometry& gb )
@@ -402,100 +407,202 @@ bool intersects3D( const Geometry& ga, const Geometry& gb )
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( ga );
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gb );
 
-    GeometrySet<3> gsa( ga );
-    GeometrySet<3> gsb( gb );
-
-    return intersects( gsa, gsb );
+    return intersectsImpl<3>( ga, gb );
 }
 
 bool intersects( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 {
-    GeometrySet<2> gsa( ga );
-    GeometrySet<2> gsb( gb );
-
-    return intersects( gsa, gsb );
+    return intersectsImpl<2>( ga, gb );
 }
 
 bool intersects3D( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 {
-    GeometrySet<3> gsa( ga );
-    GeometrySet<3> gsb( gb );
+    return intersectsImpl<3>( ga, gb );
+}
 
-    return intersects( gsa, gsb );
+bool intersects( const PreparedGeometry& pa, const Geometry& gb )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gb );
+
+    return pa.index<2>().intersects( gb );
 }
 
-template< int Dim >
-bool selfIntersectsImpl( const LineString& line )
+bool intersects3D( const PreparedGeometry& pa, const Geometry& gb )
 {
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gb );
 
-    if ( line.numSegments() < 2 ) {
-        return false;    // one segment cannot intersect
+    return pa.index<3>().intersects( gb );
+}
+
+//
+// For two collinear segments [a,b] and [c,d] which intersect, tells if
+// they only touch at a common end point (contact) instead of overlapping
+template <class P>
+bool collinearContact( const P& a, const P& b, const P& c, const P& d, P& contact )
+{
+    const P* shared;
+    const P* qa;
+    const P* qc;
+
+    if ( a == c || a == d ) {
+        shared = &a;
+        qa = &b;
+        qc = ( a == c ) ? &d : &c;
+    }
+    else if ( b == c || b == d ) {
+        shared = &b;
+        qa = &a;
+        qc = ( b == c ) ? &d : &c;
+    }
+    else {
+        return false;
     }
 
-    // note: zero length segments are a pain, to avoid algorithm complexity
-    // we start by filtering them out
-    const size_t numPoints = line.numPoints();
-    LineString l;
+    // the segments overlap if they are on the same side of the shared point
+    if ( CGAL::angle( *qa, *shared, *qc ) != CGAL::OBTUSE ) {
+        return false;
+    }
 
-    for ( size_t i = 0; i != numPoints; ++i ) {
-        if ( i==0 || l.endPoint() != line.pointN( i ) ) {
-            l.addPoint( line.pointN( i ) );
-        }
+    contact = *shared;
+    return true;
+}
+
+//
+// Test of a pair of segments of a LineString (without double points),
+// only relying on predicates so that it can be evaluated with any kernel.
+template <int Dim, class Segment, class P>
+struct segments_self_intersects_cb {
+    segments_self_intersects_cb( const std::vector<P>& points ) :
+        _points( points ),
+        _numSegments( points.size() - 1 ),
+        _closed( points.front() == points.back() ) {
     }
 
-    const size_t numSegments = l.numSegments();
+    bool operator()( const IndexedBox<Dim>& a, const IndexedBox<Dim>& b ) const {
+        const size_t i = std::min( a.index(), b.index() );
+        const size_t j = std::max( a.index(), b.index() );
 
-    // test any two pairs of segments
-    for ( size_t i = 0; i != numSegments; ++i ) {
-        // first line segment is point i and i+1
-        for ( size_t j = i + 1; j < numSegments; ++j ) {
-            /** @todo find a way to avoid ugly copy/paste here, toPoint_d< Dim > can be used,
-             * but I dont know what to do with Kernel::Segment_Dim and Kernel::Point_Dim
-             */
-            std::unique_ptr< Geometry > inter; // null if no intersection
-
-            if ( Dim == 2 ) {
-                const CGAL::Segment_2< Kernel > s1( l.pointN( i ).toPoint_2(), l.pointN( i + 1 ).toPoint_2() ) ;
-                const CGAL::Segment_2< Kernel > s2( l.pointN( j ).toPoint_2(), l.pointN( j + 1 ).toPoint_2() ) ;
-                const CGAL::Object out = CGAL::intersection( s1, s2 );
-
-                if ( out.is< Kernel::Point_2 >() ) {
-                    inter.reset( new Point( CGAL::object_cast< Kernel::Point_2 >( out ) ) );
-                }
-                else if ( out.is< Kernel::Segment_2 >() ) {
-                    const Kernel::Segment_2& s = CGAL::object_cast< Kernel::Segment_2 >( out );
-                    inter.reset( new LineString( s.point( 0 ), s.point( 1 ) ) ) ;
-                }
-            }
-            else {
-                const CGAL::Segment_3< Kernel > s1( l.pointN( i ).toPoint_3(), l.pointN( i + 1 ).toPoint_3() ) ;
-                const CGAL::Segment_3< Kernel > s2( l.pointN( j ).toPoint_3(), l.pointN( j + 1 ).toPoint_3() ) ;
-                const CGAL::Object out = CGAL::intersection( s1, s2 );
+        const Segment s1( _points[i], _points[i + 1] );
+        const Segment s2( _points[j], _points[j + 1] );
 
-                if ( out.is< Kernel::Point_3 >() ) {
-                    inter.reset( new Point( CGAL::object_cast< Kernel::Point_3 >( out ) ) );
-                }
-                else if ( out.is< Kernel::Segment_3 >() ) {
-                    const Kernel::Segment_3& s = CGAL::object_cast< Kernel::Segment_3 >( out );
-                    inter.reset( new LineString( s.point( 0 ), s.point( 1 ) ) ) ;
-                }
-            }
+        if ( ! CGAL::do_intersect( s1, s2 ) ) {
+            return false;
+        }
+
+        if ( CGAL::collinear( s1.source(), s1.target(), s2.source() )
+                && CGAL::collinear( s1.source(), s1.target(), s2.target() ) ) {
+            P contact;
 
-            if ( inter.get() && inter->is< LineString >() ) {
+            if ( ! collinearContact( s1.source(), s1.target(), s2.source(), s2.target(), contact ) ) {
                 return true;    // segments overlap
             }
-            else if ( inter.get() && inter->is< Point >()
-                      && !( i + 1 == j ) // one contact point between consecutive segments is ok
-                      && !( ( i == 0 )
-                            && ( j + 1 == numSegments )
-                            && inter->as< Point >() == l.startPoint()
-                            && inter->as< Point >() == l.endPoint() ) ) {
-                return true;    // contact point that is not a contact between startPoint and endPoint
+
+            if ( i + 1 == j ) {
+                return false;    // one contact point between consecutive segments is ok
+            }
+
+            if ( i == 0 && j + 1 == _numSegments && _closed && contact == _points.front() ) {
+                return false;    // contact between startPoint and endPoint
             }
+
+            return true;
+        }
+
+        // non collinear segments intersect at a single point, which is the
+        // shared point for consecutive segments and for the first and the last
+        // segments of a closed LineString
+        if ( i + 1 == j ) {
+            return false;
+        }
+
+        if ( i == 0 && j + 1 == _numSegments && _closed ) {
+            return false;
         }
+
+        return true;
     }
 
-    return false;
+private:
+    const std::vector<P>& _points;
+    const size_t _numSegments;
+    const bool _closed;
+};
+
+//
+// Number of segments from which the sweep on segment boxes indexes the active
+// boxes along the second axis (long rings would otherwise test every pair of
+// segments overlapping along x)
+const size_t INDEXED_SWEEP_MIN_SEGMENTS = 64;
+
+//
+// Self intersection test on the points of a LineString (without double points).
+// Only pairs of segments with intersecting bounding boxes are tested (in 3D, boxes
+// are swept in the xy plane and pairs are confirmed with exact 3D predicates).
+template <int Dim, class Segment, class P>
+bool selfIntersectsPoints( const std::vector<P>& points )
+{
+    if ( points.size() < 3 ) {
+        return false;
+    }
+
+    const size_t numSegments = points.size() - 1;
+
+    std::vector< IndexedBox<Dim> > boxes;
+    boxes.reserve( numSegments );
+
+    for ( size_t i = 0; i != numSegments; ++i ) {
+        boxes.push_back( IndexedBox<Dim>( Segment( points[i], points[i + 1] ).bbox(), i ) );
+    }
+
+    if ( numSegments < INDEXED_SWEEP_MIN_SEGMENTS ) {
+        return box_self_intersection_until( boxes.begin(), boxes.end(),
+                                            segments_self_intersects_cb<Dim, Segment, P>( points ) );
+    }
+
+    return box_self_intersection_indexed_until( boxes.begin(), boxes.end(),
+            segments_self_intersects_cb<Dim, Segment, P>( points ) );
+}
+
+//
+// Points of a LineString, skipping consecutive double points
+template< int Dim >
+void toPoints( const LineString& line, std::vector< typename Point_d<Dim>::Type >& points )
+{
+    const size_t numPoints = line.numPoints();
+    points.reserve( numPoints );
+
+    for ( size_t i = 0; i != numPoints; ++i ) {
+        const typename Point_d<Dim>::Type q = line.pointN( i ).toPoint_d<Dim>();
+
+        if ( points.empty() || points.back() != q ) {
+            points.push_back( q );
+        }
+    }
+}
+
+template< int Dim >
+bool selfIntersectsImpl( const LineString& line )
+{
+    typedef typename InexactTypeForDimension<Dim>::Point   InexactPoint;
+    typedef typename InexactTypeForDimension<Dim>::Segment InexactSegment;
+
+    if ( line.numSegments() < 2 ) {
+        return false;    // one segment cannot intersect
+    }
+
+    // note: zero length segments are a pain, to avoid algorithm complexity
+    // we start by filtering them out
+
+    // double precision points, if every coordinate is a double
+    std::vector<InexactPoint> inexactPoints;
+
+    if ( toInexactPoints( line, inexactPoints ) ) {
+        return selfIntersectsPoints<Dim, InexactSegment>( inexactPoints );
+    }
+
+    std::vector< typename Point_d<Dim>::Type > points;
+    toPoints<Dim>( line, points );
+    return selfIntersectsPoints< Dim, typename Segment_d<Dim>::Type >( points );
 }
 
 bool selfIntersects( const LineString& l )
@@ -507,44 +614,240 @@ bool selfIntersects3D( const LineString& l )
     return selfIntersectsImpl<3>( l );
 }
 
+//
+// Test of a pair of segments from two rings (without double points), only
+// relying on predicates. The first contact point is kept, the test stops on
+// a second contact point or on a crossing.
+template <int Dim, class Segment, class P>
+struct rings_contact_cb {
+    rings_contact_cb( const std::vector<P>& a, const std::vector<P>& b, const P*& contact ) :
+        _a( a ),
+        _b( b ),
+        _contact( contact ) {
+    }
+
+    bool operator()( const IndexedBox<Dim>& ia, const IndexedBox<Dim>& ib ) const {
+        const size_t i = ia.index();
+        const size_t j = ib.index();
+
+        const Segment s( _a[i], _a[i + 1] );
+        const Segment t( _b[j], _b[j + 1] );
+
+        if ( ! CGAL::do_intersect( s, t ) ) {
+            return false;
+        }
+
+        const P* point;
+
+        if ( CGAL::collinear( s.source(), s.target(), t.source() )
+                && CGAL::collinear( s.source(), s.target(), t.target() ) ) {
+            P contact;
+
+            if ( ! collinearContact( s.source(), s.target(), t.source(), t.target(), contact ) ) {
+                return true;    // segments overlap
+            }
+
+            point = ( contact == _a[i] ) ? &_a[i] : &_a[i + 1];
+        }
+        // the intersection point is an end point or the segments cross. Two rings
+        // which cross have at least two common points.
+        else if ( t.has_on( s.source() ) ) {
+            point = &_a[i];
+        }
+        else if ( t.has_on( s.target() ) ) {
+            point = &_a[i + 1];
+        }
+        else if ( s.has_on( t.source() ) ) {
+            point = &_b[j];
+        }
+        else if ( s.has_on( t.target() ) ) {
+            point = &_b[j + 1];
+        }
+        else {
+            return true;
+        }
+
+        if ( ! _contact ) {
+            _contact = point;
+            return false;
+        }
+
+        return *_contact != *point;
+    }
+
+private:
+    const std::vector<P>& _a;
+    const std::vector<P>& _b;
+    const P*& _contact;
+};
+
+template <int Dim, class Segment, class P>
+RingContact ringContactPoints( const std::vector<P>& a, const std::vector<P>& b )
+{
+    if ( a.size() < 2 || b.size() < 2 ) {
+        return RING_CONTACT_NONE;
+    }
+
+    std::vector< IndexedBox<Dim> > boxesA, boxesB;
+    boxesA.reserve( a.size() - 1 );
+    boxesB.reserve( b.size() - 1 );
+
+    for ( size_t i = 0; i + 1 < a.size(); ++i ) {
+        boxesA.push_back( IndexedBox<Dim>( Segment( a[i], a[i + 1] ).bbox(), i ) );
+    }
+
+    for ( size_t i = 0; i + 1 < b.size(); ++i ) {
+        boxesB.push_back( IndexedBox<Dim>( Segment( b[i], b[i + 1] ).bbox(), i ) );
+    }
+
+    const P* contact = NULL;
+
+    if ( box_intersection_until( boxesA.begin(), boxesA.end(), boxesB.begin(), boxesB.end(),
+                                 rings_contact_cb<Dim, Segment, P>( a, b, contact ) ) ) {
+        return RING_CONTACT_OVERLAP;
+    }
+
+    return contact ? RING_CONTACT_POINT : RING_CONTACT_NONE;
+}
 
 template< int Dim >
-bool selfIntersectsImpl( const PolyhedralSurface& s, const SurfaceGraph& graph )
+RingContact ringContactImpl( const LineString& a, const LineString& b )
 {
-    size_t numPolygons = s.numPolygons();
-
-    for ( size_t pi=0; pi != numPolygons; ++pi ) {
-        for ( size_t pj=pi+1; pj < numPolygons; ++pj ) {
-            std::unique_ptr< Geometry > inter = Dim == 3
-                                              ? intersection3D( s.polygonN( pi ), s.polygonN( pj ) )
-                                              : intersection( s.polygonN( pi ), s.polygonN( pj ) ) ;
-
-            if ( !inter->isEmpty() ) {
-                // two cases:
-                // - neighbors can have a line as intersection
-                // - non neighbors can only have a point or a set of points
-                typedef SurfaceGraph::FaceGraph::adjacency_iterator Iterator;
-                std::pair< Iterator, Iterator > neighbors = boost::adjacent_vertices( pi, graph.faceGraph() );
-
-                if ( neighbors.second != std::find( neighbors.first, neighbors.second, pj ) ) {
-                    // neighbor
-                    //std::cerr << pi << " " << pj << " neighbor\n";
-                    if ( !inter->is< LineString >() ) {
-                        return true;
-                    }
-                }
-                else {
-                    // not a neighbor
-                    //std::cerr << pi << " " << pj << " not neighbor\n";
-                    if ( inter->dimension() != 0 ) {
-                        return true;
-                    }
-                }
-            }
+    typedef typename InexactTypeForDimension<Dim>::Point   InexactPoint;
+    typedef typename InexactTypeForDimension<Dim>::Segment InexactSegment;
+
+    // double precision points, if every coordinate is a double
+    std::vector<InexactPoint> inexactA, inexactB;
+
+    if ( toInexactPoints( a, inexactA ) && toInexactPoints( b, inexactB ) ) {
+        return ringContactPoints<Dim, InexactSegment>( inexactA, inexactB );
+    }
+
+    std::vector< typename Point_d<Dim>::Type > pointsA, pointsB;
+    toPoints<Dim>( a, pointsA );
+    toPoints<Dim>( b, pointsB );
+    return ringContactPoints< Dim, typename Segment_d<Dim>::Type >( pointsA, pointsB );
+}
+
+RingContact ringContact( const LineString& a, const LineString& b )
+{
+    return ringContactImpl<2>( a, b );
+}
+RingContact ringContact3D( const LineString& a, const LineString& b )
+{
+    return ringContactImpl<3>( a, b );
+}
+
+
+//
+// faces of a PolyhedralSurface and of a TriangulatedSurface
+inline size_t numFaces( const PolyhedralSurface& s )
+{
+    return s.numPolygons();
+}
+inline const Polygon& faceN( const PolyhedralSurface& s, size_t n )
+{
+    return s.polygonN( n );
+}
+inline size_t numFaces( const TriangulatedSurface& tin )
+{
+    return tin.numTriangles();
+}
+inline const Triangle& faceN( const TriangulatedSurface& tin, size_t n )
+{
+    return tin.triangleN( n );
+}
+
+//
+// bounding box of a non empty face, from the (conservative) bbox of its exact points
+template <int Dim>
+typename TypeForDimension<Dim>::Bbox faceBbox( const Polygon& polygon )
+{
+    typename TypeForDimension<Dim>::Bbox bbox = polygon.exteriorRing().pointN( 0 ).toPoint_d<Dim>().bbox();
+
+    for ( size_t i = 0; i != polygon.numRings(); ++i ) {
+        const LineString& ring = polygon.ringN( i );
+
+        for ( size_t j = 0; j != ring.numPoints(); ++j ) {
+            bbox = bbox + ring.pointN( j ).toPoint_d<Dim>().bbox();
         }
     }
 
-    return false;
+    return bbox;
+}
+template <int Dim>
+typename TypeForDimension<Dim>::Bbox faceBbox( const Triangle& triangle )
+{
+    return triangle.vertex( 0 ).toPoint_d<Dim>().bbox()
+           + triangle.vertex( 1 ).toPoint_d<Dim>().bbox()
+           + triangle.vertex( 2 ).toPoint_d<Dim>().bbox();
+}
+
+//
+// Test of a pair of faces with intersecting bounding boxes
+template <int Dim, class Surface>
+struct faces_self_intersects_cb {
+    faces_self_intersects_cb( const Surface& s, const SurfaceGraph& graph ) :
+        _surface( s ),
+        _graph( graph ) {
+    }
+
+    bool operator()( const IndexedBox<Dim>& a, const IndexedBox<Dim>& b ) const {
+        const size_t pi = std::min( a.index(), b.index() );
+        const size_t pj = std::max( a.index(), b.index() );
+
+        std::unique_ptr< Geometry > inter = Dim == 3
+                                          ? intersection3D( faceN( _surface, pi ), faceN( _surface, pj ) )
+                                          : intersection( faceN( _surface, pi ), faceN( _surface, pj ) ) ;
+
+        if ( inter->isEmpty() ) {
+            return false;
+        }
+
+        // two cases:
+        // - neighbors can have a line as intersection
+        // - non neighbors can only have a point or a set of points
+        typedef SurfaceGraph::FaceGraph::adjacency_iterator Iterator;
+        std::pair< Iterator, Iterator > neighbors = boost::adjacent_vertices( pi, _graph.faceGraph() );
+
+        if ( neighbors.second != std::find( neighbors.first, neighbors.second, pj ) ) {
+            // neighbor
+            return !inter->is< LineString >();
+        }
+
+        // not a neighbor
+        return inter->dimension() != 0;
+    }
+
+private:
+    const Surface& _surface;
+    const SurfaceGraph& _graph;
+};
+
+template< int Dim, class Surface >
+bool selfIntersectsFaces( const Surface& s, const SurfaceGraph& graph )
+{
+    const size_t n = numFaces( s );
+
+    std::vector< IndexedBox<Dim> > boxes;
+    boxes.reserve( n );
+
+    for ( size_t i = 0; i != n; ++i ) {
+        if ( faceN( s, i ).isEmpty() ) {
+            continue;    // an empty face intersects nothing
+        }
+
+        boxes.push_back( IndexedBox<Dim>( faceBbox<Dim>( faceN( s, i ) ), i ) );
+    }
+
+    return box_self_intersection_until( boxes.begin(), boxes.end(),
+                                        faces_self_intersects_cb<Dim, Surface>( s, graph ) );
+}
+
+template< int Dim >
+bool selfIntersectsImpl( const PolyhedralSurface& s, const SurfaceGraph& graph )
+{
+    return selfIntersectsFaces<Dim>( s, graph );
 }
 
 bool selfIntersects( const PolyhedralSurface& s, const SurfaceGraph& g )
@@ -560,40 +863,7 @@ bool selfIntersects3D( const PolyhedralSurface& s, const SurfaceGraph& g )
 template< int Dim >
 bool selfIntersectsImpl( const TriangulatedSurface& tin, const SurfaceGraph& graph )
 {
-    size_t numTriangles = tin.numTriangles();
-
-    for ( size_t ti=0; ti != numTriangles; ++ti ) {
-        for ( size_t tj=ti+1; tj < numTriangles; ++tj ) {
-            std::unique_ptr< Geometry > inter = Dim == 3
-                                              ? intersection3D( tin.triangleN( ti ), tin.triangleN( tj ) )
-                                              : intersection( tin.triangleN( ti ), tin.triangleN( tj ) ) ;
-
-            if ( !inter->isEmpty() ) {
-                // two cases:
-                // - neighbors can have a line as intersection
-                // - non neighbors can only have a point or a set of points
-                typedef SurfaceGraph::FaceGraph::adjacency_iterator Iterator;
-                std::pair< Iterator, Iterator > neighbors = boost::adjacent_vertices( ti, graph.faceGraph() );
-
-                if ( neighbors.second != std::find( neighbors.first, neighbors.second, tj ) ) {
-                    // neighbor
-                    //std::cerr << ti << " " << tj << " neighbor\n";
-                    if ( !inter->is< LineString >() ) {
-                        return true;
-                    }
-                }
-                else {
-                    // not a neighbor
-                    //std::cerr << ti << " " << tj << " not neighbor\n";
-                    if ( inter->dimension() != 0 ) {
-                        return true;
-                    }
-                }
-            }
-        }
-    }
-
-    return false;
+    return selfIntersectsFaces<Dim>( tin, graph );
 }
 
 bool selfIntersects( const TriangulatedSurface& tin, const SurfaceGraph& g )
@@ -25,6 +25,7 @@
 
 namespace SFCGAL {
 class Geometry;
+class PreparedGeometry;
 class LineString;
 class PolyhedralSurface;
 class TriangulatedSurface;
@@ -68,6 +69,22 @@ SFCGAL_API bool intersects( const Geometry& ga, const Geometry& gb, NoValidityCh
  */
 SFCGAL_API bool intersects3D( const Geometry& ga, const Geometry& gb, NoValidityCheck );
 
+/**
+ * Intersection test on 2D geometries, using the index of a PreparedGeometry
+ * (built on first use). Force projection to z=0 if needed
+ * @pre pa and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API bool intersects( const PreparedGeometry& pa, const Geometry& gb );
+
+/**
+ * Intersection test on 3D geometries, using the index of a PreparedGeometry
+ * (built on first use). Assume z = 0 if needed
+ * @pre pa and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API bool intersects3D( const PreparedGeometry& pa, const Geometry& gb );
+
 /**
  * Intersection test on GeometrySet
  * @ingroup detail
@@ -94,6 +111,30 @@ bool selfIntersects( const LineString& l );
  */
 bool selfIntersects3D( const LineString& l );
 
+/**
+ * Contact between two rings of a Polygon
+ * @ingroup detail
+ */
+enum RingContact {
+    RING_CONTACT_NONE    = 0, // no common point
+    RING_CONTACT_POINT   = 1, // one common point
+    RING_CONTACT_OVERLAP = 2  // more than one common point
+};
+
+/**
+ * Contact between two closed 2D LineStrings, computed with predicates only
+ * @pre a and b do not self intersect
+ * @ingroup detail
+ */
+RingContact ringContact( const LineString& a, const LineString& b );
+
+/**
+ * Contact between two closed 3D LineStrings, computed with predicates only
+ * @pre a and b do not self intersect
+ * @ingroup detail
+ */
+RingContact ringContact3D( const LineString& a, const LineString& b );
+
 /**
  * Self intersection test for 2D PolyhedralSurface (false if only point touch)
  * @ingroup detail
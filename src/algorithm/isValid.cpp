@@ -44,6 +44,9 @@
 #include <SFCGAL/detail/tools/Log.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
 #include <SFCGAL/detail/ForceValidityVisitor.h>
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/tools/ThreadPool.h>
+#include <SFCGAL/detail/detachedCopy.h>
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Exception.h>
 
@@ -52,6 +55,9 @@
 #include <boost/graph/undirected_dfs.hpp>
 #include <boost/format.hpp>
 
+#include <atomic>
+#include <exception>
+
 using namespace SFCGAL::detail::algorithm;
 
 namespace SFCGAL {
@@ -73,9 +79,34 @@ void SFCGAL_ASSERT_GEOMETRY_VALIDITY_( const Geometry& g, const std::string& ctx
     }
 }
 
+namespace {
+
+// counters of the validity cache
+std::atomic< size_t > validityCacheHits( 0 );
+std::atomic< size_t > validityCacheMisses( 0 );
+
+//
+// true (and counts a hit) if check already succeeded on the current state of g
+bool hasCachedValidity( const Geometry& g, Geometry::ValidityCheck check )
+{
+    if ( g.hasCachedValidity( check ) ) {
+        validityCacheHits.fetch_add( 1, std::memory_order_relaxed );
+        return true;
+    }
+
+    validityCacheMisses.fetch_add( 1, std::memory_order_relaxed );
+    return false;
+}
+
+}
+
 void SFCGAL_ASSERT_GEOMETRY_VALIDITY( const Geometry& g )
 {
-    SFCGAL_ASSERT_GEOMETRY_VALIDITY_(g,"");
+    if ( !(g).hasValidityFlag() && ! hasCachedValidity( g, Geometry::VALIDITY_CHECK_DEFAULT ) )
+    {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_(g,"");
+        g.cacheValidity( Geometry::VALIDITY_CHECK_DEFAULT );
+    }
 }
 
 void SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( const Geometry& g )
@@ -84,9 +115,14 @@ void SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( const Geometry& g )
     {
         using namespace SFCGAL;
         if ( (g).is3D() ) {
+            if ( hasCachedValidity( g, Geometry::VALIDITY_CHECK_2D ) ) {
+                return;
+            }
+
             std::unique_ptr<SFCGAL::Geometry> sfcgalAssertGeometryValidityClone( (g).clone() );
             algorithm::force2D( *sfcgalAssertGeometryValidityClone );
             SFCGAL_ASSERT_GEOMETRY_VALIDITY_( (*sfcgalAssertGeometryValidityClone), "When converting to 2D - " );
+            g.cacheValidity( Geometry::VALIDITY_CHECK_2D );
         }
         else {
             SFCGAL_ASSERT_GEOMETRY_VALIDITY( g );
@@ -100,9 +136,14 @@ void SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( const Geometry& g )
     {
         using namespace SFCGAL;
         if ( !(g).is3D() ) {
+            if ( hasCachedValidity( g, Geometry::VALIDITY_CHECK_3D ) ) {
+                return;
+            }
+
             std::unique_ptr<Geometry> sfcgalAssertGeometryValidityClone( (g).clone() );
             algorithm::force3D( *sfcgalAssertGeometryValidityClone );
             SFCGAL_ASSERT_GEOMETRY_VALIDITY_( (*sfcgalAssertGeometryValidityClone), "When converting to 3D - " );
+            g.cacheValidity( Geometry::VALIDITY_CHECK_3D );
         }
         else {
             SFCGAL_ASSERT_GEOMETRY_VALIDITY( g );
@@ -172,6 +213,75 @@ const Validity isValid( const LineString& l, const double& toleranceAbs )
     return length3D( l ) > toleranceAbs ? Validity::valid() : Validity::invalid( "no length" );
 }
 
+namespace {
+
+//
+// Bounding box of a ring
+template <int Dim>
+typename detail::TypeForDimension<Dim>::Bbox ringBbox( const LineString& ring )
+{
+    typename detail::TypeForDimension<Dim>::Bbox bbox = ring.pointN( 0 ).toPoint_d<Dim>().bbox();
+
+    for ( size_t i = 1; i != ring.numPoints(); ++i ) {
+        bbox = bbox + ring.pointN( i ).toPoint_d<Dim>().bbox();
+    }
+
+    return bbox;
+}
+
+//
+// Test of a pair of rings with overlapping envelopes
+template <int Dim>
+struct polygon_rings_cb {
+    polygon_rings_cb( const Polygon& p, std::vector< std::pair<int,int> >& touchingRings, std::pair<int,int>& intersectingRings ) :
+        _polygon( p ),
+        _touchingRings( touchingRings ),
+        _intersectingRings( intersectingRings ) {
+    }
+
+    bool operator()( const detail::IndexedBox<Dim>& a, const detail::IndexedBox<Dim>& b ) const {
+        const std::pair<int,int> rings( int( std::min( a.index(), b.index() ) ), int( std::max( a.index(), b.index() ) ) );
+        const RingContact contact = ( Dim == 3 )
+                                    ? ringContact3D( _polygon.ringN( rings.first ), _polygon.ringN( rings.second ) )
+                                    : ringContact( _polygon.ringN( rings.first ), _polygon.ringN( rings.second ) );
+
+        if ( contact == RING_CONTACT_OVERLAP ) {
+            _intersectingRings = rings;
+            return true;
+        }
+
+        if ( contact == RING_CONTACT_POINT ) {
+            _touchingRings.push_back( rings );
+        }
+
+        return false;
+    }
+
+private:
+    const Polygon& _polygon;
+    std::vector< std::pair<int,int> >& _touchingRings;
+    std::pair<int,int>& _intersectingRings;
+};
+
+//
+// Fills the pairs of rings sharing one point
+// @return true if a pair of rings shares more than one point (intersectingRings)
+template <int Dim>
+bool ringsIntersect( const Polygon& p, std::vector< std::pair<int,int> >& touchingRings, std::pair<int,int>& intersectingRings )
+{
+    std::vector< detail::IndexedBox<Dim> > boxes;
+    boxes.reserve( p.numRings() );
+
+    for ( size_t r = 0; r != p.numRings(); ++r ) {
+        boxes.push_back( detail::IndexedBox<Dim>( ringBbox<Dim>( p.ringN( r ) ), r ) );
+    }
+
+    return detail::box_self_intersection_indexed_until( boxes.begin(), boxes.end(),
+            polygon_rings_cb<Dim>( p, touchingRings, intersectingRings ) );
+}
+
+}
+
 const Validity isValid( const Polygon& p, const double& toleranceAbs )
 {
     if ( p.isEmpty() ) {
@@ -252,19 +362,14 @@ const Validity isValid( const Polygon& p, const double& toleranceAbs )
         typedef std::pair<int,int> Edge;
         std::vector<Edge> touchingRings;
 
-        for ( size_t ri=0; ri < numRings; ++ri ) { // no need for numRings-1, the next loop won't be entered for the last ring
-            for ( size_t rj=ri+1; rj < numRings; ++rj ) {
-                std::unique_ptr<Geometry> inter = p.is3D()
-                                                ? intersection3D( p.ringN( ri ), p.ringN( rj ) )
-                                                : intersection( p.ringN( ri ), p.ringN( rj ) );
+        // only rings with overlapping envelopes are tested
+        Edge intersectingRings;
+        const bool intersect = p.is3D()
+                               ? ringsIntersect<3>( p, touchingRings, intersectingRings )
+                               : ringsIntersect<2>( p, touchingRings, intersectingRings );
 
-                if ( ! inter->isEmpty() && ! inter->is< Point >() ) {
-                    return Validity::invalid( ( boost::format( "intersection between ring %d and %d" ) % ri % rj ).str() );
-                }
-                else if ( ! inter->isEmpty() && inter->is< Point >() ) {
-                    touchingRings.push_back( Edge( ri,rj ) );
-                }
-            }
+        if ( intersect ) {
+            return Validity::invalid( ( boost::format( "intersection between ring %d and %d" ) % intersectingRings.first % intersectingRings.second ).str() );
         }
 
         {
@@ -318,26 +423,132 @@ const Validity isValid( const Triangle& t, const double& toleranceAbs )
     return isValid( t.toPolygon(), toleranceAbs );
 }
 
-const Validity isValid( const MultiLineString& ml, const double& toleranceAbs )
-{
-    if ( ml.isEmpty() ) {
-        return Validity::valid();
+namespace {
+
+//
+// Checks the parts of a geometry, in parallel if a pool is given. The reported
+// failures do not depend on the order in which the threads run the checks.
+class PartValidator {
+public:
+    PartValidator( tools::ThreadPool* pool = 0, ValidityReport report = VALIDITY_REPORT_FIRST ) :
+        _pool( pool ),
+        _report( report ) {
     }
 
-    const size_t numLineString = ml.numGeometries();
+    //
+    // validator for the parts of a part (a pool can't run nested loops)
+    PartValidator nested() const {
+        return PartValidator( 0, _report );
+    }
 
-    for ( size_t l = 0; l != numLineString; ++l ) {
-        Validity v = isValid( ml.lineStringN( l ), toleranceAbs );
+    ValidityReport report() const {
+        return _report;
+    }
 
-        if ( !v ) return Validity::invalid(
-                                 ( boost::format( "LineString %d is invalid: %s" ) % l % v.reason() ).str()
-                             );
+    //
+    // runs check( i ) for i in [0,n) and reports the invalid parts in index order,
+    // the first one or every one of them according to report()
+    template <class F>
+    const Validity operator()( size_t n, F check ) const {
+        std::vector< std::string > reasons;
+
+        if ( ! _pool || n < 2 ) {
+            for ( size_t i = 0; i != n; ++i ) {
+                const Validity v = check( i );
+
+                if ( ! v ) {
+                    if ( _report == VALIDITY_REPORT_FIRST ) {
+                        return v;
+                    }
+
+                    reasons.push_back( v.reason() );
+                }
+            }
+
+            return join( reasons );
+        }
+
+        std::vector< Validity > results( n, Validity::valid() );
+        std::vector< std::exception_ptr > errors( n );
+        std::atomic< size_t > firstFailure( n );
+        const bool stopAtFirst = ( _report == VALIDITY_REPORT_FIRST );
+
+        _pool->parallelFor( n, [&]( size_t i ) {
+            // a part with a lower index is already known to be invalid
+            if ( stopAtFirst && i > firstFailure ) {
+                return;
+            }
+
+            try {
+                results[i] = check( i );
+            }
+            catch ( ... ) {
+                errors[i] = std::current_exception();
+            }
+
+            if ( stopAtFirst && ( errors[i] || ! results[i] ) ) {
+                size_t current = firstFailure;
+
+                while ( i < current && ! firstFailure.compare_exchange_weak( current, i ) ) {}
+            }
+        } );
+
+        // same exception or reason as a sequential loop
+        for ( size_t i = 0; i != n; ++i ) {
+            if ( errors[i] ) {
+                std::rethrow_exception( errors[i] );
+            }
+
+            if ( ! results[i] ) {
+                if ( stopAtFirst ) {
+                    return results[i];
+                }
+
+                reasons.push_back( results[i].reason() );
+            }
+        }
+
+        return join( reasons );
     }
 
-    return Validity::valid();
+private:
+    static const Validity join( const std::vector< std::string >& reasons ) {
+        if ( reasons.empty() ) {
+            return Validity::valid();
+        }
+
+        std::string reason = reasons[0];
+
+        for ( size_t i = 1; i != reasons.size(); ++i ) {
+            reason += "; " + reasons[i];
+        }
+
+        return Validity::invalid( reason );
+    }
+
+    tools::ThreadPool* _pool;
+    ValidityReport     _report;
+};
+
+} // namespace
+
+const Validity isValid( const Geometry& g, const double& toleranceAbs, const PartValidator& parts );
+
+const Validity isValid( const MultiLineString& ml, const double& toleranceAbs, const PartValidator& parts )
+{
+    if ( ml.isEmpty() ) {
+        return Validity::valid();
+    }
+
+    return parts( ml.numGeometries(), [&]( size_t l ) {
+        const Validity v = isValid( ml.lineStringN( l ), toleranceAbs );
+        return v ? v : Validity::invalid(
+                   ( boost::format( "LineString %d is invalid: %s" ) % l % v.reason() ).str()
+               );
+    } );
 }
 
-const Validity isValid( const MultiPolygon& mp, const double& toleranceAbs )
+const Validity isValid( const MultiPolygon& mp, const double& toleranceAbs, const PartValidator& parts )
 {
     if ( mp.isEmpty() ) {
         return Validity::valid();
@@ -345,15 +556,21 @@ const Validity isValid( const MultiPolygon& mp, const double& toleranceAbs )
 
     const size_t numPolygons = mp.numGeometries();
 
-    for ( size_t p = 0; p != numPolygons; ++p ) {
-        Validity v = isValid( mp.polygonN( p ), toleranceAbs );
+    const Validity members = parts( numPolygons, [&]( size_t p ) {
+        const Validity v = isValid( mp.polygonN( p ), toleranceAbs );
+        return v ? v : Validity::invalid(
+                   ( boost::format( "Polygon %d is invalid: %s" ) % p % v.reason() ).str()
+               );
+    } );
 
-        if ( !v ) return Validity::invalid(
-                                 ( boost::format( "Polygon %d is invalid: %s" ) % p % v.reason() ).str()
-                             );
+    if ( ! members ) {
+        return members;
     }
 
-    for ( size_t pi = 0; pi != numPolygons; ++pi ) {
+    // each polygon is tested against the following ones, sequentially : a polygon
+    // takes part in several pairs and lazy exact numbers can't be read from several
+    // threads at once (reference counts and lazy evaluation are not thread safe)
+    return parts.nested()( numPolygons, [&]( size_t pi ) {
         for ( size_t pj = pi+1; pj < numPolygons; ++pj ) {
             std::unique_ptr< Geometry > inter = mp.is3D()
                                               ? intersection3D( mp.polygonN( pi ), mp.polygonN( pj ) )
@@ -366,44 +583,40 @@ const Validity isValid( const MultiPolygon& mp, const double& toleranceAbs )
                        );
             }
         }
-    }
 
-    return Validity::valid();
+        return Validity::valid();
+    } );
 }
 
-const Validity isValid( const GeometryCollection& gc, const double& toleranceAbs )
+const Validity isValid( const GeometryCollection& gc, const double& toleranceAbs, const PartValidator& parts )
 {
     if ( gc.isEmpty() ) {
         return Validity::valid();
     }
 
-    const size_t numGeom = gc.numGeometries();
-
-    for ( size_t g = 0; g != numGeom; ++g ) {
-        Validity v = isValid( gc.geometryN( g ), toleranceAbs );
-
-        if ( !v ) return Validity::invalid(
-                                 ( boost::format( "%s %d is invalid: %s" ) % gc.geometryN( g ).geometryType()  % g % v.reason() ).str()
-                             );
-    }
-
-    return Validity::valid();
+    return parts( gc.numGeometries(), [&]( size_t g ) {
+        const Validity v = isValid( gc.geometryN( g ), toleranceAbs, parts.nested() );
+        return v ? v : Validity::invalid(
+                   ( boost::format( "%s %d is invalid: %s" ) % gc.geometryN( g ).geometryType()  % g % v.reason() ).str()
+               );
+    } );
 }
 
-const Validity isValid( const TriangulatedSurface& tin, const SurfaceGraph& graph, const double& toleranceAbs )
+const Validity isValid( const TriangulatedSurface& tin, const SurfaceGraph& graph, const double& toleranceAbs, const PartValidator& parts )
 {
     if ( tin.isEmpty() ) {
         return Validity::valid();
     }
 
-    size_t numTriangles = tin.numTriangles();
-
-    for ( size_t t=0; t != numTriangles; ++t ) {
-        Validity v = isValid( tin.triangleN( t ), toleranceAbs );
+    const Validity triangles = parts( tin.numTriangles(), [&]( size_t t ) {
+        const Validity v = isValid( tin.triangleN( t ), toleranceAbs );
+        return v ? v : Validity::invalid(
+                   ( boost::format( "Triangle %d is invalid: %s" ) % t % v.reason() ).str()
+               );
+    } );
 
-        if ( !v ) return Validity::invalid(
-                                 ( boost::format( "Triangle %d is invalid: %s" ) % t % v.reason() ).str()
-                             );
+    if ( ! triangles ) {
+        return triangles;
     }
 
     if ( !isConnected( graph ) ) {
@@ -417,30 +630,31 @@ const Validity isValid( const TriangulatedSurface& tin, const SurfaceGraph& grap
     return Validity::valid();
 }
 
-const Validity isValid( const TriangulatedSurface& tin, const double& toleranceAbs )
+const Validity isValid( const TriangulatedSurface& tin, const double& toleranceAbs, const PartValidator& parts )
 {
     if ( tin.isEmpty() ) {
         return Validity::valid();
     }
 
     const SurfaceGraph graph( tin );
-    return graph.isValid() ? isValid( tin, graph, toleranceAbs ) : graph.isValid() ;
+    return graph.isValid() ? isValid( tin, graph, toleranceAbs, parts ) : graph.isValid() ;
 }
 
-const Validity isValid( const PolyhedralSurface& s, const SurfaceGraph& graph, const double& toleranceAbs )
+const Validity isValid( const PolyhedralSurface& s, const SurfaceGraph& graph, const double& toleranceAbs, const PartValidator& parts )
 {
     if ( s.isEmpty() ) {
         return Validity::valid();
     }
 
-    size_t numPolygons = s.numPolygons();
-
-    for ( size_t p=0; p != numPolygons; ++p ) {
-        Validity v = isValid( s.polygonN( p ), toleranceAbs );
+    const Validity polygons = parts( s.numPolygons(), [&]( size_t p ) {
+        const Validity v = isValid( s.polygonN( p ), toleranceAbs );
+        return v ? v : Validity::invalid(
+                   ( boost::format( "Polygon %d is invalid: %s" ) % p % v.reason() ).str()
+               );
+    } );
 
-        if ( !v ) return Validity::invalid(
-                                 ( boost::format( "Polygon %d is invalid: %s" ) % p % v.reason() ).str()
-                             );
+    if ( ! polygons ) {
+        return polygons;
     }
 
     if ( !isConnected( graph ) ) {
@@ -454,27 +668,25 @@ const Validity isValid( const PolyhedralSurface& s, const SurfaceGraph& graph, c
     return Validity::valid();
 }
 
-const Validity isValid( const PolyhedralSurface& s, const double& toleranceAbs )
+const Validity isValid( const PolyhedralSurface& s, const double& toleranceAbs, const PartValidator& parts )
 {
     if ( s.isEmpty() ) {
         return Validity::valid();
     }
 
     const SurfaceGraph graph( s );
-    return graph.isValid() ? isValid( s, graph, toleranceAbs ) : graph.isValid() ;
+    return graph.isValid() ? isValid( s, graph, toleranceAbs, parts ) : graph.isValid() ;
 }
 
-const Validity isValid( const Solid& solid, const double& toleranceAbs )
+const Validity isValid( const Solid& solid, const double& toleranceAbs, const PartValidator& parts )
 {
     if ( solid.isEmpty() ) {
         return Validity::valid();
     }
 
-    const size_t numShells = solid.numShells();
-
-    for ( size_t s = 0; s != numShells; ++s ) {
+    const Validity shells = parts( solid.numShells(), [&]( size_t s ) {
         const SurfaceGraph graph( solid.shellN( s ) );
-        Validity v = isValid( solid.shellN( s ), graph, toleranceAbs );
+        const Validity v = isValid( solid.shellN( s ), graph, toleranceAbs, parts.nested() );
 
         if ( !v ) return Validity::invalid(
                                  ( boost::format( "PolyhedralSurface (shell) %d is invalid: %s" ) % s % v.reason() ).str()
@@ -483,6 +695,12 @@ const Validity isValid( const Solid& solid, const double& toleranceAbs )
         if ( !isClosed( graph ) ) return Validity::invalid(
                                                  ( boost::format( "PolyhedralSurface (shell) %d is not closed" ) % s ).str()
                                              );
+
+        return Validity::valid();
+    } );
+
+    if ( ! shells ) {
+        return shells;
     }
 
     if ( solid.numInteriorShells() ) {
@@ -492,27 +710,21 @@ const Validity isValid( const Solid& solid, const double& toleranceAbs )
     return Validity::valid();
 }
 
-const Validity isValid( const MultiSolid& ms, const double& toleranceAbs )
+const Validity isValid( const MultiSolid& ms, const double& toleranceAbs, const PartValidator& parts )
 {
     if ( ms.isEmpty() ) {
         return Validity::valid();
     }
 
-    const size_t numMultiSolid = ms.numGeometries();
-
-    for ( size_t s = 0; s != numMultiSolid; ++s ) {
-        Validity v = isValid( ms.solidN( s ), toleranceAbs );
-
-        if ( !v ) return Validity::invalid(
-                                 ( boost::format( "Solid %d is invalid: %s" ) % s % v.reason() ).str()
-                             );
-    }
-
-    return Validity::valid();
+    return parts( ms.numGeometries(), [&]( size_t s ) {
+        const Validity v = isValid( ms.solidN( s ), toleranceAbs, parts.nested() );
+        return v ? v : Validity::invalid(
+                   ( boost::format( "Solid %d is invalid: %s" ) % s % v.reason() ).str()
+               );
+    } );
 }
 
-
-const Validity isValid( const Geometry& g, const double& toleranceAbs )
+const Validity isValid( const Geometry& g, const double& toleranceAbs, const PartValidator& parts )
 {
     switch ( g.geometryTypeId() ) {
     case TYPE_POINT:
@@ -528,28 +740,28 @@ const Validity isValid( const Geometry& g, const double& toleranceAbs )
         return isValid( g.as< Triangle >(),            toleranceAbs ) ;
 
     case TYPE_SOLID:
-        return isValid( g.as< Solid >(),               toleranceAbs ) ;
+        return isValid( g.as< Solid >(),               toleranceAbs, parts ) ;
 
     case TYPE_MULTIPOINT:
         return Validity::valid();
 
     case TYPE_MULTILINESTRING:
-        return isValid( g.as< MultiLineString >(),     toleranceAbs ) ;
+        return isValid( g.as< MultiLineString >(),     toleranceAbs, parts ) ;
 
     case TYPE_MULTIPOLYGON:
-        return isValid( g.as< MultiPolygon >(),        toleranceAbs ) ;
+        return isValid( g.as< MultiPolygon >(),        toleranceAbs, parts ) ;
 
     case TYPE_MULTISOLID:
-        return isValid( g.as< MultiSolid >(),          toleranceAbs ) ;
+        return isValid( g.as< MultiSolid >(),          toleranceAbs, parts ) ;
 
     case TYPE_GEOMETRYCOLLECTION:
-        return isValid( g.as< GeometryCollection >(),  toleranceAbs ) ;
+        return isValid( g.as< GeometryCollection >(),  toleranceAbs, parts ) ;
 
     case TYPE_TRIANGULATEDSURFACE:
-        return isValid( g.as< TriangulatedSurface >(), toleranceAbs ) ;
+        return isValid( g.as< TriangulatedSurface >(), toleranceAbs, parts ) ;
 
     case TYPE_POLYHEDRALSURFACE:
-        return isValid( g.as< PolyhedralSurface >(),   toleranceAbs ) ;
+        return isValid( g.as< PolyhedralSurface >(),   toleranceAbs, parts ) ;
     }
 
     BOOST_THROW_EXCEPTION( Exception(
@@ -558,6 +770,43 @@ const Validity isValid( const Geometry& g, const double& toleranceAbs )
     return Validity::invalid( ( boost::format( "isValid( %s ) is not defined" ) % g.geometryType() ).str() ); // to avoid warning
 }
 
+const Validity isValid( const Geometry& g, const double& toleranceAbs )
+{
+    return isValid( g, toleranceAbs, PartValidator() );
+}
+
+const Validity isValid( const Geometry& g, const double& toleranceAbs, size_t numThreads, ValidityReport report )
+{
+    if ( numThreads == 1 ) {
+        return isValid( g, toleranceAbs, PartValidator( 0, report ) );
+    }
+
+    tools::ThreadPool pool( numThreads );
+
+    if ( pool.size() > 1 ) {
+        // parts may share lazy exact numbers (faces of an extruded solid), the
+        // threads check a copy in which every point has its own numbers
+        const std::unique_ptr< Geometry > copy = detail::detachedCopy( g );
+        return isValid( *copy, toleranceAbs, PartValidator( &pool, report ) );
+    }
+
+    return isValid( g, toleranceAbs, PartValidator( &pool, report ) );
+}
+
+ValidityCacheStats validityCacheStats()
+{
+    ValidityCacheStats stats;
+    stats.hits   = validityCacheHits.load( std::memory_order_relaxed );
+    stats.misses = validityCacheMisses.load( std::memory_order_relaxed );
+    return stats;
+}
+
+void resetValidityCacheStats()
+{
+    validityCacheHits   = 0;
+    validityCacheMisses = 0;
+}
+
 void propagateValidityFlag( Geometry& g, bool valid )
 {
     detail::ForceValidityVisitor v( valid );
@@ -31,6 +31,7 @@ namespace SFCGAL {
 /**
  * Functions used to assert for geometry validity
  * @note exception message is apparently limited in length, thus print the reason for invalidity before its text representation (that can be very long)
+ * @note a successful check is cached by the geometry until its generation changes (see Geometry::hasCachedValidity)
  */
 void SFCGAL_API SFCGAL_ASSERT_GEOMETRY_VALIDITY( const Geometry& g );
 void SFCGAL_API SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( const Geometry& g );
@@ -45,6 +46,45 @@ namespace algorithm {
  */
 SFCGAL_API const Validity isValid( const Geometry& g, const double& toleranceAbs= 1e-9 );
 
+/**
+ * Invalid parts reported by a validity check
+ */
+enum ValidityReport {
+    VALIDITY_REPORT_FIRST, ///< the reason of the invalid part with the lowest index
+    VALIDITY_REPORT_ALL    ///< the reasons of every invalid part in index order, separated by "; "
+};
+
+/**
+ * @brief Check validity of a geometry, checking the members of collections, the polygons
+ * of surfaces and the shells of solids with numThreads threads (0 for std::thread::hardware_concurrency())
+ * @note the reason does not depend on the number of threads
+ * @note with several threads, a copy of g in which no point shares its exact numbers
+ * is checked. g must not be used by an other thread during the call.
+ * @ingroup public_api
+ */
+SFCGAL_API const Validity isValid( const Geometry& g, const double& toleranceAbs, size_t numThreads,
+                                   ValidityReport report = VALIDITY_REPORT_FIRST );
+
+/**
+ * Counters of the validity cache used by SFCGAL_ASSERT_GEOMETRY_VALIDITY*
+ */
+struct ValidityCacheStats {
+    size_t hits;   ///< checks skipped
+    size_t misses; ///< checks run
+};
+
+/**
+ * Returns the counters of the validity cache (for the whole process)
+ * @ingroup public_api
+ */
+SFCGAL_API ValidityCacheStats validityCacheStats();
+
+/**
+ * Resets the counters of the validity cache
+ * @ingroup public_api
+ */
+SFCGAL_API void resetValidityCacheStats();
+
 /**
  * Sets the geometry flag on a geometry and propagate to every internal geometries
  * @ingroup public_api
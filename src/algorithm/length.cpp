@@ -23,16 +23,43 @@
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/GeometryCollection.h>
 
+#include <SFCGAL/detail/ApproximateLineString.h>
+
 #include <SFCGAL/Exception.h>
 
 namespace SFCGAL {
 namespace algorithm {
 
+namespace {
+
+/**
+ * Length of a LineString evaluated with doubles
+ * @return false if the result can't be guaranteed to be within
+ * detail::MEASURE_RELATIVE_ERROR of the exact length
+ */
+bool approximateLength( const LineString& g, const int& dimension, double& result )
+{
+    detail::ApproximateLineString approximation ;
+    double bound ;
+
+    return approximation.assign( g, dimension )
+           && approximation.length( dimension, result, bound )
+           && bound <= detail::MEASURE_RELATIVE_ERROR * result ;
+}
+
+} // namespace
+
 ///
 ///
 ///
 double length( const LineString& g )
 {
+    double approximation ;
+
+    if ( approximateLength( g, 2, approximation ) ) {
+        return approximation ;
+    }
+
     double result = 0.0 ;
 
     for ( size_t i = 0; i < g.numSegments(); i++ ) {
@@ -106,6 +133,12 @@ double length( const Geometry& g )
 ///
 double length3D( const LineString& g )
 {
+    double approximation ;
+
+    if ( approximateLength( g, 3, approximation ) ) {
+        return approximation ;
+    }
+
     double result = 0.0 ;
 
     for ( size_t i = 0; i < g.numSegments(); i++ ) {
@@ -34,6 +34,9 @@ namespace algorithm {
 
 /**
  * @brief Compute the 2D length for a Geometry (0 for incompatible types)
+ * @note lengths are evaluated with compensated double sums and are within a
+ * relative error of detail::MEASURE_RELATIVE_ERROR (2^-42) of the sum of the
+ * exact segment lengths. Exact arithmetic is only used when this can't be guaranteed.
  */
 SFCGAL_API double length( const Geometry& g ) ;
 /**
@@ -25,9 +25,63 @@
 #include <SFCGAL/triangulate/triangulatePolygon.h>
 #include <SFCGAL/algorithm/isValid.h>
 
+#include <vector>
+
 namespace SFCGAL {
 namespace algorithm {
 
+namespace {
+
+///
+/// build the result of tesselate with empty TriangulatedSurfaces, which are
+/// listed with the surfaces to triangulate in them
+///
+std::unique_ptr<Geometry> tesselateLater( const Geometry& g, std::vector< const Geometry* >& surfaces, std::vector< TriangulatedSurface* >& triSurfs )
+{
+    switch ( g.geometryTypeId() ) {
+    case TYPE_POLYGON:
+    case TYPE_POLYHEDRALSURFACE: {
+        TriangulatedSurface* triSurf = new TriangulatedSurface();
+        surfaces.push_back( &g );
+        triSurfs.push_back( triSurf );
+        return std::unique_ptr<Geometry>( triSurf );
+    }
+
+    case TYPE_SOLID: {
+        std::unique_ptr<GeometryCollection> ret( new GeometryCollection );
+
+        for ( size_t i = 0; i < g.as<Solid>().numShells(); ++i ) {
+            const PolyhedralSurface& shellN = g.as<Solid>().shellN( i ) ;
+
+            if ( ! shellN.isEmpty() ) {
+                ret->addGeometry( tesselateLater( shellN, surfaces, triSurfs ).release() );
+            }
+        }
+
+        return std::unique_ptr<Geometry>( ret.release() );
+    }
+
+    case TYPE_MULTIPOLYGON:
+    case TYPE_MULTISOLID:
+    case TYPE_GEOMETRYCOLLECTION: {
+        std::unique_ptr<GeometryCollection> ret( new GeometryCollection );
+
+        for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+            ret->addGeometry( tesselateLater( g.geometryN( i ), surfaces, triSurfs ).release() );
+        }
+
+        return std::unique_ptr<Geometry>( ret.release() );
+    }
+
+    default:
+        break;
+    }
+
+    return std::unique_ptr<Geometry>( g.clone() );
+}
+
+} // namespace
+
 ///
 ///
 ///
@@ -89,6 +143,22 @@ std::unique_ptr<Geometry> tesselate( const Geometry& g )
     return tesselate( g, NoValidityCheck() );
 }
 
+std::unique_ptr<Geometry> tesselate( const Geometry& g, size_t numThreads, triangulate::TriangulationQuality quality )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY( g );
+
+    std::vector< const Geometry* > surfaces;
+    std::vector< TriangulatedSurface* > triSurfs;
+    std::unique_ptr<Geometry> result( tesselateLater( g, surfaces, triSurfs ) );
+    triangulate::triangulatePolygon3D( surfaces, triSurfs, numThreads, quality );
+    return result;
+}
+
+std::unique_ptr<Geometry> tesselate( const Geometry& g, triangulate::TriangulationQuality quality )
+{
+    return tesselate( g, size_t( 1 ), quality );
+}
+
 } // namespace algorithm
 } // namespace SFCGAL
 
@@ -24,6 +24,7 @@
 #include <SFCGAL/config.h>
 
 #include <SFCGAL/Geometry.h>
+#include <SFCGAL/triangulate/triangulatePolygon.h>
 
 namespace SFCGAL {
 namespace algorithm {
@@ -46,6 +47,27 @@ SFCGAL_API std::unique_ptr<SFCGAL::Geometry> tesselate( const Geometry& );
  */
 SFCGAL_API std::unique_ptr<SFCGAL::Geometry> tesselate( const Geometry&, NoValidityCheck );
 
+/**
+ * Tesselate a geometry, the polygons being triangulated by several threads.
+ * The result is the same as with tesselate( g ).
+ * The threads work on copies of the polygons built from their exact coordinates, as
+ * polygons may share lazy exact numbers. g must not be used by an other thread meanwhile.
+ * @param numThreads number of threads (0 for the number of cores)
+ * @param quality triangulation strategy for polygons
+ * @pre g is a valid geometry
+ * @ingroup public_api
+ */
+SFCGAL_API std::unique_ptr<SFCGAL::Geometry> tesselate( const Geometry&, size_t numThreads,
+        triangulate::TriangulationQuality quality = triangulate::TRIANGULATION_DELAUNAY );
+
+/**
+ * Tesselate a geometry with a given triangulation strategy. TRIANGULATION_FAST
+ * avoids the constrained Delaunay triangulation of convex and small polygons.
+ * @pre g is a valid geometry
+ * @ingroup public_api
+ */
+SFCGAL_API std::unique_ptr<SFCGAL::Geometry> tesselate( const Geometry&, triangulate::TriangulationQuality quality );
+
 }//algorithm
 }//SFCGAL
 
@@ -23,9 +23,16 @@
 #include <SFCGAL/algorithm/union.h>
 #include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/triangulate/triangulate2DZ.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/detail/tools/ThreadPool.h>
+#include <SFCGAL/detail/detachedCopy.h>
 
 #include <cstdio>
+#include <cstdint>
+#include <limits>
 #include <algorithm>
+#include <utility>
 
 #define DEBUG_OUT if (0) std::cerr << __FILE__ << ":" << __LINE__ << " debug: "
 
@@ -982,6 +989,220 @@ std::unique_ptr<Geometry> union3D( const Geometry& ga, const Geometry& gb )
     return result;
 }
 
+namespace {
+
+// number of cells of the Hilbert grid along an axis
+const uint32_t HILBERT_SIZE = 1U << 16;
+
+///
+/// index of the cell (x,y) along the Hilbert curve filling the grid
+///
+uint64_t hilbertIndex( uint32_t x, uint32_t y )
+{
+    uint64_t d = 0;
+
+    for ( uint32_t s = HILBERT_SIZE / 2; s > 0; s /= 2 ) {
+        const uint32_t rx = ( x & s ) ? 1 : 0;
+        const uint32_t ry = ( y & s ) ? 1 : 0;
+        d += uint64_t( s ) * s * ( ( 3 * rx ) ^ ry );
+
+        // rotate the quadrant
+        if ( ry == 0 ) {
+            if ( rx == 1 ) {
+                x = HILBERT_SIZE - 1 - x;
+                y = HILBERT_SIZE - 1 - y;
+            }
+
+            std::swap( x, y );
+        }
+    }
+
+    return d;
+}
+
+///
+/// position of v in [min,max] on the Hilbert grid
+///
+uint32_t hilbertCell( const double& v, const double& min, const double& max )
+{
+    if ( !( max > min ) ) {
+        return 0;
+    }
+
+    const double cell = ( v - min ) / ( max - min ) * ( HILBERT_SIZE - 1 );
+    return static_cast<uint32_t>( std::min( std::max( cell, 0.0 ), double( HILBERT_SIZE - 1 ) ) );
+}
+
+///
+/// sort geometries along a Hilbert curve of their envelope centres (in the xy plane)
+///
+void hilbertSort( std::vector< const Geometry* >& geometries )
+{
+    std::vector< std::pair< double, double > > centres;
+    centres.reserve( geometries.size() );
+    double xMin = std::numeric_limits<double>::infinity();
+    double yMin = xMin;
+    double xMax = -xMin;
+    double yMax = -xMin;
+
+    for ( size_t i = 0; i < geometries.size(); ++i ) {
+        const Envelope box = geometries[i]->envelope();
+        const double x = ( box.xMin() + box.xMax() ) / 2;
+        const double y = ( box.yMin() + box.yMax() ) / 2;
+        centres.push_back( std::make_pair( x, y ) );
+        xMin = std::min( xMin, x );
+        yMin = std::min( yMin, y );
+        xMax = std::max( xMax, x );
+        yMax = std::max( yMax, y );
+    }
+
+    std::vector< std::pair< uint64_t, const Geometry* > > keys;
+    keys.reserve( geometries.size() );
+
+    for ( size_t i = 0; i < geometries.size(); ++i ) {
+        const uint32_t x = hilbertCell( centres[i].first, xMin, xMax );
+        const uint32_t y = hilbertCell( centres[i].second, yMin, yMax );
+        keys.push_back( std::make_pair( hilbertIndex( x, y ), geometries[i] ) );
+    }
+
+    std::stable_sort( keys.begin(), keys.end(),
+    []( const std::pair< uint64_t, const Geometry* >& a, const std::pair< uint64_t, const Geometry* >& b ) {
+        return a.first < b.first;
+    } );
+
+    for ( size_t i = 0; i < keys.size(); ++i ) {
+        geometries[i] = keys[i].second;
+    }
+}
+
+template <int Dim>
+std::unique_ptr<Geometry> unionPair( const Geometry& ga, const Geometry& gb );
+
+template <>
+std::unique_ptr<Geometry> unionPair<2>( const Geometry& ga, const Geometry& gb )
+{
+    return union_( ga, gb, NoValidityCheck() );
+}
+
+template <>
+std::unique_ptr<Geometry> unionPair<3>( const Geometry& ga, const Geometry& gb )
+{
+    return union3D( ga, gb, NoValidityCheck() );
+}
+
+// node of the reduction tree : an input member or the union of two nodes
+struct UnionNode {
+    const Geometry*           geometry;
+    std::unique_ptr<Geometry> owned;
+};
+
+///
+/// binary tree reduction of the members of g, one tree level at a time
+///
+template <int Dim>
+std::unique_ptr<Geometry> unionAllImpl( const Geometry& g, size_t numThreads )
+{
+    std::vector< const Geometry* > members;
+
+    for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+        if ( ! g.geometryN( i ).isEmpty() ) {
+            members.push_back( &g.geometryN( i ) );
+        }
+    }
+
+    if ( members.empty() ) {
+        return std::unique_ptr<Geometry>( new GeometryCollection() );
+    }
+
+    if ( members.size() == 1 ) {
+        // still recompose the member
+        return unionPair<Dim>( *members[0], GeometryCollection() );
+    }
+
+    hilbertSort( members );
+
+    tools::ThreadPool pool( numThreads );
+
+    std::vector< UnionNode > level( members.size() );
+
+    for ( size_t i = 0; i < members.size(); ++i ) {
+        // members may share lazy exact numbers (faces of an extruded geometry, clones),
+        // the threads work on detached copies
+        if ( pool.size() > 1 ) {
+            level[i].owned    = detail::detachedCopy( *members[i] );
+            level[i].geometry = level[i].owned.get();
+        }
+        else {
+            level[i].geometry = members[i];
+        }
+    }
+
+    while ( level.size() > 1 ) {
+        // neighbours along the curve are merged, an odd last node goes up unchanged
+        const size_t numPairs = level.size() / 2;
+        std::vector< UnionNode > next( numPairs );
+
+        pool.parallelFor( numPairs, [&level, &next]( size_t i ) {
+            next[i].owned    = unionPair<Dim>( *level[2 * i].geometry, *level[2 * i + 1].geometry );
+            next[i].geometry = next[i].owned.get();
+        } );
+
+        if ( level.size() % 2 ) {
+            next.push_back( std::move( level.back() ) );
+        }
+
+        level.swap( next );
+    }
+
+    return std::move( level.front().owned );
+}
+
+} // namespace
+
+///
+///
+///
+std::unique_ptr<Geometry> unionAll( const Geometry& g, NoValidityCheck, size_t numThreads )
+{
+    return unionAllImpl<2>( g, numThreads );
+}
+
+///
+///
+///
+std::unique_ptr<Geometry> unionAll( const Geometry& g, size_t numThreads )
+{
+    // members may overlap or share edges, so that the collection itself is not
+    // required to be valid (dissolving a MultiPolygon of adjacent polygons)
+    for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g.geometryN( i ) );
+    }
+
+    return unionAll( g, NoValidityCheck(), numThreads );
+}
+
+///
+///
+///
+std::unique_ptr<Geometry> unionAll3D( const Geometry& g, NoValidityCheck, size_t numThreads )
+{
+    return unionAllImpl<3>( g, numThreads );
+}
+
+///
+///
+///
+std::unique_ptr<Geometry> unionAll3D( const Geometry& g, size_t numThreads )
+{
+    // members may overlap or share edges, so that the collection itself is not
+    // required to be valid (dissolving a MultiPolygon of adjacent polygons)
+    for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( g.geometryN( i ) );
+    }
+
+    return unionAll3D( g, NoValidityCheck(), numThreads );
+}
+
 void handleLeakTest()
 {
     Handle<2> h0( Point_2( 0,0 ) );
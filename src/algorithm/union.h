@@ -23,6 +23,7 @@
 
 #include <SFCGAL/config.h>
 
+#include <cstddef>
 #include <memory>
 
 namespace SFCGAL {
@@ -65,6 +66,50 @@ SFCGAL_API std::unique_ptr<Geometry> union3D( const Geometry& ga, const Geometry
  */
 SFCGAL_API std::unique_ptr<Geometry> union3D( const Geometry& ga, const Geometry& gb, NoValidityCheck );
 
+/**
+ * Union of every member of a collection (GeometryCollection, MultiPolygon, etc.)
+ *
+ * Members are sorted along a Hilbert curve of their envelope centres and merged
+ * as a balanced binary tree, so that each union involves neighbouring geometries
+ * of similar size. Independent subtrees are merged in parallel.
+ *
+ * Members may overlap or share edges : only each member is required to be valid,
+ * so that a MultiPolygon of adjacent polygons can be dissolved.
+ *
+ * With several threads, the members are first copied from their exact coordinates,
+ * so that members sharing lazy exact numbers can be merged concurrently. g must not
+ * be used by an other thread during the call.
+ *
+ * @param numThreads number of threads (0 for std::thread::hardware_concurrency())
+ * @return an empty GeometryCollection if every member is empty
+ * @pre every member of g is a valid geometry
+ * @ingroup public_api
+ */
+SFCGAL_API std::unique_ptr<Geometry> unionAll( const Geometry& g, size_t numThreads = 1 );
+
+/**
+ * Union of every member of a collection. No validity check variant
+ * @pre every member of g is a valid geometry
+ * @ingroup detail
+ * @warning No actual validity check is done.
+ */
+SFCGAL_API std::unique_ptr<Geometry> unionAll( const Geometry& g, NoValidityCheck, size_t numThreads = 1 );
+
+/**
+ * Union of every member of a collection in 3D. Assume z = 0 if needed
+ * @pre every member of g is a valid geometry
+ * @ingroup public_api
+ */
+SFCGAL_API std::unique_ptr<Geometry> unionAll3D( const Geometry& g, size_t numThreads = 1 );
+
+/**
+ * Union of every member of a collection in 3D. No validity check variant
+ * @pre every member of g is a valid geometry
+ * @ingroup detail
+ * @warning No actual validity check is done.
+ */
+SFCGAL_API std::unique_ptr<Geometry> unionAll3D( const Geometry& g, NoValidityCheck, size_t numThreads = 1 );
+
 /**
  * @ingroup detail
  */
@@ -21,7 +21,8 @@
 
 #include <SFCGAL/algorithm/volume.h>
 #include <SFCGAL/algorithm/isValid.h>
-#include <SFCGAL/algorithm/tesselate.h>
+#include <SFCGAL/triangulate/triangulatePolygon.h>
+#include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/GeometryCollection.h>
 #include <SFCGAL/Solid.h>
 
@@ -35,8 +36,9 @@ const Kernel::FT volume( const Solid& solid, NoValidityCheck )
     const size_t numShells = solid.numShells();
 
     for ( size_t i=0; i<numShells; i++ ) {
-        std::unique_ptr<Geometry> t( tesselate( solid.shellN( i ), NoValidityCheck() ) );
-        const TriangulatedSurface& tin = t->as<TriangulatedSurface>();
+        // the volume does not depend on the triangulation of the faces
+        TriangulatedSurface tin;
+        triangulate::triangulatePolygon3D( solid.shellN( i ), tin, triangulate::TRIANGULATION_FAST );
         const size_t numTriangles = tin.numTriangles();
 
         for ( size_t j=0; j<numTriangles; j++ ) {
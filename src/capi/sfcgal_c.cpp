@@ -39,15 +39,19 @@
 #include <SFCGAL/io/wkt.h>
 #include <SFCGAL/io/ewkt.h>
 #include <SFCGAL/detail/io/Serialization.h>
+#include <SFCGAL/detail/io/FlatGeometry.h>
+#include <SFCGAL/detail/detachedCopy.h>
 
 #include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/covers.h>
 #include <SFCGAL/algorithm/intersection.h>
 #include <SFCGAL/algorithm/difference.h>
 #include <SFCGAL/algorithm/union.h>
 #include <SFCGAL/algorithm/convexHull.h>
 #include <SFCGAL/algorithm/distance.h>
 #include <SFCGAL/algorithm/distance3d.h>
+#include <SFCGAL/algorithm/dWithin.h>
 #include <SFCGAL/algorithm/plane.h>
 #include <SFCGAL/algorithm/volume.h>
 #include <SFCGAL/algorithm/area.h>
@@ -61,6 +65,15 @@
 #include <SFCGAL/detail/transform/ForceZOrderPoints.h>
 #include <SFCGAL/detail/transform/ForceOrderPoints.h>
 #include <SFCGAL/detail/transform/RoundTransform.h>
+#include <SFCGAL/detail/tools/ThreadPool.h>
+#include <SFCGAL/detail/SolidLocator.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <iterator>
+#include <string>
+#include <vector>
 
 //
 // Note about sfcgal_geometry_t pointers: they are basically void* pointers that represent
@@ -190,6 +203,51 @@ extern "C" int sfcgal_geometry_is_valid_detail( const sfcgal_geometry_t* geom, c
     return is_valid;
 }
 
+extern "C" int sfcgal_geometry_is_valid_parallel( const sfcgal_geometry_t* geom, int nthreads, int all_failures, char** invalidity_reason )
+{
+    if ( invalidity_reason )
+        *invalidity_reason = 0;
+
+    const SFCGAL::Geometry* g = reinterpret_cast<const SFCGAL::Geometry*>( geom );
+    if ( g->hasValidityFlag() )
+        return true;
+    bool is_valid = false;
+    try
+    {
+        SFCGAL::Validity validity = SFCGAL::algorithm::isValid( *g, 1e-9, nthreads > 0 ? size_t( nthreads ) : 0,
+                                    all_failures ? SFCGAL::algorithm::VALIDITY_REPORT_ALL : SFCGAL::algorithm::VALIDITY_REPORT_FIRST );
+        is_valid = validity;
+        if ( !is_valid && invalidity_reason ) {
+            *invalidity_reason = strdup( validity.reason().c_str() );
+        }
+    }
+    catch ( SFCGAL::Exception& e )
+    {
+        if ( invalidity_reason ) {
+            *invalidity_reason = strdup( e.what() );
+        }
+    }
+    return is_valid;
+}
+
+extern "C" void sfcgal_validity_cache_stats( size_t* hits, size_t* misses )
+{
+    const SFCGAL::algorithm::ValidityCacheStats stats = SFCGAL::algorithm::validityCacheStats();
+
+    if ( hits ) {
+        *hits = stats.hits;
+    }
+
+    if ( misses ) {
+        *misses = stats.misses;
+    }
+}
+
+extern "C" void sfcgal_validity_cache_reset_stats()
+{
+    SFCGAL::algorithm::resetValidityCacheStats();
+}
+
 extern "C" int sfcgal_geometry_is_3d( const sfcgal_geometry_t* geom )
 {
     SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR(
@@ -236,6 +294,33 @@ extern "C" void sfcgal_geometry_as_text_decim( const sfcgal_geometry_t* pgeom, i
     )
 }
 
+extern "C" int sfcgal_geometry_as_text_decim_into( const sfcgal_geometry_t* pgeom, int numDecimals, char* buffer, size_t cap, size_t* len )
+{
+    try {
+        // text buffer reused by the calls of a thread
+        static thread_local std::string wkt;
+        wkt.clear();
+        SFCGAL::io::writeWkt( *reinterpret_cast<const SFCGAL::Geometry*>( pgeom ), wkt, numDecimals );
+        *len = wkt.size();
+
+        if ( cap < wkt.size() + 1 ) {
+            return 0;
+        }
+
+        memcpy( buffer, wkt.c_str(), wkt.size() + 1 );
+        return 1;
+    }
+    catch ( std::exception& e ) {
+        SFCGAL_ERROR( "%s", e.what() );
+        return -1;
+    }
+}
+
+extern "C" int sfcgal_geometry_as_text_into( const sfcgal_geometry_t* pgeom, char* buffer, size_t cap, size_t* len )
+{
+    return sfcgal_geometry_as_text_decim_into( pgeom, -1, buffer, cap, len );
+}
+
 /**
  * Point
  */
@@ -643,11 +728,15 @@ extern "C" void sfcgal_io_write_binary_prepared( const sfcgal_prepared_geometry_
 
 extern "C" sfcgal_prepared_geometry_t* sfcgal_io_read_binary_prepared( const char* str, size_t len )
 {
-    std::string sstr( str, len );
     std::unique_ptr<SFCGAL::PreparedGeometry> g;
 
     try {
-        g = SFCGAL::io::readBinaryPrepared( sstr );
+        if ( SFCGAL::io::FlatGeometryView::isFlatGeometry( str, len ) ) {
+            g = SFCGAL::io::readFlatPrepared( str, len );
+        }
+        else {
+            g = SFCGAL::io::readBinaryPrepared( std::string( str, len ) );
+        }
     }
     catch ( std::exception& e ) {
         SFCGAL_WARNING( "During read_binary_prepared" );
@@ -658,6 +747,51 @@ extern "C" sfcgal_prepared_geometry_t* sfcgal_io_read_binary_prepared( const cha
     return g.release();
 }
 
+extern "C" void sfcgal_io_write_flat_geometry( const sfcgal_geometry_t* geom, char** buffer, size_t* len )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        const SFCGAL::Geometry* g = reinterpret_cast<const SFCGAL::Geometry*>( geom );
+        std::string str = SFCGAL::io::writeFlatGeometry( *g );
+        *buffer = ( char* )__sfcgal_alloc_handler( str.size() + 1 );
+        *len = str.size();
+        memcpy( *buffer, str.c_str(), *len );
+    )
+}
+
+extern "C" void sfcgal_io_write_flat_prepared( const sfcgal_prepared_geometry_t* geom, char** buffer, size_t* len )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        const SFCGAL::PreparedGeometry* g = reinterpret_cast<const SFCGAL::PreparedGeometry*>( geom );
+        std::string str = SFCGAL::io::writeFlatPrepared( *g );
+        *buffer = ( char* )__sfcgal_alloc_handler( str.size() + 1 );
+        *len = str.size();
+        memcpy( *buffer, str.c_str(), *len );
+    )
+}
+
+extern "C" sfcgal_geometry_t* sfcgal_io_read_flat_geometry( const char* str, size_t len )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR(
+        return SFCGAL::io::readFlatGeometry( str, len ).release();
+    )
+}
+
+extern "C" sfcgal_prepared_geometry_t* sfcgal_io_read_flat_prepared( const char* str, size_t len )
+{
+    std::unique_ptr<SFCGAL::PreparedGeometry> g;
+
+    try {
+        g = SFCGAL::io::readFlatPrepared( str, len );
+    }
+    catch ( std::exception& e ) {
+        SFCGAL_WARNING( "During read_flat_prepared" );
+        SFCGAL_ERROR( "%s", e.what() );
+        return 0;
+    }
+
+    return g.release();
+}
+
 extern "C" sfcgal_prepared_geometry_t* sfcgal_io_read_ewkt( const char* str, size_t len )
 {
     std::unique_ptr<SFCGAL::PreparedGeometry> g;
@@ -712,6 +846,85 @@ SFCGAL_GEOMETRY_FUNCTION_BINARY_PREDICATE( intersects_3d, SFCGAL::algorithm::int
 SFCGAL_GEOMETRY_FUNCTION_BINARY_MEASURE( distance, SFCGAL::algorithm::distance )
 SFCGAL_GEOMETRY_FUNCTION_BINARY_MEASURE( distance_3d, SFCGAL::algorithm::distance3D )
 
+#define SFCGAL_GEOMETRY_FUNCTION_BINARY_THRESHOLD_PREDICATE( name, sfcgal_function ) \
+	extern "C" int sfcgal_geometry_##name( const sfcgal_geometry_t* ga, const sfcgal_geometry_t* gb, double distance ) \
+	{								\
+		bool r;							\
+		try							\
+		{							\
+			r = sfcgal_function( *(const SFCGAL::Geometry*)(ga), *(const SFCGAL::Geometry*)(gb), distance ); \
+		}							\
+		catch ( std::exception& e )				\
+		{							\
+			SFCGAL_WARNING( "During " #name "(A,B,%g) :", distance ); \
+			SFCGAL_WARNING( "  with A: %s", ((const SFCGAL::Geometry*)(ga))->asText().c_str() ); \
+			SFCGAL_WARNING( "   and B: %s", ((const SFCGAL::Geometry*)(gb))->asText().c_str() ); \
+			SFCGAL_ERROR( "%s", e.what() );	\
+			return -1;					\
+		}							\
+		return r;					\
+	}
+
+SFCGAL_GEOMETRY_FUNCTION_BINARY_THRESHOLD_PREDICATE( dwithin, SFCGAL::algorithm::dWithin )
+SFCGAL_GEOMETRY_FUNCTION_BINARY_THRESHOLD_PREDICATE( dwithin_3d, SFCGAL::algorithm::dWithin3D )
+
+#define SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( name, sfcgal_function, ret_type, cpp_type, fail_value ) \
+	extern "C" ret_type sfcgal_prepared_geometry_##name( const sfcgal_prepared_geometry_t* pa, const sfcgal_geometry_t* gb ) \
+	{								\
+		cpp_type r;							\
+		const SFCGAL::PreparedGeometry* prepared = reinterpret_cast<const SFCGAL::PreparedGeometry*>( pa ); \
+		try							\
+		{							\
+			r = sfcgal_function( *prepared, *(const SFCGAL::Geometry*)(gb) ); \
+		}							\
+		catch ( std::exception& e )				\
+		{							\
+			SFCGAL_WARNING( "During prepared " #name "(A,B) :" ); \
+			SFCGAL_WARNING( "  with A: %s", prepared->geometry().asText().c_str() ); \
+			SFCGAL_WARNING( "   and B: %s", ((const SFCGAL::Geometry*)(gb))->asText().c_str() ); \
+			SFCGAL_ERROR( "%s", e.what() );	\
+			return fail_value;					\
+		}							\
+		return r;					\
+	}
+
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( intersects, SFCGAL::algorithm::intersects, int, bool, -1 )
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( intersects_3d, SFCGAL::algorithm::intersects3D, int, bool, -1 )
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( distance, SFCGAL::algorithm::distance, double, double, -1.0 )
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( distance_3d, SFCGAL::algorithm::distance3D, double, double, -1.0 )
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( covers, SFCGAL::algorithm::covers, int, bool, -1 )
+SFCGAL_PREPARED_GEOMETRY_FUNCTION_BINARY_SCALAR( covers_3d, SFCGAL::algorithm::covers3D, int, bool, -1 )
+
+extern "C" int sfcgal_prepared_geometry_locate_points_3d( const sfcgal_prepared_geometry_t* pa, const double* coordinates, size_t n, int* sides, int nthreads )
+{
+    const SFCGAL::PreparedGeometry* prepared = reinterpret_cast<const SFCGAL::PreparedGeometry*>( pa );
+
+    try {
+        std::vector< SFCGAL::Kernel::Point_3 > points;
+        points.reserve( n );
+
+        for ( size_t i = 0; i < n; i++ ) {
+            points.push_back( SFCGAL::Kernel::Point_3( coordinates[3 * i], coordinates[3 * i + 1], coordinates[3 * i + 2] ) );
+        }
+
+        std::vector< CGAL::Bounded_side > result;
+        result.reserve( n );
+        prepared->solidLocator().locate( points.begin(), points.end(), std::back_inserter( result ), size_t( nthreads > 0 ? nthreads : 0 ) );
+
+        for ( size_t i = 0; i < n; i++ ) {
+            sides[i] = int( result[i] );
+        }
+    }
+    catch ( std::exception& e ) {
+        SFCGAL_WARNING( "During prepared locate_points_3d(A) :" );
+        SFCGAL_WARNING( "  with A: %s", prepared->geometry().asText().c_str() );
+        SFCGAL_ERROR( "%s", e.what() );
+        return 0;
+    }
+
+    return 1;
+}
+
 
 #define SFCGAL_GEOMETRY_FUNCTION_BINARY_CONSTRUCTION( name, sfcgal_function ) \
 	extern "C" sfcgal_geometry_t* sfcgal_geometry_##name( const sfcgal_geometry_t* ga, const sfcgal_geometry_t* gb ) \
@@ -763,6 +976,23 @@ SFCGAL_GEOMETRY_FUNCTION_UNARY_CONSTRUCTION( straight_skeleton, SFCGAL::algorith
 SFCGAL_GEOMETRY_FUNCTION_UNARY_CONSTRUCTION( approximate_medial_axis, SFCGAL::algorithm::approximateMedialAxis )
 SFCGAL_GEOMETRY_FUNCTION_UNARY_CONSTRUCTION( tesselate, SFCGAL::algorithm::tesselate )
 
+extern "C" sfcgal_geometry_t* sfcgal_geometry_tesselate_parallel( const sfcgal_geometry_t* ga, int nthreads )
+{
+    std::unique_ptr<SFCGAL::Geometry> result;
+
+    try {
+        result = SFCGAL::algorithm::tesselate( *( const SFCGAL::Geometry* )( ga ), size_t( nthreads > 0 ? nthreads : 0 ) );
+    }
+    catch ( std::exception& e ) {
+        SFCGAL_WARNING( "During tesselate_parallel(A) :" );
+        SFCGAL_WARNING( "  with A: %s", ( ( const SFCGAL::Geometry* )( ga ) )->asText().c_str() );
+        SFCGAL_ERROR( "%s", e.what() );
+        return 0;
+    }
+
+    return result.release();
+}
+
 #define SFCGAL_GEOMETRY_FUNCTION_UNARY_MEASURE( name, sfcgal_function ) \
 	extern "C" double sfcgal_geometry_##name( const sfcgal_geometry_t* ga ) \
 	{								\
@@ -1013,6 +1243,42 @@ extern "C" sfcgal_geometry_t* sfcgal_geometry_offset_polygon( const sfcgal_geome
     return mp.release();
 }
 
+extern "C" sfcgal_geometry_t* sfcgal_geometry_union_all( const sfcgal_geometry_t* geom, int nthreads )
+{
+    const SFCGAL::Geometry* g = reinterpret_cast<const SFCGAL::Geometry*>( geom );
+    std::unique_ptr<SFCGAL::Geometry> result;
+
+    try {
+        result = SFCGAL::algorithm::unionAll( *g, nthreads > 0 ? size_t( nthreads ) : 0 );
+    }
+    catch ( std::exception& e ) {
+        SFCGAL_WARNING( "During union_all(A):" );
+        SFCGAL_WARNING( "  with A: %s", g->asText().c_str() );
+        SFCGAL_ERROR( "%s", e.what() );
+        return 0;
+    }
+
+    return result.release();
+}
+
+extern "C" sfcgal_geometry_t* sfcgal_geometry_union_all_3d( const sfcgal_geometry_t* geom, int nthreads )
+{
+    const SFCGAL::Geometry* g = reinterpret_cast<const SFCGAL::Geometry*>( geom );
+    std::unique_ptr<SFCGAL::Geometry> result;
+
+    try {
+        result = SFCGAL::algorithm::unionAll3D( *g, nthreads > 0 ? size_t( nthreads ) : 0 );
+    }
+    catch ( std::exception& e ) {
+        SFCGAL_WARNING( "During union_all_3d(A):" );
+        SFCGAL_WARNING( "  with A: %s", g->asText().c_str() );
+        SFCGAL_ERROR( "%s", e.what() );
+        return 0;
+    }
+
+    return result.release();
+}
+
 extern "C" void sfcgal_geometry_force_valid( sfcgal_geometry_t* geom, int valid )
 {
     SFCGAL::Geometry* g1 = reinterpret_cast<SFCGAL::Geometry*>( geom );
@@ -1042,3 +1308,303 @@ extern "C" sfcgal_geometry_t* sfcgal_geometry_straight_skeleton_distance_in_m( c
 
     return mls.release();
 }
+
+//
+// Batch processing
+
+namespace {
+
+//
+// Settings, threads and per item errors of batch calls (sfcgal_batch_context_t)
+struct BatchContext {
+    bool                                        validation;
+    std::vector< std::string >                  errors;
+    std::vector< char >                         failed;
+    std::unique_ptr< SFCGAL::tools::ThreadPool > pool;
+
+    BatchContext() : validation( true ) {}
+
+    SFCGAL::tools::ThreadPool& threadPool( int nthreads ) {
+        const size_t size = nthreads > 0 ? size_t( nthreads ) : 0;
+
+        // the pool is kept between calls with the same number of threads
+        if ( ! pool || ( size != 0 && pool->size() != size ) ) {
+            pool.reset( new SFCGAL::tools::ThreadPool( size ) );
+        }
+
+        return *pool;
+    }
+};
+
+//
+// Process wide pool of the batch calls without context, one per number of threads.
+// Pools are created on first use and kept until exit.
+struct DefaultPool {
+    std::mutex                                   busy;
+    std::unique_ptr< SFCGAL::tools::ThreadPool > pool;
+};
+
+DefaultPool& defaultPool( int nthreads )
+{
+    static std::mutex mutex;
+    static std::map< size_t, std::unique_ptr< DefaultPool > > pools;
+
+    const size_t size = nthreads > 0 ? size_t( nthreads ) : 0;
+    std::lock_guard< std::mutex > lock( mutex );
+    std::unique_ptr< DefaultPool >& entry = pools[size];
+
+    if ( ! entry ) {
+        entry.reset( new DefaultPool() );
+        entry->pool.reset( new SFCGAL::tools::ThreadPool( size ) );
+    }
+
+    return *entry;
+}
+
+//
+// Detached copies of the input geometries of a batch call, so that items can run
+// concurrently whatever the inputs share (a geometry used by several items, clones...).
+// Copies are built once, before the items run. A geometry used by k items has k copies,
+// or one per thread of the pool if there are fewer threads, then a task uses the copies
+// of the slot it holds.
+class BatchInputs {
+public:
+    BatchInputs( const sfcgal_geometry_t* const* a, const sfcgal_geometry_t* const* b, size_t n, size_t numSlots ) :
+        _perSlot( false ) {
+        const sfcgal_geometry_t* const* inputs[2] = { a, b };
+        const size_t arity = b ? 2 : 1;
+
+        for ( size_t i = 0; i < n; i++ ) {
+            for ( size_t j = 0; j < arity; j++ ) {
+                ++_inputs[ reinterpret_cast< const SFCGAL::Geometry* >( inputs[j][i] ) ].uses;
+            }
+        }
+
+        for ( std::map< const SFCGAL::Geometry*, Input >::iterator it = _inputs.begin(); it != _inputs.end(); ++it ) {
+            Input& input = it->second;
+            input.perSlot = input.uses > numSlots;
+            _perSlot = _perSlot || input.perSlot;
+
+            for ( size_t k = 0; k < ( input.perSlot ? numSlots : input.uses ); k++ ) {
+                input.copies.push_back( SFCGAL::detail::detachedCopy( *it->first ) );
+            }
+        }
+
+        _items.resize( 2 * n );
+
+        for ( size_t i = 0; i < n; i++ ) {
+            for ( size_t j = 0; j < arity; j++ ) {
+                Input& input = _inputs[ reinterpret_cast< const SFCGAL::Geometry* >( inputs[j][i] ) ];
+                _items[2 * i + j] = std::make_pair( &input, input.perSlot ? 0 : input.nextUse++ );
+            }
+        }
+    }
+
+    // true if some copies are shared by the items run with the same slot
+    bool perSlot() const {
+        return _perSlot;
+    }
+
+    // input j (0 for a, 1 for b) of item i, seen by a task holding the given slot
+    const SFCGAL::Geometry& get( size_t i, size_t j, size_t slot ) const {
+        const std::pair< const Input*, size_t >& item = _items[2 * i + j];
+        return *item.first->copies[ item.first->perSlot ? slot : item.second ];
+    }
+
+private:
+    struct Input {
+        size_t                                              uses;
+        size_t                                              nextUse;
+        bool                                                perSlot;
+        std::vector< std::unique_ptr< SFCGAL::Geometry > > copies;
+
+        Input() : uses( 0 ), nextUse( 0 ), perSlot( false ) {}
+    };
+
+    std::map< const SFCGAL::Geometry*, Input >           _inputs;
+    std::vector< std::pair< const Input*, size_t > >    _items;
+    bool                                                 _perSlot;
+};
+
+//
+// inputs of an item, as seen by the task running it
+struct BatchItem {
+    const BatchInputs& inputs;
+    size_t             i;
+    size_t             slot;
+
+    const SFCGAL::Geometry& a() const {
+        return inputs.get( i, 0, slot );
+    }
+    const SFCGAL::Geometry& b() const {
+        return inputs.get( i, 1, slot );
+    }
+};
+
+//
+// out[i] = f( item i, validation ) for i in [0,n), failValue and a message on failure.
+// b is NULL for unary functions.
+template <class T, class F>
+size_t runBatch( sfcgal_batch_context_t* ctx, const sfcgal_geometry_t* const* a, const sfcgal_geometry_t* const* b,
+                 size_t n, T* out, const T& failValue, int nthreads, F f )
+{
+    BatchContext defaultContext;
+    BatchContext& context = ctx ? *reinterpret_cast< BatchContext* >( ctx ) : defaultContext;
+
+    context.errors.assign( n, std::string() );
+    context.failed.assign( n, 0 );
+
+    std::atomic< size_t > numFailures( 0 );
+    const bool validation = context.validation;
+
+    // without context, the process wide pool is used unless another thread is
+    // running a batch on it (a pool runs one loop at a time)
+    std::unique_lock< std::mutex > busy;
+    SFCGAL::tools::ThreadPool* pool = NULL;
+
+    if ( ctx ) {
+        pool = &context.threadPool( nthreads );
+    }
+    else {
+        DefaultPool& shared = defaultPool( nthreads );
+        busy = std::unique_lock< std::mutex >( shared.busy, std::try_to_lock );
+
+        if ( busy.owns_lock() ) {
+            pool = shared.pool.get();
+        }
+        else {
+            pool = &context.threadPool( nthreads );
+        }
+    }
+
+    const BatchInputs inputs( a, b, n, pool->size() );
+
+    // at most one task per thread runs at once, a slot is always free
+    std::mutex slotsMutex;
+    std::vector< size_t > freeSlots;
+
+    for ( size_t i = 0; i < pool->size(); i++ ) {
+        freeSlots.push_back( i );
+    }
+
+    pool->parallelFor( n, [&]( size_t i ) {
+        size_t slot = 0;
+
+        if ( inputs.perSlot() ) {
+            std::lock_guard< std::mutex > lock( slotsMutex );
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        }
+
+        try {
+            const BatchItem item = { inputs, i, slot };
+            out[i] = f( item, validation );
+        }
+        catch ( std::exception& e ) {
+            out[i] = failValue;
+            context.errors[i] = e.what();
+            context.failed[i] = 1;
+            ++numFailures;
+        }
+        catch ( ... ) {
+            out[i] = failValue;
+            context.errors[i] = "unknown error";
+            context.failed[i] = 1;
+            ++numFailures;
+        }
+
+        if ( inputs.perSlot() ) {
+            std::lock_guard< std::mutex > lock( slotsMutex );
+            freeSlots.push_back( slot );
+        }
+    } );
+
+    return numFailures;
+}
+
+//
+// result of an item, detached from the copies of the inputs which may be shared
+// with the results of other items
+inline sfcgal_geometry_t* batchResult( std::unique_ptr< SFCGAL::Geometry > result )
+{
+    SFCGAL::detail::detach( *result );
+    return result.release();
+}
+
+} // namespace
+
+extern "C" sfcgal_batch_context_t* sfcgal_batch_context_create()
+{
+    return new BatchContext();
+}
+
+extern "C" void sfcgal_batch_context_delete( sfcgal_batch_context_t* context )
+{
+    delete reinterpret_cast< BatchContext* >( context );
+}
+
+extern "C" void sfcgal_batch_context_set_geometry_validation( sfcgal_batch_context_t* context, int enabled )
+{
+    reinterpret_cast< BatchContext* >( context )->validation = ( enabled != 0 );
+}
+
+extern "C" const char* sfcgal_batch_context_error( const sfcgal_batch_context_t* context, size_t i )
+{
+    const BatchContext* c = reinterpret_cast< const BatchContext* >( context );
+
+    if ( i >= c->failed.size() || ! c->failed[i] ) {
+        return 0;
+    }
+
+    return c->errors[i].c_str();
+}
+
+extern "C" size_t sfcgal_geometry_intersects_batch( sfcgal_batch_context_t* context,
+        const sfcgal_geometry_t* const* a, const sfcgal_geometry_t* const* b, size_t n, int* out, int nthreads )
+{
+    return runBatch( context, a, b, n, out, -1, nthreads, []( const BatchItem & item, bool validation ) -> int {
+        return validation
+        ? SFCGAL::algorithm::intersects( item.a(), item.b() )
+        : SFCGAL::algorithm::intersects( item.a(), item.b(), SFCGAL::algorithm::NoValidityCheck() );
+    } );
+}
+
+extern "C" size_t sfcgal_geometry_distance_batch( sfcgal_batch_context_t* context,
+        const sfcgal_geometry_t* const* a, const sfcgal_geometry_t* const* b, size_t n, double* out, int nthreads )
+{
+    return runBatch( context, a, b, n, out, -1.0, nthreads, []( const BatchItem & item, bool validation ) {
+        return validation
+        ? SFCGAL::algorithm::distance( item.a(), item.b() )
+        : SFCGAL::algorithm::distance( item.a(), item.b(), SFCGAL::algorithm::NoValidityCheck() );
+    } );
+}
+
+extern "C" size_t sfcgal_geometry_area_batch( sfcgal_batch_context_t* context,
+        const sfcgal_geometry_t* const* a, size_t n, double* out, int nthreads )
+{
+    return runBatch( context, a, ( const sfcgal_geometry_t* const* )0, n, out, -1.0, nthreads, []( const BatchItem & item, bool validation ) {
+        return validation
+        ? SFCGAL::algorithm::area( item.a() )
+        : SFCGAL::algorithm::area( item.a(), SFCGAL::algorithm::NoValidityCheck() );
+    } );
+}
+
+extern "C" size_t sfcgal_geometry_intersection_batch( sfcgal_batch_context_t* context,
+        const sfcgal_geometry_t* const* a, const sfcgal_geometry_t* const* b, size_t n, sfcgal_geometry_t** out, int nthreads )
+{
+    return runBatch( context, a, b, n, out, ( sfcgal_geometry_t* )0, nthreads, []( const BatchItem & item, bool validation ) {
+        return batchResult( validation
+                            ? SFCGAL::algorithm::intersection( item.a(), item.b() )
+                            : SFCGAL::algorithm::intersection( item.a(), item.b(), SFCGAL::algorithm::NoValidityCheck() ) );
+    } );
+}
+
+extern "C" size_t sfcgal_geometry_union_batch( sfcgal_batch_context_t* context,
+        const sfcgal_geometry_t* const* a, const sfcgal_geometry_t* const* b, size_t n, sfcgal_geometry_t** out, int nthreads )
+{
+    return runBatch( context, a, b, n, out, ( sfcgal_geometry_t* )0, nthreads, []( const BatchItem & item, bool validation ) {
+        return batchResult( validation
+                            ? SFCGAL::algorithm::union_( item.a(), item.b() )
+                            : SFCGAL::algorithm::union_( item.a(), item.b(), SFCGAL::algorithm::NoValidityCheck() ) );
+    } );
+}
@@ -107,6 +107,32 @@ SFCGAL_API int                       sfcgal_geometry_is_valid( const sfcgal_geom
  */
 SFCGAL_API int                       sfcgal_geometry_is_valid_detail( const sfcgal_geometry_t* geom, char** invalidity_reason, sfcgal_geometry_t** invalidity_location );
 
+/**
+ * Tests if the given geometry is valid or not, the members of collections, the polygons of
+ * surfaces and the shells of solids being checked with nthreads threads (the number of cores if nthreads <= 0)
+ * @param geom the input geometry
+ * @param nthreads number of threads
+ * @param all_failures if non zero, the reason lists every invalid part instead of the first one
+ * @param invalidity_reason input/output parameter. If non null, a null-terminated string could be allocated and contain reason of the invalidity
+ * @warning geom must not be used by another thread during the call (parts of geom are read
+ * concurrently and the exact numbers they share with its copies are not thread safe)
+ * @ingroup capi
+ */
+SFCGAL_API int                       sfcgal_geometry_is_valid_parallel( const sfcgal_geometry_t* geom, int nthreads, int all_failures, char** invalidity_reason );
+
+/**
+ * Returns the counters of the validity cache : the number of validity checks of the inputs
+ * of functions skipped because the geometry was already checked (hits) and run (misses)
+ * @ingroup capi
+ */
+SFCGAL_API void                      sfcgal_validity_cache_stats( size_t* hits, size_t* misses );
+
+/**
+ * Resets the counters of the validity cache
+ * @ingroup capi
+ */
+SFCGAL_API void                      sfcgal_validity_cache_reset_stats();
+
 /**
  * Tests if the given geometry is 3D or not
  * @ingroup capi
@@ -149,6 +175,25 @@ SFCGAL_API void                      sfcgal_geometry_as_text( const sfcgal_geome
  */
 SFCGAL_API void                      sfcgal_geometry_as_text_decim( const sfcgal_geometry_t*, int numDecimals, char** buffer, size_t* len );
 
+/**
+ * Writes the WKT representation of the given geometry (see sfcgal_geometry_as_text) into a
+ * buffer owned by the caller, as a null-terminated string
+ * @param buffer output buffer
+ * @param cap capacity of buffer
+ * @param len output parameter, length of the WKT (terminating null character excluded)
+ * @return 1 on success, 0 if cap is lower than len + 1 (buffer is then left unchanged), -1 on error
+ * @ingroup capi
+ */
+SFCGAL_API int                       sfcgal_geometry_as_text_into( const sfcgal_geometry_t*, char* buffer, size_t cap, size_t* len );
+
+/**
+ * Writes the WKT representation of the given geometry (see sfcgal_geometry_as_text_decim) into a
+ * buffer owned by the caller, as a null-terminated string
+ * @return 1 on success, 0 if cap is lower than len + 1 (buffer is then left unchanged), -1 on error
+ * @ingroup capi
+ */
+SFCGAL_API int                       sfcgal_geometry_as_text_decim_into( const sfcgal_geometry_t*, int numDecimals, char* buffer, size_t cap, size_t* len );
+
 /**
  * Creates an empty point
  * @ingroup capi
@@ -557,6 +602,73 @@ SFCGAL_API void                        sfcgal_prepared_geometry_set_srid( sfcgal
  */
 SFCGAL_API void                        sfcgal_prepared_geometry_as_ewkt( const sfcgal_prepared_geometry_t* prepared, int num_decimals, char** buffer, size_t* len );
 
+/**
+ * Tests the intersection of the geometry of prepared and geom. Spatial indexes of prepared are
+ * built on first use and reused by the next calls.
+ * @pre prepared must be a PreparedGeometry
+ * @pre isValid(geometry of prepared) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_prepared_geometry_intersects( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Tests the 3D intersection of the geometry of prepared and geom, using the indexes of prepared
+ * @pre prepared must be a PreparedGeometry
+ * @pre isValid(geometry of prepared) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_prepared_geometry_intersects_3d( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Computes the distance between the geometry of prepared and geom, using the indexes of prepared
+ * @pre prepared must be a PreparedGeometry
+ * @pre isValid(geometry of prepared) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API double                      sfcgal_prepared_geometry_distance( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Computes the 3D distance between the geometry of prepared and geom, using the indexes of prepared
+ * @pre prepared must be a PreparedGeometry
+ * @pre isValid(geometry of prepared) == true
+ * @pre isValid(geom) == true
+ * @ingroup capi
+ */
+SFCGAL_API double                      sfcgal_prepared_geometry_distance_3d( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Tests if the geometry of prepared covers geom, using the indexes of prepared
+ * @pre prepared must be a PreparedGeometry
+ * @pre isValid(geometry of prepared) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_prepared_geometry_covers( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Tests if the geometry of prepared covers geom in 3D, using the indexes of prepared
+ * @pre prepared must be a PreparedGeometry
+ * @pre isValid(geometry of prepared) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_prepared_geometry_covers_3d( const sfcgal_prepared_geometry_t* prepared, const sfcgal_geometry_t* geom );
+
+/**
+ * Locates n 3D points relative to the solids of the geometry of prepared. The point
+ * locator is built on first use and kept with the other indexes of prepared.
+ * @param coordinates x, y and z of each point (3 * n values)
+ * @param sides for each point, 1 if it is inside a solid, 0 if it is on a boundary, -1 otherwise
+ * @param nthreads number of threads (the number of cores if nthreads <= 0)
+ * @return 1 on success, 0 on error
+ * @pre prepared must be a PreparedGeometry
+ * @pre isValid(geometry of prepared) == true
+ * @warning the geometry of prepared must not be used by another thread during the call
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_prepared_geometry_locate_points_3d( const sfcgal_prepared_geometry_t* prepared, const double* coordinates, size_t n, int* sides, int nthreads );
+
 /*--------------------------------------------------------------------------------------*
  *
  * I/O functions
@@ -574,8 +686,19 @@ SFCGAL_API sfcgal_prepared_geometry_t* sfcgal_io_read_ewkt( const char*, size_t
  */
 /* allocates into char**, must be freed by the caller */
 SFCGAL_API void                        sfcgal_io_write_binary_prepared( const sfcgal_prepared_geometry_t*, char**, size_t* );
+/* also reads the flat binary layout written by sfcgal_io_write_flat_prepared */
 SFCGAL_API sfcgal_prepared_geometry_t* sfcgal_io_read_binary_prepared( const char*, size_t l );
 
+/**
+ * Flat binary layout (see io::writeFlatGeometry). It can be read in place from
+ * a memory mapped file or a database page, without any alignment requirement.
+ */
+/* allocates into char**, must be freed by the caller */
+SFCGAL_API void                        sfcgal_io_write_flat_geometry( const sfcgal_geometry_t*, char**, size_t* );
+SFCGAL_API void                        sfcgal_io_write_flat_prepared( const sfcgal_prepared_geometry_t*, char**, size_t* );
+SFCGAL_API sfcgal_geometry_t*          sfcgal_io_read_flat_geometry( const char*, size_t l );
+SFCGAL_API sfcgal_prepared_geometry_t* sfcgal_io_read_flat_prepared( const char*, size_t l );
+
 /*--------------------------------------------------------------------------------------*
  *
  * Spatial processing
@@ -652,6 +775,24 @@ SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_union( const sfcgal_geome
  */
 SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_union_3d( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2 );
 
+/**
+ * Returns the union of every member of geom (a collection) with nthreads threads
+ * (the number of cores if nthreads <= 0). Members may overlap or share edges.
+ * @pre every member of geom is valid
+ * @post isValid(return) == true
+ * @ingroup capi
+ */
+SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_union_all( const sfcgal_geometry_t* geom, int nthreads );
+
+/**
+ * Returns the 3D union of every member of geom (a collection) with nthreads threads
+ * (the number of cores if nthreads <= 0). Members may overlap or share edges.
+ * @pre every member of geom is valid
+ * @post isValid(return) == true
+ * @ingroup capi
+ */
+SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_union_all_3d( const sfcgal_geometry_t* geom, int nthreads );
+
 /**
  * Returns the convex hull of geom
  * @pre isValid(geom) == true
@@ -715,6 +856,17 @@ SFCGAL_API int                         sfcgal_geometry_orientation( const sfcgal
  */
 SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_tesselate( const sfcgal_geometry_t* geom );
 
+/**
+ * Returns a tesselation of the given Geometry, the polygons being triangulated by
+ * nthreads threads (the number of cores if nthreads <= 0). Same result as sfcgal_geometry_tesselate.
+ * @pre isValid(geom) == true
+ * @post isValid(return) == true
+ * @warning geom must not be used by another thread during the call (parts of geom are read
+ * concurrently and the exact numbers they share with its copies are not thread safe)
+ * @ingroup capi
+ */
+SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_tesselate_parallel( const sfcgal_geometry_t* geom, int nthreads );
+
 /**
  * Returns a triangulation of the given Geometry
  * @pre isValid(geom) == true
@@ -771,6 +923,22 @@ SFCGAL_API double                      sfcgal_geometry_distance( const sfcgal_ge
  */
 SFCGAL_API double                      sfcgal_geometry_distance_3d( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2 );
 
+/**
+ * Tests if the distance between the two given Geometry objects is lower or equal to distance
+ * @pre isValid(geom1) == true
+ * @pre isValid(geom2) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_geometry_dwithin( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2, double distance );
+
+/**
+ * Tests if the 3D distance between the two given Geometry objects is lower or equal to distance
+ * @pre isValid(geom1) == true
+ * @pre isValid(geom2) == true
+ * @ingroup capi
+ */
+SFCGAL_API int                         sfcgal_geometry_dwithin_3d( const sfcgal_geometry_t* geom1, const sfcgal_geometry_t* geom2, double distance );
+
 /**
  * Round coordinates of the given Geometry
  * @pre isValid(geom) == true
@@ -820,6 +988,106 @@ SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_straight_skeleton_distanc
  */
 SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_approximate_medial_axis( const sfcgal_geometry_t* geom );
 
+/*--------------------------------------------------------------------------------------*
+ *
+ * Batch processing
+ *
+ *--------------------------------------------------------------------------------------*/
+
+/**
+ * Opaque pointer type on a batch context. A context holds the settings of the batch
+ * functions (geometry validation), the threads they use and the errors of the last
+ * batch call. It is used instead of the global error handlers and validation flag,
+ * so that several threads (database workers for instance) can run batches at the
+ * same time with a context each.
+ *
+ * A context must not be used by two batch calls at the same time.
+ * @ingroup capi
+ */
+typedef void sfcgal_batch_context_t;
+
+/**
+ * Creates a batch context, with geometry validation enabled
+ * @ingroup capi
+ */
+SFCGAL_API sfcgal_batch_context_t*     sfcgal_batch_context_create();
+
+/**
+ * Deletes a batch context and stops its threads
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_batch_context_delete( sfcgal_batch_context_t* context );
+
+/**
+ * Enables or disables the validity check of input geometries for the batch calls using context
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_batch_context_set_geometry_validation( sfcgal_batch_context_t* context, int enabled );
+
+/**
+ * Returns the error message of the i-th item of the last batch call using context,
+ * NULL if the item succeeded. The message is owned by the context and is valid
+ * until its next batch call.
+ * @ingroup capi
+ */
+SFCGAL_API const char*                 sfcgal_batch_context_error( const sfcgal_batch_context_t* context, size_t i );
+
+/*
+ * Batch functions compute out[i] = f( a[i], b[i] ) for i in [0,n) with nthreads threads
+ * (the number of cores if nthreads <= 0). They never call the error handlers : a failing
+ * item gets the failure value of the corresponding single call (-1, -1.0 or NULL) and
+ * its message is kept in context, which may be NULL if messages are not needed.
+ *
+ * They return the number of failing items. Without context, they share a process wide
+ * pool of threads created on first use.
+ *
+ * Input geometries are only read. A geometry may be used by several items (one geometry
+ * against many) and geometries may be clones of each other : items work on copies of
+ * the inputs which share no exact number, built before the items run. Inputs must not
+ * be used by another thread during the call, and the returned geometries share no
+ * number with the inputs nor with each other.
+ */
+
+/**
+ * Intersection test on n pairs of geometries
+ * @warning inputs must not be used by another thread during the call
+ * @ingroup capi
+ */
+SFCGAL_API size_t sfcgal_geometry_intersects_batch( sfcgal_batch_context_t* context,
+        const sfcgal_geometry_t* const* a, const sfcgal_geometry_t* const* b, size_t n, int* out, int nthreads );
+
+/**
+ * Distance between n pairs of geometries
+ * @warning inputs must not be used by another thread during the call
+ * @ingroup capi
+ */
+SFCGAL_API size_t sfcgal_geometry_distance_batch( sfcgal_batch_context_t* context,
+        const sfcgal_geometry_t* const* a, const sfcgal_geometry_t* const* b, size_t n, double* out, int nthreads );
+
+/**
+ * Area of n geometries
+ * @warning inputs must not be used by another thread during the call
+ * @ingroup capi
+ */
+SFCGAL_API size_t sfcgal_geometry_area_batch( sfcgal_batch_context_t* context,
+        const sfcgal_geometry_t* const* a, size_t n, double* out, int nthreads );
+
+/**
+ * Intersection of n pairs of geometries, out[i] is a new geometry owned by the caller
+ * @warning inputs must not be used by another thread during the call
+ * @ingroup capi
+ */
+SFCGAL_API size_t sfcgal_geometry_intersection_batch( sfcgal_batch_context_t* context,
+        const sfcgal_geometry_t* const* a, const sfcgal_geometry_t* const* b, size_t n, sfcgal_geometry_t** out, int nthreads );
+
+/**
+ * Union of n pairs of geometries, out[i] is a new geometry owned by the caller
+ * @warning inputs must not be used by another thread during the call
+ * @ingroup capi
+ */
+SFCGAL_API size_t sfcgal_geometry_union_batch( sfcgal_batch_context_t* context,
+        const sfcgal_geometry_t* const* a, const sfcgal_geometry_t* const* b, size_t n, sfcgal_geometry_t** out, int nthreads );
+
 /*--------------------------------------------------------------------------------------*
  *
  * Error handling
@@ -0,0 +1,267 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/ApproximateLineString.h>
+#include <SFCGAL/detail/CompensatedSum.h>
+#include <SFCGAL/detail/CoordinateBuffer.h>
+
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Triangle.h>
+
+#include <cmath>
+
+namespace SFCGAL {
+namespace detail {
+
+namespace {
+
+/**
+ * A vertex translated so that the first vertex of the ring is the origin
+ */
+struct TranslatedVertex {
+    double x ;
+    double y ;
+    double rx ;
+    double ry ;
+};
+
+/**
+ * d = v - origin with a bound rd on the distance to the exact difference
+ * (the rounding error is given by TwoSum)
+ */
+inline void translate( const double& v, const double& r, const double& origin, const double& rOrigin, double& d, double& rd )
+{
+    d = v - origin ;
+    const double bp = d - v ;
+    const double e = ( v - ( d - bp ) ) + ( - origin - bp ) ;
+    rd = r + rOrigin + std::abs( e ) ;
+}
+
+inline TranslatedVertex translatedVertex(
+    const std::vector< double >& x, const std::vector< double >& rx,
+    const std::vector< double >& y, const std::vector< double >& ry,
+    const size_t& k
+)
+{
+    TranslatedVertex result = { 0.0, 0.0, 0.0, 0.0 };
+
+    // the first vertex is exactly the origin
+    if ( k != 0 ) {
+        translate( x[k], rx[k], x[0], rx[0], result.x, result.rx );
+        translate( y[k], ry[k], y[0], ry[0], result.y, result.ry );
+    }
+
+    return result ;
+}
+
+} // namespace
+
+///
+///
+///
+ApproximateLineString::ApproximateLineString()
+{
+
+}
+
+///
+///
+///
+bool ApproximateLineString::assign( const LineString& ls, const int& dimension )
+{
+    _clear();
+
+    if ( ls.isCompact() ) {
+        const CoordinateBuffer& buffer = *ls.coordinates() ;
+        _coordinates[0] = buffer.xs() ;
+        _coordinates[1] = buffer.ys() ;
+
+        if ( dimension == 3 ) {
+            _coordinates[2] = buffer.is3D() ? buffer.zs() : std::vector< double >( buffer.size(), 0.0 ) ;
+        }
+
+        for ( int i = 0; i < dimension; i++ ) {
+            _radius[i].assign( buffer.size(), 0.0 );
+        }
+
+        return true ;
+    }
+
+    for ( size_t k = 0; k < ls.numPoints(); k++ ) {
+        const Point& p = ls.pointN( k ) ;
+
+        if ( p.isEmpty() || ! _push_back( p.x(), 0 ) || ! _push_back( p.y(), 1 ) ) {
+            return false ;
+        }
+
+        if ( dimension == 3 && ! _push_back( p.z(), 2 ) ) {
+            return false ;
+        }
+    }
+
+    return true ;
+}
+
+///
+///
+///
+bool ApproximateLineString::assign( const Triangle& triangle, const int& dimension )
+{
+    _clear();
+
+    for ( int k = 0; k < 4; k++ ) {
+        const Point& p = triangle.vertex( k % 3 ) ;
+
+        if ( p.isEmpty() || ! _push_back( p.x(), 0 ) || ! _push_back( p.y(), 1 ) ) {
+            return false ;
+        }
+
+        if ( dimension == 3 && ! _push_back( p.z(), 2 ) ) {
+            return false ;
+        }
+    }
+
+    return true ;
+}
+
+///
+///
+///
+bool ApproximateLineString::signedArea( const int& i, const int& j, double& area, double& bound ) const
+{
+    const std::vector< double >& x  = _coordinates[i] ;
+    const std::vector< double >& y  = _coordinates[j] ;
+    const std::vector< double >& rx = _radius[i] ;
+    const std::vector< double >& ry = _radius[j] ;
+    const size_t n = x.size() ;
+
+    area  = 0.0 ;
+    bound = 0.0 ;
+
+    if ( n < 3 ) {
+        return true ;
+    }
+
+    /*
+     * shoelace formula 2.A = sum( x[k].y[k+1] - x[k+1].y[k] ), relative to the
+     * first vertex to limit cancellation. Moving vertex k by (a,b) changes 2.A by
+     * a.(y[k+1]-y[k-1]) - b.(x[k+1]-x[k-1]) + a.b[k+1] - a[k+1].b, which bounds
+     * the effect of the rounding of the coordinates.
+     */
+    CompensatedSum sum ;
+    double perturbation = 0.0 ;
+
+    TranslatedVertex previous = translatedVertex( x, rx, y, ry, n - 1 );
+    TranslatedVertex current  = translatedVertex( x, rx, y, ry, 0 );
+
+    for ( size_t k = 0; k < n; k++ ) {
+        const TranslatedVertex next = translatedVertex( x, rx, y, ry, ( k + 1 ) % n );
+
+        sum.addProduct( current.x, next.y );
+        sum.addProduct( - next.x, current.y );
+
+        perturbation += current.rx * std::abs( next.y - previous.y )
+                        + current.ry * std::abs( next.x - previous.x )
+                        + current.rx * next.ry + next.rx * current.ry ;
+
+        previous = current ;
+        current  = next ;
+    }
+
+    area  = sum.value() / 2 ;
+    bound = ( sum.errorBound() + perturbation * ( 1.0 + CompensatedSum::gamma( n + 4 ) ) ) / 2 ;
+    return std::isfinite( bound ) ;
+}
+
+///
+///
+///
+bool ApproximateLineString::length( const int& dimension, double& length, double& bound ) const
+{
+    length = 0.0 ;
+    bound  = 0.0 ;
+
+    CompensatedSum sum ;
+    double perturbation = 0.0 ;
+
+    for ( size_t k = 1; k < size(); k++ ) {
+        double squaredLength = 0.0 ;
+
+        for ( int i = 0; i < dimension; i++ ) {
+            double d, rd ;
+            translate( _coordinates[i][k], _radius[i][k], _coordinates[i][k-1], _radius[i][k-1], d, rd );
+
+            // the square must neither underflow nor overflow
+            if ( d != 0.0 && ( std::abs( d ) < 1.0e-150 || std::abs( d ) > 1.0e150 ) ) {
+                return false ;
+            }
+
+            squaredLength += d * d ;
+            perturbation  += rd ;
+        }
+
+        sum.add( std::sqrt( squaredLength ) );
+    }
+
+    // a segment length is 1-Lipschitz with respect to its coordinates and
+    // sqrt( x^2 + y^2 + z^2 ) is evaluated with a relative error of gamma( dimension + 1 )
+    length = sum.value() ;
+    bound  = ( sum.errorBound() + CompensatedSum::gamma( dimension + 1 ) * sum.absSum() + perturbation )
+             * ( 1.0 + CompensatedSum::gamma( size() + 4 ) ) ;
+    return std::isfinite( bound ) ;
+}
+
+///
+///
+///
+void ApproximateLineString::_clear()
+{
+    for ( int i = 0; i < 3; i++ ) {
+        _coordinates[i].clear();
+        _radius[i].clear();
+    }
+}
+
+///
+///
+///
+bool ApproximateLineString::_push_back( const Kernel::FT& v, const int& i )
+{
+    const std::pair< double, double > interval = CGAL::to_interval( v ) ;
+    double value  = interval.first ;
+    double radius = 0.0 ;
+
+    if ( interval.first != interval.second ) {
+        // the rounded middle stays in the interval, the factor 2 covers the
+        // rounding of the width
+        value  = 0.5 * interval.first + 0.5 * interval.second ;
+        radius = 2.0 * ( interval.second - interval.first ) ;
+    }
+
+    if ( ! std::isfinite( value ) || ! std::isfinite( radius ) ) {
+        return false ;
+    }
+
+    _coordinates[i].push_back( value );
+    _radius[i].push_back( radius );
+    return true ;
+}
+
+} // namespace detail
+} // namespace SFCGAL
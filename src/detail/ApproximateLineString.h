@@ -0,0 +1,96 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_APPROXIMATE_LINESTRING_H_
+#define _SFCGAL_DETAIL_APPROXIMATE_LINESTRING_H_
+
+#include <vector>
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/Kernel.h>
+
+namespace SFCGAL {
+class LineString ;
+class Triangle ;
+namespace detail {
+
+/**
+ * Relative error guaranteed by the double precision evaluation of area(),
+ * area3D(), length() and length3D() (2^-42, about 2.3e-13). The exact
+ * evaluation is used when it can't be guaranteed.
+ */
+const double MEASURE_RELATIVE_ERROR = 1.0 / 4398046511104.0 ;
+
+/**
+ * Double precision copy of the coordinates of a LineString with, for each
+ * coordinate, a bound on its distance to the exact value (zero if the
+ * coordinate is exactly representable by a double).
+ *
+ * Measures are evaluated with compensated sums (see CompensatedSum) and are
+ * returned with a bound on their error which takes into account both the
+ * rounding of the coordinates and the floating point operations.
+ *
+ * @ingroup detail
+ */
+class SFCGAL_API ApproximateLineString {
+public:
+    ApproximateLineString() ;
+
+    /**
+     * copy the coordinates of ls, z is only copied if dimension is 3
+     * @return false if ls has an empty point or a coordinate is out of
+     * the double range
+     */
+    bool assign( const LineString& ls, const int& dimension ) ;
+    /**
+     * copy the closed ring of the vertices of a Triangle
+     */
+    bool assign( const Triangle& triangle, const int& dimension ) ;
+
+    inline size_t size() const {
+        return _coordinates[0].size() ;
+    }
+
+    /**
+     * signed area of the ring projected on the plane of the coordinates
+     * i and j (0 for x, 1 for y, 2 for z). The ring is considered as closed.
+     * @param bound bound on | area - exact signed area |
+     * @return false if the bound can't be computed
+     */
+    bool signedArea( const int& i, const int& j, double& area, double& bound ) const ;
+
+    /**
+     * length of the LineString in the given dimension (2 or 3)
+     * @param bound bound on | length - exact length |
+     * @return false if the bound can't be computed
+     */
+    bool length( const int& dimension, double& length, double& bound ) const ;
+
+private:
+    std::vector< double > _coordinates[3] ;
+    std::vector< double > _radius[3] ;
+
+    void _clear() ;
+    bool _push_back( const Kernel::FT& v, const int& i ) ;
+} ;
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
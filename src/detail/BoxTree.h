@@ -0,0 +1,287 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_BOX_TREE_H_
+#define _SFCGAL_DETAIL_BOX_TREE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace SFCGAL {
+namespace detail {
+
+///
+/// Number of pairs below which distance computations compare every pair instead
+/// of building a BoxTree (DistanceIndex and InexactGeometrySet)
+const size_t BRUTE_FORCE_PAIRS = 64;
+
+///
+/// true if the closed boxes a and b overlap
+template <int Dim, class BoxA, class BoxB>
+inline bool box_overlaps( const BoxA& a, const BoxB& b )
+{
+    for ( int d = 0; d < Dim; ++d ) {
+        if ( a.max_coord( d ) < b.min_coord( d ) || b.max_coord( d ) < a.min_coord( d ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// distance between two boxes, 0 if they overlap
+template <int Dim, class BoxA, class BoxB>
+inline double box_distance( const BoxA& a, const BoxB& b )
+{
+    double d2 = 0.0;
+
+    for ( int d = 0; d < Dim; ++d ) {
+        double gap = 0.0;
+
+        if ( a.max_coord( d ) < b.min_coord( d ) ) {
+            gap = b.min_coord( d ) - a.max_coord( d );
+        }
+        else if ( b.max_coord( d ) < a.min_coord( d ) ) {
+            gap = a.min_coord( d ) - b.max_coord( d );
+        }
+
+        d2 += gap * gap;
+    }
+
+    return std::sqrt( d2 );
+}
+
+/**
+ * Static bounding box hierarchy on a set of boxes.
+ *
+ * The tree is built once by recursive median splits along the largest axis and
+ * is then queried many times : overlap queries with early exit and nearest
+ * neighbour queries (branch and bound on the box distance).
+ *
+ * Box has to provide min_coord( d ) and max_coord( d ), such as
+ * CGAL::Box_intersection_d::Box_with_handle_d or IndexedBox.
+ *
+ * @ingroup detail
+ */
+template <int Dim, class Box>
+class BoxTree {
+public:
+    typedef std::vector<Box> BoxCollection;
+
+    BoxTree() {}
+
+    /**
+     * build the tree on a copy of [begin,end)
+     */
+    template <class InputIterator>
+    void build( InputIterator begin, InputIterator end ) {
+        _boxes.assign( begin, end );
+        _nodes.clear();
+
+        if ( ! _boxes.empty() ) {
+            _nodes.reserve( 2 * ( _boxes.size() / LeafSize + 1 ) );
+            _build( 0, _boxes.size() );
+        }
+    }
+
+    inline size_t size() const {
+        return _boxes.size();
+    }
+    inline bool empty() const {
+        return _boxes.empty();
+    }
+    /**
+     * boxes in tree order
+     */
+    inline const BoxCollection& boxes() const {
+        return _boxes;
+    }
+
+    /**
+     * call cb( box ) on each box overlapping q until cb returns true
+     * @return true if cb returned true
+     */
+    template <class QueryBox, class Callback>
+    bool intersects_until( const QueryBox& q, Callback cb ) const {
+        return ! _nodes.empty() && _intersects( 0, q, cb );
+    }
+
+    /**
+     * Branch and bound nearest search : cb( box ) returns the distance from the
+     * query to the primitive of box. It is only called on boxes at a distance from q
+     * lower or equal to the best distance found so far, which starts at maxDistance,
+     * and the search stops on the first distance of 0.
+     *
+     * @return the minimum of maxDistance and of the returned distances
+     */
+    template <class QueryBox, class Callback>
+    double nearest( const QueryBox& q, Callback cb, double maxDistance ) const {
+        double best = maxDistance;
+        bool   contact = false;
+
+        if ( ! _nodes.empty() ) {
+            _nearest( 0, q, cb, best, contact );
+        }
+
+        return best;
+    }
+
+private:
+    enum { LeafSize = 4 };
+
+    struct Node {
+        double lower[Dim];
+        double upper[Dim];
+        // range of the boxes below the node
+        size_t begin;
+        size_t end;
+        // right child, 0 for a leaf (the left child follows its parent)
+        size_t right;
+
+        double min_coord( int d ) const {
+            return lower[d];
+        }
+        double max_coord( int d ) const {
+            return upper[d];
+        }
+    };
+
+    struct center_less {
+        int axis;
+        center_less( int a ) : axis( a ) {}
+        bool operator()( const Box& a, const Box& b ) const {
+            return a.min_coord( axis ) + a.max_coord( axis ) < b.min_coord( axis ) + b.max_coord( axis );
+        }
+    };
+
+    void _build( size_t begin, size_t end ) {
+        const size_t n = _nodes.size();
+        _nodes.push_back( Node() );
+
+        Node node;
+        node.begin = begin;
+        node.end = end;
+        node.right = 0;
+
+        double clower[Dim], cupper[Dim];
+
+        for ( int d = 0; d < Dim; ++d ) {
+            node.lower[d] = _boxes[begin].min_coord( d );
+            node.upper[d] = _boxes[begin].max_coord( d );
+            clower[d] = cupper[d] = _boxes[begin].min_coord( d ) + _boxes[begin].max_coord( d );
+        }
+
+        for ( size_t i = begin + 1; i < end; ++i ) {
+            for ( int d = 0; d < Dim; ++d ) {
+                node.lower[d] = std::min( node.lower[d], _boxes[i].min_coord( d ) );
+                node.upper[d] = std::max( node.upper[d], _boxes[i].max_coord( d ) );
+                const double c = _boxes[i].min_coord( d ) + _boxes[i].max_coord( d );
+                clower[d] = std::min( clower[d], c );
+                cupper[d] = std::max( cupper[d], c );
+            }
+        }
+
+        if ( end - begin > LeafSize ) {
+            int axis = 0;
+
+            for ( int d = 1; d < Dim; ++d ) {
+                if ( cupper[d] - clower[d] > cupper[axis] - clower[axis] ) {
+                    axis = d;
+                }
+            }
+
+            const size_t mid = begin + ( end - begin ) / 2;
+            std::nth_element( _boxes.begin() + begin, _boxes.begin() + mid, _boxes.begin() + end, center_less( axis ) );
+
+            _build( begin, mid );
+            node.right = _nodes.size();
+            _build( mid, end );
+        }
+
+        _nodes[n] = node;
+    }
+
+    template <class QueryBox, class Callback>
+    bool _intersects( size_t n, const QueryBox& q, Callback& cb ) const {
+        const Node& node = _nodes[n];
+
+        if ( ! box_overlaps<Dim>( node, q ) ) {
+            return false;
+        }
+
+        if ( node.right == 0 ) {
+            for ( size_t i = node.begin; i != node.end; ++i ) {
+                if ( box_overlaps<Dim>( _boxes[i], q ) && cb( _boxes[i] ) ) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        return _intersects( n + 1, q, cb ) || _intersects( node.right, q, cb );
+    }
+
+    // contact is set when a distance of 0 is found, nothing can be closer
+    template <class QueryBox, class Callback>
+    void _nearest( size_t n, const QueryBox& q, Callback& cb, double& best, bool& contact ) const {
+        const Node& node = _nodes[n];
+
+        if ( node.right == 0 ) {
+            for ( size_t i = node.begin; i != node.end && ! contact; ++i ) {
+                if ( box_distance<Dim>( _boxes[i], q ) <= best ) {
+                    const double d = cb( _boxes[i] );
+                    best = std::min( best, d );
+                    contact = ( d == 0.0 );
+                }
+            }
+
+            return;
+        }
+
+        // visit the closest child first
+        size_t first = n + 1;
+        size_t second = node.right;
+        double dfirst = box_distance<Dim>( _nodes[first], q );
+        double dsecond = box_distance<Dim>( _nodes[second], q );
+
+        if ( dsecond < dfirst ) {
+            std::swap( first, second );
+            std::swap( dfirst, dsecond );
+        }
+
+        if ( dfirst <= best && ! contact ) {
+            _nearest( first, q, cb, best, contact );
+        }
+
+        if ( dsecond <= best && ! contact ) {
+            _nearest( second, q, cb, best, contact );
+        }
+    }
+
+    BoxCollection     _boxes;
+    std::vector<Node> _nodes;
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
@@ -0,0 +1,159 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_COMPENSATED_SUM_H_
+#define _SFCGAL_DETAIL_COMPENSATED_SUM_H_
+
+#include <cmath>
+#include <limits>
+
+#include <SFCGAL/config.h>
+
+namespace SFCGAL {
+namespace detail {
+
+/**
+ * Compensated summation of doubles ("Sum2" and "Dot2" from Ogita, Rump and
+ * Oishi, "Accurate sum and dot product", 2005).
+ *
+ * Each addition is made with an error-free transformation (TwoSum) and the
+ * rounding errors are accumulated apart, so that the result is as accurate as
+ * if the sum was computed with twice the working precision. errorBound()
+ * returns a rigorous bound on the distance between value() and the exact sum
+ * of the added terms.
+ *
+ * @ingroup detail
+ */
+class SFCGAL_API CompensatedSum {
+public:
+    CompensatedSum():
+        _sum( 0.0 ),
+        _error( 0.0 ),
+        _absSum( 0.0 ),
+        _size( 0 ),
+        _exactProducts( true ) {
+    }
+
+    /**
+     * add a term
+     */
+    inline void add( const double& a ) {
+        const double s  = _sum + a ;
+        const double bp = s - _sum ;
+        _error += ( _sum - ( s - bp ) ) + ( a - bp ) ;
+        _sum = s ;
+        _absSum += std::abs( a ) ;
+        ++_size ;
+    }
+
+    /**
+     * add the exact product a * b (TwoProduct with Dekker's splitting)
+     */
+    inline void addProduct( const double& a, const double& b ) {
+        if ( a == 0.0 || b == 0.0 ) {
+            return ;
+        }
+
+        const double p = a * b ;
+
+        // the splitting overflows above 2^995 and the rounding error of the
+        // product is only representable above 2^-969
+        if ( std::abs( a ) > 1.0e299 || std::abs( b ) > 1.0e299 || std::abs( p ) < 3.0e-292 ) {
+            _exactProducts = false ;
+        }
+
+        double ah, al, bh, bl ;
+        split( a, ah, al );
+        split( b, bh, bl );
+        add( p );
+        add( ( ( ah * bh - p ) + ah * bl + al * bh ) + al * bl );
+    }
+
+    /**
+     * compensated sum of the added terms
+     */
+    inline double value() const {
+        return _sum + _error ;
+    }
+
+    /**
+     * sum of the absolute values of the added terms
+     */
+    inline double absSum() const {
+        return _absSum ;
+    }
+
+    /**
+     * number of added terms
+     */
+    inline size_t size() const {
+        return _size ;
+    }
+
+    /**
+     * bound on | value() - exact sum |, infinity if an overflow or an underflow
+     * prevents to compute it
+     */
+    inline double errorBound() const {
+        const double v = value() ;
+
+        if ( ! _exactProducts || ! std::isfinite( v ) || ! std::isfinite( _absSum ) ) {
+            return std::numeric_limits< double >::infinity() ;
+        }
+
+        // |res - s| <= u.|s| + gamma(n-1)^2.sum(|p|), the last factor covers
+        // the rounding of absSum and of the bound itself
+        const double g = gamma( _size ) ;
+        return ( unitRoundoff() * std::abs( v ) + g * g * _absSum ) * ( 1.0 + gamma( _size + 4 ) ) / ( 1.0 - unitRoundoff() ) ;
+    }
+
+    /**
+     * u, the relative rounding error of double operations
+     */
+    static inline double unitRoundoff() {
+        return std::numeric_limits< double >::epsilon() / 2 ;
+    }
+
+    /**
+     * gamma(n) = n.u / ( 1 - n.u ), the relative error of n successive double
+     * operations
+     */
+    static inline double gamma( const size_t& n ) {
+        const double nu = n * unitRoundoff() ;
+        return nu / ( 1.0 - nu ) ;
+    }
+
+private:
+    static inline void split( const double& a, double& hi, double& lo ) {
+        const double c = 134217729.0 * a ; // 2^27 + 1
+        hi = c - ( c - a ) ;
+        lo = a - hi ;
+    }
+
+    double _sum ;
+    double _error ;
+    double _absSum ;
+    size_t _size ;
+    bool   _exactProducts ;
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/CoordinateBuffer.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+#include <SFCGAL/Point.h>
+
+#include <algorithm>
+
+namespace SFCGAL {
+namespace detail {
+
+///
+///
+///
+CoordinateBuffer::CoordinateBuffer( bool is3D, bool isMeasured ):
+    _is3D( is3D ),
+    _isMeasured( isMeasured )
+{
+
+}
+
+///
+///
+///
+void CoordinateBuffer::push_back( const double& x, const double& y, const double& z, const double& m )
+{
+    _x.push_back( x );
+    _y.push_back( y );
+
+    if ( _is3D ) {
+        _z.push_back( z );
+    }
+
+    if ( _isMeasured ) {
+        _m.push_back( m );
+    }
+}
+
+///
+///
+///
+bool CoordinateBuffer::push_back( const Point& p )
+{
+    if ( p.isEmpty() || p.is3D() != _is3D || p.isMeasured() != _isMeasured ) {
+        return false;
+    }
+
+    double x, y, z = 0.0;
+
+    if ( ! toExactDouble( p.x(), x ) || ! toExactDouble( p.y(), y ) ) {
+        return false;
+    }
+
+    if ( _is3D && ! toExactDouble( p.z(), z ) ) {
+        return false;
+    }
+
+    push_back( x, y, z, p.m() );
+    return true;
+}
+
+///
+///
+///
+Point CoordinateBuffer::pointN( size_t i ) const
+{
+    BOOST_ASSERT( i < size() );
+
+    if ( _is3D ) {
+        return Point( _x[i], _y[i], _z[i], m( i ) );
+    }
+
+    Point p( _x[i], _y[i] );
+    p.setM( m( i ) );
+    return p;
+}
+
+///
+///
+///
+void CoordinateBuffer::reserve( size_t n )
+{
+    _x.reserve( n );
+    _y.reserve( n );
+
+    if ( _is3D ) {
+        _z.reserve( n );
+    }
+
+    if ( _isMeasured ) {
+        _m.reserve( n );
+    }
+}
+
+///
+///
+///
+void CoordinateBuffer::reverse()
+{
+    std::reverse( _x.begin(), _x.end() );
+    std::reverse( _y.begin(), _y.end() );
+    std::reverse( _z.begin(), _z.end() );
+    std::reverse( _m.begin(), _m.end() );
+}
+
+///
+///
+///
+void CoordinateBuffer::clear()
+{
+    _x.clear();
+    _y.clear();
+    _z.clear();
+    _m.clear();
+}
+
+} // namespace detail
+} // namespace SFCGAL
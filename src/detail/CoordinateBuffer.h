@@ -0,0 +1,137 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_COORDINATE_BUFFER_H_
+#define _SFCGAL_DETAIL_COORDINATE_BUFFER_H_
+
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/numeric.h>
+
+namespace SFCGAL {
+class Point;
+namespace detail {
+
+/**
+ * Contiguous storage of a sequence of coordinates, as one array
+ * per ordinate (x, y, z and m).
+ *
+ * Used as the compact storage of a LineString : n points cost four
+ * allocations instead of n Point objects. Coordinates are doubles, so
+ * a Point can only be stored if its coordinates are exactly representable
+ * by a double.
+ *
+ * @ingroup detail
+ */
+class SFCGAL_API CoordinateBuffer {
+public:
+    /**
+     * empty buffer with a given coordinate type
+     */
+    CoordinateBuffer( bool is3D = false, bool isMeasured = false ) ;
+
+    inline size_t size() const {
+        return _x.size();
+    }
+    inline bool   empty() const {
+        return _x.empty();
+    }
+    inline bool   is3D() const {
+        return _is3D;
+    }
+    inline bool   isMeasured() const {
+        return _isMeasured;
+    }
+
+    inline double x( size_t i ) const {
+        BOOST_ASSERT( i < size() );
+        return _x[i];
+    }
+    inline double y( size_t i ) const {
+        BOOST_ASSERT( i < size() );
+        return _y[i];
+    }
+    /**
+     * z coordinate, 0 for 2D buffers
+     */
+    inline double z( size_t i ) const {
+        BOOST_ASSERT( i < size() );
+        return _is3D ? _z[i] : 0.0;
+    }
+    /**
+     * m coordinate, NaN if the buffer is not measured
+     */
+    inline double m( size_t i ) const {
+        BOOST_ASSERT( i < size() );
+        return _isMeasured ? _m[i] : NaN();
+    }
+
+    /**
+     * raw arrays (z and m arrays are empty if not used)
+     */
+    inline const std::vector< double >& xs() const {
+        return _x;
+    }
+    inline const std::vector< double >& ys() const {
+        return _y;
+    }
+    inline const std::vector< double >& zs() const {
+        return _z;
+    }
+    inline const std::vector< double >& ms() const {
+        return _m;
+    }
+
+    /**
+     * append a coordinate (z and m are ignored if not used)
+     */
+    void   push_back( const double& x, const double& y, const double& z = 0.0, const double& m = NaN() ) ;
+
+    /**
+     * append the coordinates of a Point
+     * @return false if p is empty, has not the buffer coordinate type or
+     * has coordinates which are not exactly representable by a double
+     */
+    bool   push_back( const Point& p ) ;
+
+    /**
+     * equivalent to Point( x(i), y(i), z(i), m(i) )
+     */
+    Point  pointN( size_t i ) const ;
+
+    void   reserve( size_t n ) ;
+    void   reverse() ;
+    void   clear() ;
+
+private:
+    bool _is3D ;
+    bool _isMeasured ;
+    std::vector< double > _x ;
+    std::vector< double > _y ;
+    std::vector< double > _z ;
+    std::vector< double > _m ;
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
@@ -0,0 +1,60 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/CoordinateHash.h>
+
+#include <utility>
+
+#include <boost/functional/hash.hpp>
+
+namespace SFCGAL {
+namespace detail {
+
+namespace {
+
+/**
+ * double value of a number, the same for every representation of a given value
+ */
+double hashValue( const Kernel::FT& v )
+{
+    const std::pair< double, double > interval = CGAL::to_interval( v );
+    const double d = ( interval.first == interval.second ) ? interval.first : CGAL::to_double( CGAL::exact( v ) );
+    // -0.0 == 0.0
+    return d == 0.0 ? 0.0 : d;
+}
+
+}
+
+///
+///
+///
+size_t CoordinateHash::operator()( const Coordinate& c ) const
+{
+    size_t seed = 0;
+
+    if ( ! c.isEmpty() ) {
+        boost::hash_combine( seed, hashValue( c.x() ) );
+        boost::hash_combine( seed, hashValue( c.y() ) );
+    }
+
+    return seed;
+}
+
+} // namespace detail
+} // namespace SFCGAL
@@ -0,0 +1,47 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_COORDINATE_HASH_H_
+#define _SFCGAL_DETAIL_COORDINATE_HASH_H_
+
+#include <cstddef>
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/Coordinate.h>
+
+namespace SFCGAL {
+namespace detail {
+
+/**
+ * Hash of a Coordinate, consistent with Coordinate::operator == so that
+ * Coordinates can be used as keys of unordered containers.
+ *
+ * Equal numbers have the same hash whatever their representation (lazy
+ * or evaluated). z is not hashed as a 2D and a 3D Coordinate may be equal.
+ *
+ * @ingroup detail
+ */
+struct SFCGAL_API CoordinateHash {
+    size_t operator()( const Coordinate& c ) const ;
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
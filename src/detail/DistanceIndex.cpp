@@ -0,0 +1,538 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/DistanceIndex.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/distance3d.h>
+#include <SFCGAL/triangulate/triangulatePolygon.h>
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+
+namespace SFCGAL {
+namespace detail {
+
+///
+///
+///
+DistanceElement::DistanceElement( const Point& a ) :
+    _dimension( 0 )
+{
+    _vertices[0] = a;
+}
+
+///
+///
+///
+DistanceElement::DistanceElement( const Point& a, const Point& b ) :
+    _dimension( 1 )
+{
+    _vertices[0] = a;
+    _vertices[1] = b;
+}
+
+///
+///
+///
+DistanceElement::DistanceElement( const Point& a, const Point& b, const Point& c ) :
+    _dimension( 2 )
+{
+    _vertices[0] = a;
+    _vertices[1] = b;
+    _vertices[2] = c;
+}
+
+///
+///
+///
+template <int Dim>
+typename TypeForDimension<Dim>::Bbox DistanceElement::bbox() const
+{
+    typename TypeForDimension<Dim>::Bbox box = _vertices[0].toPoint_d<Dim>().bbox();
+
+    for ( int i = 1; i <= _dimension; ++i ) {
+        box = box + _vertices[i].toPoint_d<Dim>().bbox();
+    }
+
+    return box;
+}
+
+template CGAL::Bbox_2 DistanceElement::bbox<2>() const;
+template CGAL::Bbox_3 DistanceElement::bbox<3>() const;
+
+namespace {
+
+void collectLineString( const LineString& g, std::vector<DistanceElement>& elements )
+{
+    const size_t numPoints = g.numPoints();
+
+    if ( numPoints == 1 ) {
+        elements.push_back( DistanceElement( g.pointN( 0 ) ) );
+    }
+
+    for ( size_t i = 1; i < numPoints; ++i ) {
+        const Point& a = g.pointN( i - 1 );
+        const Point& b = g.pointN( i );
+
+        if ( a == b ) {
+            // degenerated segment, keeps the point if the LineString only has double points
+            if ( numPoints == 2 ) {
+                elements.push_back( DistanceElement( a ) );
+            }
+
+            continue;
+        }
+
+        elements.push_back( DistanceElement( a, b ) );
+    }
+}
+
+void collectTriangles( const TriangulatedSurface& tin, std::vector<DistanceElement>& elements )
+{
+    for ( size_t i = 0; i < tin.numTriangles(); ++i ) {
+        const Triangle& t = tin.triangleN( i );
+        elements.push_back( DistanceElement( t.vertex( 0 ), t.vertex( 1 ), t.vertex( 2 ) ) );
+    }
+}
+
+void collect( const Geometry& g, std::vector<DistanceElement>& elements, dim_t<2> )
+{
+    if ( g.isEmpty() ) {
+        return;
+    }
+
+    switch ( g.geometryTypeId() ) {
+    case TYPE_POINT:
+        elements.push_back( DistanceElement( g.as< Point >() ) );
+        return;
+
+    case TYPE_LINESTRING:
+        collectLineString( g.as< LineString >(), elements );
+        return;
+
+    case TYPE_POLYGON: {
+        const Polygon& polygon = g.as< Polygon >();
+
+        for ( size_t i = 0; i < polygon.numRings(); ++i ) {
+            collectLineString( polygon.ringN( i ), elements );
+        }
+
+        return;
+    }
+
+    case TYPE_TRIANGLE: {
+        const Triangle& triangle = g.as< Triangle >();
+
+        for ( int i = 0; i < 3; ++i ) {
+            elements.push_back( DistanceElement( triangle.vertex( i ), triangle.vertex( ( i + 1 ) % 3 ) ) );
+        }
+
+        return;
+    }
+
+    case TYPE_SOLID:
+        BOOST_THROW_EXCEPTION( NotImplementedException(
+                                   ( boost::format( "distance(%s,...) is not implemented" ) % g.geometryType() ).str()
+                               ) );
+
+    case TYPE_MULTIPOINT:
+    case TYPE_MULTILINESTRING:
+    case TYPE_MULTIPOLYGON:
+    case TYPE_MULTISOLID:
+    case TYPE_GEOMETRYCOLLECTION:
+    case TYPE_TRIANGULATEDSURFACE:
+    case TYPE_POLYHEDRALSURFACE:
+        for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+            collect( g.geometryN( i ), elements, dim_t<2>() );
+        }
+
+        return;
+    }
+}
+
+void collect( const Geometry& g, std::vector<DistanceElement>& elements, dim_t<3> )
+{
+    if ( g.isEmpty() ) {
+        return;
+    }
+
+    switch ( g.geometryTypeId() ) {
+    case TYPE_POINT:
+        elements.push_back( DistanceElement( g.as< Point >() ) );
+        return;
+
+    case TYPE_LINESTRING:
+        collectLineString( g.as< LineString >(), elements );
+        return;
+
+    case TYPE_POLYGON:
+    case TYPE_TRIANGLE:
+    case TYPE_TRIANGULATEDSURFACE:
+    case TYPE_POLYHEDRALSURFACE:
+    case TYPE_SOLID: {
+        TriangulatedSurface tin;
+        triangulate::triangulatePolygon3D( g, tin, triangulate::TRIANGULATION_FAST );
+        collectTriangles( tin, elements );
+        return;
+    }
+
+    case TYPE_MULTIPOINT:
+    case TYPE_MULTILINESTRING:
+    case TYPE_MULTIPOLYGON:
+    case TYPE_MULTISOLID:
+    case TYPE_GEOMETRYCOLLECTION:
+        for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+            collect( g.geometryN( i ), elements, dim_t<3>() );
+        }
+
+        return;
+    }
+}
+
+//
+// distance between elements, with dimension( a ) <= dimension( b )
+double orderedDistance( const DistanceElement& a, const DistanceElement& b, dim_t<2> )
+{
+    BOOST_ASSERT( b.dimension() <= 1 );
+
+    if ( a.dimension() == 0 ) {
+        return b.dimension() == 0
+               ? algorithm::distancePointPoint( a.vertex( 0 ), b.vertex( 0 ) )
+               : algorithm::distancePointSegment( a.vertex( 0 ), b.vertex( 0 ), b.vertex( 1 ) );
+    }
+
+    return algorithm::distanceSegmentSegment( a.vertex( 0 ), a.vertex( 1 ), b.vertex( 0 ), b.vertex( 1 ) );
+}
+
+double orderedDistance( const DistanceElement& a, const DistanceElement& b, dim_t<3> )
+{
+    switch ( a.dimension() * 3 + b.dimension() ) {
+    case 0:
+        return algorithm::distancePointPoint3D( a.vertex( 0 ), b.vertex( 0 ) );
+
+    case 1:
+        return algorithm::distancePointSegment3D( a.vertex( 0 ), b.vertex( 0 ), b.vertex( 1 ) );
+
+    case 2:
+        return algorithm::distancePointTriangle3D( a.vertex( 0 ), b.vertex( 0 ), b.vertex( 1 ), b.vertex( 2 ) );
+
+    case 4:
+        return algorithm::distanceSegmentSegment3D( a.vertex( 0 ), a.vertex( 1 ), b.vertex( 0 ), b.vertex( 1 ) );
+
+    case 5:
+        return algorithm::distanceSegmentTriangle3D( a.vertex( 0 ), a.vertex( 1 ),
+                b.vertex( 0 ), b.vertex( 1 ), b.vertex( 2 ) );
+
+    default:
+        return algorithm::distanceTriangleTriangle3D( Triangle( a.vertex( 0 ), a.vertex( 1 ), a.vertex( 2 ) ),
+                Triangle( b.vertex( 0 ), b.vertex( 1 ), b.vertex( 2 ) ) );
+    }
+}
+
+//
+// exact squared distance between elements, with dimension( a ) <= dimension( b )
+Kernel::FT orderedSquaredDistance( const DistanceElement& a, const DistanceElement& b, dim_t<2> )
+{
+    BOOST_ASSERT( b.dimension() <= 1 );
+
+    const Kernel::Point_2 a0 = a.vertex( 0 ).toPoint_2();
+
+    if ( b.dimension() == 0 ) {
+        return CGAL::squared_distance( a0, b.vertex( 0 ).toPoint_2() );
+    }
+
+    const Kernel::Segment_2 sb( b.vertex( 0 ).toPoint_2(), b.vertex( 1 ).toPoint_2() );
+
+    if ( a.dimension() == 0 ) {
+        return CGAL::squared_distance( a0, sb );
+    }
+
+    return CGAL::squared_distance( Kernel::Segment_2( a0, a.vertex( 1 ).toPoint_2() ), sb );
+}
+
+Kernel::Segment_3 toSegment_3( const DistanceElement& e )
+{
+    return Kernel::Segment_3( e.vertex( 0 ).toPoint_3(), e.vertex( 1 ).toPoint_3() );
+}
+
+Kernel::Triangle_3 toTriangle_3( const DistanceElement& e )
+{
+    return Kernel::Triangle_3( e.vertex( 0 ).toPoint_3(), e.vertex( 1 ).toPoint_3(), e.vertex( 2 ).toPoint_3() );
+}
+
+Kernel::FT orderedSquaredDistance( const DistanceElement& a, const DistanceElement& b, dim_t<3> )
+{
+    switch ( a.dimension() * 3 + b.dimension() ) {
+    case 0:
+        return CGAL::squared_distance( a.vertex( 0 ).toPoint_3(), b.vertex( 0 ).toPoint_3() );
+
+    case 1:
+        return CGAL::squared_distance( a.vertex( 0 ).toPoint_3(), toSegment_3( b ) );
+
+    case 2:
+        return algorithm::squaredDistancePointTriangle3D( a.vertex( 0 ).toPoint_3(), toTriangle_3( b ) );
+
+    case 4:
+        return CGAL::squared_distance( toSegment_3( a ), toSegment_3( b ) );
+
+    case 5:
+        return algorithm::squaredDistanceSegmentTriangle3D( toSegment_3( a ), toTriangle_3( b ) );
+
+    default:
+        return algorithm::squaredDistanceTriangleTriangle3D( toTriangle_3( a ), toTriangle_3( b ) );
+    }
+}
+
+//
+// stops on the first pair of elements at most a squared distance from each other
+template <int Dim>
+struct elements_within_cb {
+    const std::vector<DistanceElement>& elementsA;
+    const std::vector<DistanceElement>& elementsB;
+    const Kernel::FT& threshold;
+
+    elements_within_cb( const std::vector<DistanceElement>& a, const std::vector<DistanceElement>& b, const Kernel::FT& t ) :
+        elementsA( a ), elementsB( b ), threshold( t ) {}
+
+    bool operator()( const InflatedBox<Dim>& boxA, const IndexedBox<Dim>& boxB ) const {
+        return squaredDistance<Dim>( elementsA[ boxA.index() ], elementsB[ boxB.index() ] ) <= threshold;
+    }
+};
+
+//
+// distance from an element to the indexed elements, for BoxTree::nearest
+template <int Dim>
+struct element_distance_cb {
+    const std::vector<DistanceElement>& elements;
+    const DistanceElement& element;
+    // minimum of the evaluated distances
+    double& evaluated;
+
+    element_distance_cb( const std::vector<DistanceElement>& e, const DistanceElement& q, double& ev ) :
+        elements( e ), element( q ), evaluated( ev ) {}
+
+    double operator()( const IndexedBox<Dim>& box ) const {
+        const double d = distance<Dim>( element, elements[ box.index() ] );
+        evaluated = std::min( evaluated, d );
+        return d;
+    }
+};
+
+} // anonymous namespace
+
+///
+///
+///
+template <int Dim>
+void collectDistanceElements( const Geometry& g, std::vector<DistanceElement>& elements )
+{
+    collect( g, elements, dim_t<Dim>() );
+}
+
+///
+///
+///
+template <int Dim>
+double distance( const DistanceElement& a, const DistanceElement& b )
+{
+    if ( a.dimension() <= b.dimension() ) {
+        return orderedDistance( a, b, dim_t<Dim>() );
+    }
+
+    return orderedDistance( b, a, dim_t<Dim>() );
+}
+
+///
+///
+///
+template <int Dim>
+Kernel::FT squaredDistance( const DistanceElement& a, const DistanceElement& b )
+{
+    if ( a.dimension() <= b.dimension() ) {
+        return orderedSquaredDistance( a, b, dim_t<Dim>() );
+    }
+
+    return orderedSquaredDistance( b, a, dim_t<Dim>() );
+}
+
+///
+///
+///
+template <int Dim>
+DistanceIndex<Dim>::DistanceIndex( const Geometry& g )
+{
+    collectDistanceElements<Dim>( g, _elements );
+    _build();
+}
+
+///
+///
+///
+template <int Dim>
+DistanceIndex<Dim>::DistanceIndex( const std::vector<DistanceElement>& elements ) :
+    _elements( elements )
+{
+    _build();
+}
+
+///
+///
+///
+template <int Dim>
+void DistanceIndex<Dim>::_build()
+{
+    std::vector< IndexedBox<Dim> > boxes;
+    boxes.reserve( _elements.size() );
+
+    for ( size_t i = 0; i < _elements.size(); ++i ) {
+        boxes.push_back( IndexedBox<Dim>( _elements[i].template bbox<Dim>(), i ) );
+    }
+
+    _tree.build( boxes.begin(), boxes.end() );
+}
+
+///
+///
+///
+template <int Dim>
+double DistanceIndex<Dim>::distance( const Geometry& g, const double& maxDistance ) const
+{
+    std::vector<DistanceElement> elements;
+    collectDistanceElements<Dim>( g, elements );
+    return distance( elements, maxDistance );
+}
+
+///
+///
+///
+template <int Dim>
+double DistanceIndex<Dim>::distance( const std::vector<DistanceElement>& elements, const double& maxDistance ) const
+{
+    double evaluated = std::numeric_limits<double>::infinity();
+    double best = maxDistance;
+
+    for ( size_t i = 0; i < elements.size() && evaluated > 0.0; ++i ) {
+        const IndexedBox<Dim> query( elements[i].template bbox<Dim>(), i );
+        best = _tree.nearest( query, element_distance_cb<Dim>( _elements, elements[i], evaluated ), best );
+    }
+
+    return evaluated;
+}
+
+///
+///
+///
+template <int Dim>
+double distance( const std::vector<DistanceElement>& a, const std::vector<DistanceElement>& b, const double& maxDistance )
+{
+    if ( a.size() * b.size() <= BRUTE_FORCE_PAIRS ) {
+        double dMin = std::numeric_limits<double>::infinity();
+
+        for ( size_t i = 0; i < a.size() && dMin > 0.0; ++i ) {
+            for ( size_t j = 0; j < b.size(); ++j ) {
+                dMin = std::min( dMin, distance<Dim>( a[i], b[j] ) );
+            }
+        }
+
+        return dMin;
+    }
+
+    if ( a.size() > b.size() ) {
+        return DistanceIndex<Dim>( a ).distance( b, maxDistance );
+    }
+
+    return DistanceIndex<Dim>( b ).distance( a, maxDistance );
+}
+
+///
+///
+///
+template <int Dim>
+double elementsDistance( const Geometry& gA, const Geometry& gB, const double& maxDistance )
+{
+    std::vector<DistanceElement> elementsA, elementsB;
+    collectDistanceElements<Dim>( gA, elementsA );
+    collectDistanceElements<Dim>( gB, elementsB );
+    return distance<Dim>( elementsA, elementsB, maxDistance );
+}
+
+///
+///
+///
+template <int Dim>
+bool elementsWithin( const Geometry& gA, const Geometry& gB, const double& distance )
+{
+    std::vector<DistanceElement> elementsA, elementsB;
+    collectDistanceElements<Dim>( gA, elementsA );
+    collectDistanceElements<Dim>( gB, elementsB );
+
+    // only the elements whose boxes are closer than distance are compared
+    std::vector< InflatedBox<Dim> > boxesA;
+    std::vector< IndexedBox<Dim> > boxesB;
+    boxesA.reserve( elementsA.size() );
+    boxesB.reserve( elementsB.size() );
+
+    for ( size_t i = 0; i < elementsA.size(); ++i ) {
+        boxesA.push_back( InflatedBox<Dim>( IndexedBox<Dim>( elementsA[i].template bbox<Dim>(), i ), distance, i ) );
+    }
+
+    for ( size_t i = 0; i < elementsB.size(); ++i ) {
+        boxesB.push_back( IndexedBox<Dim>( elementsB[i].template bbox<Dim>(), i ) );
+    }
+
+    const Kernel::FT d( distance );
+    const Kernel::FT squared = d * d;
+    return box_intersection_until( boxesA.begin(), boxesA.end(), boxesB.begin(), boxesB.end(),
+                                   elements_within_cb<Dim>( elementsA, elementsB, squared ) );
+}
+
+template SFCGAL_API void collectDistanceElements<2>( const Geometry& g, std::vector<DistanceElement>& elements );
+template SFCGAL_API void collectDistanceElements<3>( const Geometry& g, std::vector<DistanceElement>& elements );
+
+template SFCGAL_API double distance<2>( const DistanceElement& a, const DistanceElement& b );
+template SFCGAL_API double distance<3>( const DistanceElement& a, const DistanceElement& b );
+
+template SFCGAL_API double distance<2>( const std::vector<DistanceElement>& a, const std::vector<DistanceElement>& b,
+                                       const double& maxDistance );
+template SFCGAL_API double distance<3>( const std::vector<DistanceElement>& a, const std::vector<DistanceElement>& b,
+                                       const double& maxDistance );
+
+template SFCGAL_API double elementsDistance<2>( const Geometry& gA, const Geometry& gB, const double& maxDistance );
+template SFCGAL_API double elementsDistance<3>( const Geometry& gA, const Geometry& gB, const double& maxDistance );
+
+template SFCGAL_API Kernel::FT squaredDistance<2>( const DistanceElement& a, const DistanceElement& b );
+template SFCGAL_API Kernel::FT squaredDistance<3>( const DistanceElement& a, const DistanceElement& b );
+
+template SFCGAL_API bool elementsWithin<2>( const Geometry& gA, const Geometry& gB, const double& distance );
+template SFCGAL_API bool elementsWithin<3>( const Geometry& gA, const Geometry& gB, const double& distance );
+
+template class DistanceIndex<2>;
+template class DistanceIndex<3>;
+
+} // namespace detail
+} // namespace SFCGAL
@@ -0,0 +1,194 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_DISTANCE_INDEX_H_
+#define _SFCGAL_DETAIL_DISTANCE_INDEX_H_
+
+#include <limits>
+#include <vector>
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/detail/TypeForDimension.h>
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/BoxTree.h>
+
+namespace SFCGAL {
+class Geometry;
+namespace detail {
+
+/**
+ * Elementary part of a geometry for distance computations : a point,
+ * a segment or a triangle (the later being only used in 3D)
+ *
+ * @ingroup detail
+ */
+class SFCGAL_API DistanceElement {
+public:
+    DistanceElement( const Point& a );
+    DistanceElement( const Point& a, const Point& b );
+    DistanceElement( const Point& a, const Point& b, const Point& c );
+
+    /**
+     * 0 for a point, 1 for a segment, 2 for a triangle
+     */
+    inline int dimension() const {
+        return _dimension;
+    }
+    /**
+     * n-th vertex, n < dimension() + 1
+     */
+    inline const Point& vertex( int n ) const {
+        BOOST_ASSERT( n <= _dimension );
+        return _vertices[n];
+    }
+
+    /**
+     * bounding box of the element
+     */
+    template <int Dim>
+    typename TypeForDimension<Dim>::Bbox bbox() const;
+
+private:
+    int   _dimension;
+    Point _vertices[3];
+};
+
+/**
+ * Decompose g into points, segments and, in 3D, triangles so that the distance between
+ * two geometries which do not intersect is the minimum distance between their elements.
+ *
+ * - 2D : polygons, triangles and surfaces are represented by the segments of their rings
+ * - 3D : polygons, triangles, surfaces and solids are triangulated
+ *
+ * @throw NotImplementedException for solids in 2D, as distance()
+ * @ingroup detail
+ */
+template <int Dim>
+void collectDistanceElements( const Geometry& g, std::vector<DistanceElement>& elements );
+
+/**
+ * Distance between two elements
+ * @ingroup detail
+ */
+template <int Dim>
+double distance( const DistanceElement& a, const DistanceElement& b );
+
+/**
+ * Exact squared distance between two elements
+ * @ingroup detail
+ */
+template <int Dim>
+Kernel::FT squaredDistance( const DistanceElement& a, const DistanceElement& b );
+
+/**
+ * Box hierarchy on the DistanceElement of a geometry.
+ *
+ * It computes the minimum distance between the elements of two geometries with a branch
+ * and bound search : elements of the other geometry are only compared to the indexed elements
+ * whose bounding box is closer than the best distance found so far.
+ *
+ * It is the distance between the geometries when they do not intersect. The intersection
+ * test is left to the caller.
+ *
+ * @ingroup detail
+ */
+template <int Dim>
+class SFCGAL_API DistanceIndex {
+public:
+    typedef BoxTree< Dim, IndexedBox<Dim> > Tree;
+
+    DistanceIndex( const Geometry& g );
+
+    /**
+     * index a copy of elements
+     */
+    explicit DistanceIndex( const std::vector<DistanceElement>& elements );
+
+    /**
+     * true if the geometry has no element
+     */
+    inline bool isEmpty() const {
+        return _elements.empty();
+    }
+
+    inline const std::vector<DistanceElement>& elements() const {
+        return _elements;
+    }
+
+    /**
+     * Minimum distance between the elements of g and the indexed elements.
+     * Pairs of elements further than maxDistance are not evaluated.
+     *
+     * @return the distance if it is lower or equal to maxDistance, a value
+     * greater than maxDistance otherwise (infinity if g or the index is empty)
+     */
+    double distance( const Geometry& g, const double& maxDistance = std::numeric_limits<double>::infinity() ) const;
+
+    /**
+     * Same as distance( g ) with the elements of g
+     */
+    double distance( const std::vector<DistanceElement>& elements,
+                     const double& maxDistance = std::numeric_limits<double>::infinity() ) const;
+
+private:
+    void _build();
+
+    std::vector<DistanceElement> _elements;
+    Tree                         _tree;
+};
+
+/**
+ * Minimum distance between two sets of elements. Small sets are compared pair by pair,
+ * otherwise the larger set is indexed with a DistanceIndex.
+ *
+ * @return the distance if it is lower or equal to maxDistance, a value
+ * greater than maxDistance otherwise (infinity if a set is empty)
+ * @ingroup detail
+ */
+template <int Dim>
+double distance( const std::vector<DistanceElement>& a, const std::vector<DistanceElement>& b,
+                 const double& maxDistance = std::numeric_limits<double>::infinity() );
+
+/**
+ * Minimum distance between the elements of gA and gB, which is the distance between
+ * gA and gB if they do not intersect (see distance( a, b, maxDistance ))
+ *
+ * @throw NotImplementedException for solids in 2D, as distance()
+ * @ingroup detail
+ */
+template <int Dim>
+double elementsDistance( const Geometry& gA, const Geometry& gB,
+                         const double& maxDistance = std::numeric_limits<double>::infinity() );
+
+/**
+ * Exact test : true if an element of gA and an element of gB are at most distance
+ * from each other. Squared distances are compared to distance * distance without
+ * rounding, so that it is the dWithin predicate when gA and gB do not intersect.
+ *
+ * @throw NotImplementedException for solids in 2D, as distance()
+ * @ingroup detail
+ */
+template <int Dim>
+bool elementsWithin( const Geometry& gA, const Geometry& gB, const double& distance );
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
@@ -50,6 +50,13 @@ void ForceValidityVisitor::visit( Point& g )
 void ForceValidityVisitor::visit( LineString& g )
 {
     g.forceValidityFlag( valid_ );
+
+    // the points of a compact LineString are views of its coordinates, flagging
+    // them would turn it back to Point storage
+    if ( g.isCompact() ) {
+        return;
+    }
+
     for ( size_t i = 0; i < g.numPoints(); i++ ) {
         visit( g.pointN( i ) );
     }
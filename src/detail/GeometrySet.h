@@ -22,6 +22,14 @@
 #ifndef _SFCGAL_DETAIL_GEOMETRY_SET_H_
 #define _SFCGAL_DETAIL_GEOMETRY_SET_H_
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <set>
+#include <utility>
+#include <vector>
+
 #include <boost/ptr_container/ptr_vector.hpp>
 #include <boost/variant.hpp>
 
@@ -94,6 +102,321 @@ struct HandleCollection {
     typedef std::list<PrimitiveHandle<Dim> > Type;
 };
 
+///
+/// Box with an index, for use with box_intersection_until when the boxes
+/// are built on something else than a GeometrySet (segments of a LineString, polygons
+/// of a surface...)
+template <int Dim>
+class IndexedBox {
+public:
+    typedef typename TypeForDimension<Dim>::Bbox Bbox;
+
+    IndexedBox( const Bbox& bbox, size_t index ) : _bbox( bbox ), _index( index ) {}
+
+    static int dimension() {
+        return Dim;
+    }
+    double min_coord( int d ) const {
+        return _bbox.min( d );
+    }
+    double max_coord( int d ) const {
+        return _bbox.max( d );
+    }
+    size_t index() const {
+        return _index;
+    }
+private:
+    Bbox   _bbox;
+    size_t _index;
+};
+
+///
+/// Box inflated by a distance along every axis, for use with box_intersection_until
+/// in distance threshold predicates. Bounds are rounded outward so that the box
+/// contains every point closer than the distance to the original box.
+template <int Dim>
+class InflatedBox {
+public:
+    template <class Box>
+    InflatedBox( const Box& box, const double& distance, size_t index ) : _index( index ) {
+        for ( int d = 0; d < Dim; ++d ) {
+            _lower[d] = std::nextafter( box.min_coord( d ) - distance, -std::numeric_limits<double>::infinity() );
+            _upper[d] = std::nextafter( box.max_coord( d ) + distance, std::numeric_limits<double>::infinity() );
+        }
+    }
+
+    static int dimension() {
+        return Dim;
+    }
+    double min_coord( int d ) const {
+        return _lower[d];
+    }
+    double max_coord( int d ) const {
+        return _upper[d];
+    }
+    size_t index() const {
+        return _index;
+    }
+private:
+    double _lower[Dim];
+    double _upper[Dim];
+    size_t _index;
+};
+
+///
+/// callback for box_intersection_until, stops on the first pair of boxes
+struct any_box_cb {
+    template <class BoxA, class BoxB>
+    bool operator()( const BoxA&, const BoxB& ) const {
+        return true;
+    }
+};
+
+///
+/// ordering on the lower bound along the first axis
+template <class Box>
+struct box_min_less {
+    bool operator()( const Box& a, const Box& b ) const {
+        return a.min_coord( 0 ) < b.min_coord( 0 );
+    }
+};
+
+///
+/// true if the closed boxes a and b overlap along every axis but the first one
+template <class BoxA, class BoxB>
+inline bool box_overlaps_tail( const BoxA& a, const BoxB& b )
+{
+    for ( int d = 1; d < BoxA::dimension(); ++d ) {
+        if ( a.max_coord( d ) < b.min_coord( d ) || b.max_coord( d ) < a.min_coord( d ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Sweep along the first axis calling cb( a, b ) on each pair of intersecting boxes
+ * of [abegin,aend) x [bbegin,bend), until cb returns true.
+ *
+ * It replaces CGAL::box_intersection_d (and an exception thrown from the callback)
+ * for predicates which only need the first hit. Boxes are closed, as with
+ * CGAL::box_intersection_d default topology, and each pair is reported once.
+ *
+ * @note both ranges are sorted in place
+ * @return true if cb returned true
+ */
+template <class RandomIteratorA, class RandomIteratorB, class Callback>
+bool box_intersection_until( RandomIteratorA abegin, RandomIteratorA aend,
+                             RandomIteratorB bbegin, RandomIteratorB bend,
+                             Callback cb )
+{
+    typedef typename std::iterator_traits<RandomIteratorA>::value_type BoxA;
+    typedef typename std::iterator_traits<RandomIteratorB>::value_type BoxB;
+
+    std::sort( abegin, aend, box_min_less<BoxA>() );
+    std::sort( bbegin, bend, box_min_less<BoxB>() );
+
+    RandomIteratorA ia = abegin;
+    RandomIteratorB ib = bbegin;
+
+    while ( ia != aend && ib != bend ) {
+        if ( ia->min_coord( 0 ) <= ib->min_coord( 0 ) ) {
+            // ia starts first, test it against the b boxes starting before its end
+            for ( RandomIteratorB jb = ib; jb != bend && jb->min_coord( 0 ) <= ia->max_coord( 0 ); ++jb ) {
+                if ( box_overlaps_tail( *ia, *jb ) && cb( *ia, *jb ) ) {
+                    return true;
+                }
+            }
+
+            ++ia;
+        }
+        else {
+            for ( RandomIteratorA ja = ia; ja != aend && ja->min_coord( 0 ) <= ib->max_coord( 0 ); ++ja ) {
+                if ( box_overlaps_tail( *ja, *ib ) && cb( *ja, *ib ) ) {
+                    return true;
+                }
+            }
+
+            ++ib;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Distance threshold filter : false if the boxes of [abegin,aend) inflated by distance
+ * do not intersect the boxes of [bbegin,bend). In that case, the primitives of the
+ * two ranges are further than distance from each other.
+ *
+ * @note [bbegin,bend) is sorted in place
+ */
+template <int Dim, class IteratorA, class RandomIteratorB>
+bool inflated_boxes_intersect( IteratorA abegin, IteratorA aend,
+                               RandomIteratorB bbegin, RandomIteratorB bend,
+                               const double& distance )
+{
+    std::vector< InflatedBox<Dim> > inflated;
+    inflated.reserve( std::distance( abegin, aend ) );
+
+    for ( size_t i = 0; abegin != aend; ++abegin, ++i ) {
+        inflated.push_back( InflatedBox<Dim>( *abegin, distance, i ) );
+    }
+
+    return box_intersection_until( inflated.begin(), inflated.end(), bbegin, bend, any_box_cb() );
+}
+
+/**
+ * Same as box_intersection_until, on each pair of distinct intersecting boxes
+ * of [begin,end). Each pair is reported once, in an unspecified order.
+ *
+ * @note the range is sorted in place
+ * @return true if cb returned true
+ */
+template <class RandomIterator, class Callback>
+bool box_self_intersection_until( RandomIterator begin, RandomIterator end, Callback cb )
+{
+    typedef typename std::iterator_traits<RandomIterator>::value_type Box;
+
+    std::sort( begin, end, box_min_less<Box>() );
+
+    for ( RandomIterator i = begin; i != end; ++i ) {
+        for ( RandomIterator j = i + 1; j != end && j->min_coord( 0 ) <= i->max_coord( 0 ); ++j ) {
+            if ( box_overlaps_tail( *i, *j ) && cb( *i, *j ) ) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Same as box_self_intersection_until, with the active boxes of the sweep indexed
+ * along the second axis : only active boxes which overlap along the first two axes
+ * are tested, so that the cost is O( ( n + k ) log n ) where k is the number of such
+ * pairs (instead of the number of pairs overlapping along the first axis).
+ *
+ * Active boxes containing the lower bound of the new box are found in a segment tree
+ * built on the bounds along the second axis, the ones starting inside the new box in
+ * an ordered set.
+ *
+ * @note the range is sorted in place
+ * @return true if cb returned true
+ */
+template <class RandomIterator, class Callback>
+bool box_self_intersection_indexed_until( RandomIterator begin, RandomIterator end, Callback cb )
+{
+    typedef typename std::iterator_traits<RandomIterator>::value_type Box;
+
+    const size_t n = end - begin;
+
+    if ( n < 2 ) {
+        return false;
+    }
+
+    std::sort( begin, end, box_min_less<Box>() );
+
+    // bounds along the second axis, leaves of the segment tree
+    std::vector<double> bounds;
+    bounds.reserve( 2 * n );
+
+    for ( RandomIterator it = begin; it != end; ++it ) {
+        bounds.push_back( it->min_coord( 1 ) );
+        bounds.push_back( it->max_coord( 1 ) );
+    }
+
+    std::sort( bounds.begin(), bounds.end() );
+    bounds.erase( std::unique( bounds.begin(), bounds.end() ), bounds.end() );
+
+    const size_t numLeaves = bounds.size();
+    std::vector<size_t> lower( n ), upper( n );
+
+    for ( size_t i = 0; i < n; ++i ) {
+        lower[i] = std::lower_bound( bounds.begin(), bounds.end(), begin[i].min_coord( 1 ) ) - bounds.begin();
+        upper[i] = std::lower_bound( bounds.begin(), bounds.end(), begin[i].max_coord( 1 ) ) - bounds.begin();
+    }
+
+    // boxes by increasing upper bound along the first axis, to leave the sweep
+    std::vector<size_t> byMax( n );
+
+    for ( size_t i = 0; i < n; ++i ) {
+        byMax[i] = i;
+    }
+
+    std::sort( byMax.begin(), byMax.end(), [&begin]( size_t a, size_t b ) {
+        return begin[a].max_coord( 0 ) < begin[b].max_coord( 0 );
+    } );
+
+    // bottom-up segment tree, a box is stored in the nodes covering [lower,upper].
+    // Boxes leaving the sweep are removed lazily
+    std::vector< std::vector<size_t> > nodes( 2 * numLeaves );
+    // active boxes, by lower bound along the second axis
+    std::set< std::pair<size_t, size_t> > starts;
+    std::vector<bool> active( n, false );
+
+    size_t leaving = 0;
+
+    for ( size_t i = 0; i < n; ++i ) {
+        const Box& box = begin[i];
+
+        while ( leaving < n && begin[ byMax[leaving] ].max_coord( 0 ) < box.min_coord( 0 ) ) {
+            const size_t j = byMax[leaving++];
+
+            if ( active[j] ) {
+                active[j] = false;
+                starts.erase( std::make_pair( lower[j], j ) );
+            }
+        }
+
+        // active boxes containing the lower bound of the box
+        for ( size_t node = lower[i] + numLeaves; node >= 1; node >>= 1 ) {
+            std::vector<size_t>& boxes = nodes[node];
+
+            for ( size_t k = 0; k < boxes.size(); ) {
+                const size_t j = boxes[k];
+
+                if ( ! active[j] ) {
+                    boxes[k] = boxes.back();
+                    boxes.pop_back();
+                    continue;
+                }
+
+                if ( box_overlaps_tail( begin[j], box ) && cb( begin[j], box ) ) {
+                    return true;
+                }
+
+                ++k;
+            }
+        }
+
+        // active boxes starting inside the box
+        for ( std::set< std::pair<size_t, size_t> >::const_iterator it = starts.upper_bound( std::make_pair( lower[i], n ) );
+                it != starts.end() && it->first <= upper[i]; ++it ) {
+            if ( box_overlaps_tail( begin[it->second], box ) && cb( begin[it->second], box ) ) {
+                return true;
+            }
+        }
+
+        // enter the sweep
+        active[i] = true;
+        starts.insert( std::make_pair( lower[i], i ) );
+
+        for ( size_t l = lower[i] + numLeaves, r = upper[i] + numLeaves + 1; l < r; l >>= 1, r >>= 1 ) {
+            if ( l & 1 ) {
+                nodes[l++].push_back( i );
+            }
+
+            if ( r & 1 ) {
+                nodes[--r].push_back( i );
+            }
+        }
+    }
+
+    return false;
+}
+
 ///
 /// Flags available for each type of Geometry type.
 /// Primitives can be 'flagged' in order to speed up recomposition
@@ -0,0 +1,1012 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/detail/InexactGeometrySet.h>
+
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/detail/TypeForDimension.h>
+#include <SFCGAL/triangulate/triangulatePolygon.h>
+
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/BoxTree.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace SFCGAL {
+namespace detail {
+
+typedef InexactKernel::Point_2                      InexactPoint_2 ;
+typedef InexactKernel::Segment_2                    InexactSegment_2 ;
+typedef CGAL::Polygon_2<InexactKernel>              InexactPolygon_2 ;
+typedef CGAL::Polygon_with_holes_2<InexactKernel>   InexactPolygon_with_holes_2 ;
+
+typedef InexactKernel::Point_3                      InexactPoint_3 ;
+typedef InexactKernel::Segment_3                    InexactSegment_3 ;
+typedef InexactKernel::Triangle_3                   InexactTriangle_3 ;
+typedef InexactKernel::Plane_3                      InexactPlane_3 ;
+
+///
+///
+///
+bool toExactDouble( const Kernel::FT& v, double& d )
+{
+    // the interval is a singleton only if v is exactly a double
+    const std::pair<double, double> interval = CGAL::to_interval( v );
+
+    if ( interval.first != interval.second ) {
+        return false;
+    }
+
+    d = interval.first;
+    return true;
+}
+
+///
+///
+///
+bool toInexactPoint( const SFCGAL::Point& p, InexactPoint_2& q )
+{
+    BOOST_ASSERT( ! p.isEmpty() );
+    double x, y;
+
+    if ( ! toExactDouble( p.x(), x ) || ! toExactDouble( p.y(), y ) ) {
+        return false;
+    }
+
+    q = InexactPoint_2( x, y );
+    return true;
+}
+
+///
+///
+///
+bool toInexactPoint( const SFCGAL::Point& p, InexactPoint_3& q )
+{
+    BOOST_ASSERT( ! p.isEmpty() );
+    double x, y, z = 0.0;
+
+    if ( ! toExactDouble( p.x(), x ) || ! toExactDouble( p.y(), y ) ) {
+        return false;
+    }
+
+    if ( p.is3D() && ! toExactDouble( p.z(), z ) ) {
+        return false;
+    }
+
+    q = InexactPoint_3( x, y, z );
+    return true;
+}
+
+namespace { // anonymous
+
+//
+// Convert a LineString, skipping double points
+void _toInexactPoint( const CoordinateBuffer& c, size_t i, InexactPoint_2& q )
+{
+    q = InexactPoint_2( c.x( i ), c.y( i ) );
+}
+void _toInexactPoint( const CoordinateBuffer& c, size_t i, InexactPoint_3& q )
+{
+    q = InexactPoint_3( c.x( i ), c.y( i ), c.z( i ) );
+}
+
+template <class P>
+bool _toInexactPoints( const LineString& ls, std::vector<P>& points )
+{
+    // compact LineStrings already hold doubles
+    if ( const CoordinateBuffer* c = ls.coordinates() ) {
+        for ( size_t i = 0; i < c->size(); ++i ) {
+            P q;
+            _toInexactPoint( *c, i, q );
+
+            if ( points.empty() || points.back() != q ) {
+                points.push_back( q );
+            }
+        }
+
+        return true;
+    }
+
+    for ( size_t i = 0; i < ls.numPoints(); ++i ) {
+        P q;
+
+        if ( ! toInexactPoint( ls.pointN( i ), q ) ) {
+            return false;
+        }
+
+        if ( points.empty() || points.back() != q ) {
+            points.push_back( q );
+        }
+    }
+
+    return true;
+}
+
+} // anonymous namespace
+
+///
+///
+///
+bool toInexactPoints( const LineString& ls, std::vector<InexactPoint_2>& points )
+{
+    return _toInexactPoints( ls, points );
+}
+
+///
+///
+///
+bool toInexactPoints( const LineString& ls, std::vector<InexactPoint_3>& points )
+{
+    return _toInexactPoints( ls, points );
+}
+
+namespace { // anonymous
+
+//
+// Convert a ring, skipping the last point like LineString::toPolygon_2
+bool _toInexactRing( const LineString& ring, InexactPolygon_2& out )
+{
+    std::vector<InexactPoint_2> points;
+
+    if ( ! _toInexactPoints( ring, points ) ) {
+        return false;
+    }
+
+    if ( points.size() > 1 && points.front() == points.back() ) {
+        points.pop_back();
+    }
+
+    out = InexactPolygon_2( points.begin(), points.end() );
+    return true;
+}
+
+template <class Segment, class P>
+void _decompose_points( const std::vector<P>& points, std::vector<P>& outPoints, std::vector<Segment>& outSegments )
+{
+    if ( points.size() == 1 ) {
+        outPoints.push_back( points.front() );
+        return;
+    }
+
+    for ( size_t i = 0; i + 1 < points.size(); ++i ) {
+        outSegments.push_back( Segment( points[i], points[i+1] ) );
+    }
+}
+
+bool _decompose_triangle( const Triangle& tri, InexactGeometrySet<2>::PointCollection&,
+                          InexactGeometrySet<2>::SegmentCollection&,
+                          InexactGeometrySet<2>::SurfaceCollection& surfaces )
+{
+    InexactPoint_2 p[3];
+
+    for ( int i = 0; i < 3; ++i ) {
+        if ( ! toInexactPoint( tri.vertex( i ), p[i] ) ) {
+            return false;
+        }
+    }
+
+    surfaces.push_back( InexactPolygon_with_holes_2( InexactPolygon_2( p, p+3 ) ) );
+    return true;
+}
+bool _decompose_triangle( const Triangle& tri, InexactGeometrySet<3>::PointCollection& points,
+                          InexactGeometrySet<3>::SegmentCollection& segments,
+                          InexactGeometrySet<3>::SurfaceCollection& surfaces )
+{
+    InexactPoint_3 p[3];
+
+    for ( int i = 0; i < 3; ++i ) {
+        if ( ! toInexactPoint( tri.vertex( i ), p[i] ) ) {
+            return false;
+        }
+    }
+
+    const InexactTriangle_3 t( p[0], p[1], p[2] );
+
+    if ( ! t.is_degenerate() ) {
+        surfaces.push_back( t );
+        return true;
+    }
+
+    // CGAL predicates on triangles expect non degenerate triangles
+    std::vector<InexactPoint_3> ring( p, p+3 );
+    ring.push_back( p[0] );
+    ring.erase( std::unique( ring.begin(), ring.end() ), ring.end() );
+    _decompose_points( ring, points, segments );
+    return true;
+}
+
+bool _decompose_polygon( const Polygon& poly, InexactGeometrySet<2>::PointCollection&,
+                         InexactGeometrySet<2>::SegmentCollection&,
+                         InexactGeometrySet<2>::SurfaceCollection& surfaces,
+                         dim_t<2> )
+{
+    InexactPolygon_2 outer;
+
+    if ( ! _toInexactRing( poly.exteriorRing(), outer ) ) {
+        return false;
+    }
+
+    std::vector<InexactPolygon_2> holes( poly.numInteriorRings() );
+
+    for ( size_t i = 0; i < poly.numInteriorRings(); ++i ) {
+        if ( ! _toInexactRing( poly.interiorRingN( i ), holes[i] ) ) {
+            return false;
+        }
+    }
+
+    surfaces.push_back( InexactPolygon_with_holes_2( outer, holes.begin(), holes.end() ) );
+    return true;
+}
+bool _decompose_polygon( const Polygon& poly, InexactGeometrySet<3>::PointCollection& points,
+                         InexactGeometrySet<3>::SegmentCollection& segments,
+                         InexactGeometrySet<3>::SurfaceCollection& surfaces,
+                         dim_t<3> )
+{
+    // avoid a useless triangulation if the polygon can't be mirrored
+    for ( size_t r = 0; r < poly.numRings(); ++r ) {
+        std::vector<InexactPoint_3> ring;
+
+        if ( ! _toInexactPoints( poly.ringN( r ), ring ) ) {
+            return false;
+        }
+    }
+
+    // same decomposition as GeometrySet<3>, triangulation points are polygon points
+    TriangulatedSurface surf;
+    triangulate::triangulatePolygon3D( poly, surf );
+
+    for ( size_t i = 0; i < surf.numTriangles(); ++i ) {
+        if ( ! _decompose_triangle( surf.triangleN( i ), points, segments, surfaces ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // anonymous namespace
+
+template <int Dim>
+InexactGeometrySet<Dim>::InexactGeometrySet()
+{
+}
+
+template <int Dim>
+bool InexactGeometrySet<Dim>::build( const Geometry& g )
+{
+    clear();
+
+    if ( ! _decompose( g ) ) {
+        clear();
+        return false;
+    }
+
+    return true;
+}
+
+template <int Dim>
+void InexactGeometrySet<Dim>::clear()
+{
+    _points.clear();
+    _segments.clear();
+    _surfaces.clear();
+}
+
+template <int Dim>
+bool InexactGeometrySet<Dim>::isEmpty() const
+{
+    return _points.empty() && _segments.empty() && _surfaces.empty();
+}
+
+template <int Dim>
+bool InexactGeometrySet<Dim>::_decompose( const Geometry& g )
+{
+    if ( g.isEmpty() ) {
+        return true;
+    }
+
+    if ( g.is<GeometryCollection>() ) {
+        for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+            if ( ! _decompose( g.geometryN( i ) ) ) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    switch ( g.geometryTypeId() ) {
+    case TYPE_POINT: {
+        Point p;
+
+        if ( ! toInexactPoint( g.as<SFCGAL::Point>(), p ) ) {
+            return false;
+        }
+
+        _points.push_back( p );
+        return true;
+    }
+
+    case TYPE_LINESTRING: {
+        std::vector<Point> points;
+
+        if ( ! _toInexactPoints( g.as<LineString>(), points ) ) {
+            return false;
+        }
+
+        _decompose_points( points, _points, _segments );
+        return true;
+    }
+
+    case TYPE_TRIANGLE:
+        return _decompose_triangle( g.as<Triangle>(), _points, _segments, _surfaces );
+
+    case TYPE_POLYGON:
+        return _decompose_polygon( g.as<Polygon>(), _points, _segments, _surfaces, dim_t<Dim>() );
+
+    case TYPE_TRIANGULATEDSURFACE:
+    case TYPE_POLYHEDRALSURFACE: {
+        for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+            if ( ! _decompose( g.geometryN( i ) ) ) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    default:
+        // volumes are only handled by the exact GeometrySet
+        return false;
+    }
+}
+
+template <int Dim>
+void InexactGeometrySet<Dim>::computeBoundingBoxes( HandleCollection& handles, BoxCollection& boxes ) const
+{
+    boxes.clear();
+
+    for ( typename PointCollection::const_iterator it = _points.begin(); it != _points.end(); ++it ) {
+        handles.push_back( InexactPrimitiveHandle<Dim>( &( *it ) ) );
+        boxes.push_back( typename InexactPrimitiveBox<Dim>::Type( it->bbox(), &handles.back() ) );
+    }
+
+    for ( typename SegmentCollection::const_iterator it = _segments.begin(); it != _segments.end(); ++it ) {
+        handles.push_back( InexactPrimitiveHandle<Dim>( &( *it ) ) );
+        boxes.push_back( typename InexactPrimitiveBox<Dim>::Type( it->bbox(), &handles.back() ) );
+    }
+
+    for ( typename SurfaceCollection::const_iterator it = _surfaces.begin(); it != _surfaces.end(); ++it ) {
+        handles.push_back( InexactPrimitiveHandle<Dim>( &( *it ) ) );
+        boxes.push_back( typename InexactPrimitiveBox<Dim>::Type( it->bbox(), &handles.back() ) );
+    }
+}
+
+template class InexactGeometrySet<2>;
+template class InexactGeometrySet<3>;
+
+} // namespace detail
+
+namespace algorithm {
+
+using namespace SFCGAL::detail;
+
+namespace { // anonymous
+
+//
+// Primitive tests, the same as the ones of intersects.cpp on GeometrySet.
+// The first argument is the primitive of larger dimension.
+
+bool _intersects( const InexactPoint_2& a, const InexactPoint_2& b )
+{
+    return a == b;
+}
+bool _intersects( const InexactSegment_2& seg, const InexactPoint_2& pt )
+{
+    return seg.has_on( pt );
+}
+bool _intersects( const InexactSegment_2& seg1, const InexactSegment_2& seg2 )
+{
+    return CGAL::do_intersect( seg1, seg2 );
+}
+bool _intersects( const InexactPolygon_with_holes_2& poly, const InexactPoint_2& pt )
+{
+    const CGAL::Bounded_side b1 = poly.outer_boundary().bounded_side( pt );
+
+    if ( b1 == CGAL::ON_BOUNDARY ) {
+        return true;
+    }
+
+    if ( b1 == CGAL::ON_UNBOUNDED_SIDE ) {
+        return false;
+    }
+
+    for ( InexactPolygon_with_holes_2::Hole_const_iterator it = poly.holes_begin(); it != poly.holes_end(); ++it ) {
+        if ( it->bounded_side( pt ) == CGAL::ON_BOUNDED_SIDE ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool _intersectsRing( const InexactPolygon_2& ring, const InexactSegment_2& seg )
+{
+    for ( InexactPolygon_2::Edge_const_iterator it = ring.edges_begin(); it != ring.edges_end(); ++it ) {
+        if ( CGAL::do_intersect( *it, seg ) ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool _intersects( const InexactPolygon_with_holes_2& poly, const InexactSegment_2& seg )
+{
+    // 1. if the segment intersects a boundary of the polygon, returns true
+    // 2. else, if one of the point of the segment intersects the polygon, returns true
+    if ( _intersectsRing( poly.outer_boundary(), seg ) ) {
+        return true;
+    }
+
+    for ( InexactPolygon_with_holes_2::Hole_const_iterator it = poly.holes_begin(); it != poly.holes_end(); ++it ) {
+        if ( _intersectsRing( *it, seg ) ) {
+            return true;
+        }
+    }
+
+    return _intersects( poly, seg.source() );
+}
+
+//
+// Is pt inside one of poly's holes ?
+bool _inHoles( const InexactPolygon_with_holes_2& poly, const InexactPoint_2& pt )
+{
+    for ( InexactPolygon_with_holes_2::Hole_const_iterator it = poly.holes_begin(); it != poly.holes_end(); ++it ) {
+        if ( it->bounded_side( pt ) == CGAL::ON_BOUNDED_SIDE ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool _intersects( const InexactPolygon_with_holes_2& poly1, const InexactPolygon_with_holes_2& poly2 )
+{
+    // 1. if rings intersects, returns true
+    // 2. else, if poly1 is inside poly2 or poly1 inside poly2 (but not in holes), returns true
+    std::vector<InexactSegment_2> rings2( poly2.outer_boundary().edges_begin(), poly2.outer_boundary().edges_end() );
+
+    for ( InexactPolygon_with_holes_2::Hole_const_iterator it = poly2.holes_begin(); it != poly2.holes_end(); ++it ) {
+        rings2.insert( rings2.end(), it->edges_begin(), it->edges_end() );
+    }
+
+    for ( std::vector<InexactSegment_2>::const_iterator it = rings2.begin(); it != rings2.end(); ++it ) {
+        if ( _intersectsRing( poly1.outer_boundary(), *it ) ) {
+            return true;
+        }
+
+        for ( InexactPolygon_with_holes_2::Hole_const_iterator hit = poly1.holes_begin(); hit != poly1.holes_end(); ++hit ) {
+            if ( _intersectsRing( *hit, *it ) ) {
+                return true;
+            }
+        }
+    }
+
+    // 2.
+    const CGAL::Bbox_2 box1 = poly1.bbox();
+    const CGAL::Bbox_2 box2 = poly2.bbox();
+    Envelope e1( box1.xmin(), box1.xmax(), box1.ymin(), box1.ymax() );
+    Envelope e2( box2.xmin(), box2.xmax(), box2.ymin(), box2.ymax() );
+
+    // if pa is inside pb
+    if ( Envelope::contains( e2, e1 ) ) {
+        return ! _inHoles( poly2, *poly1.outer_boundary().vertices_begin() );
+    }
+
+    // if pb is inside pa
+    if ( Envelope::contains( e1, e2 ) ) {
+        return ! _inHoles( poly1, *poly2.outer_boundary().vertices_begin() );
+    }
+
+    return false;
+}
+
+bool _intersects( const InexactPoint_3& a, const InexactPoint_3& b )
+{
+    return a == b;
+}
+bool _intersects( const InexactSegment_3& seg, const InexactPoint_3& pt )
+{
+    return seg.has_on( pt );
+}
+bool _intersects( const InexactSegment_3& seg1, const InexactSegment_3& seg2 )
+{
+    return CGAL::do_intersect( seg1, seg2 );
+}
+bool _intersects( const InexactTriangle_3& tri, const InexactPoint_3& pt )
+{
+    return tri.has_on( pt );
+}
+bool _intersects( const InexactTriangle_3& tri, const InexactSegment_3& seg )
+{
+    return CGAL::do_intersect( tri, seg );
+}
+bool _intersects( const InexactTriangle_3& tri1, const InexactTriangle_3& tri2 )
+{
+    return CGAL::do_intersect( tri1, tri2 );
+}
+
+//
+// Symmetric calls
+template <class X, class Y>
+bool _intersects( const X& a, const Y& b )
+{
+    return _intersects( b, a );
+}
+
+struct inexact_intersects_visitor : public boost::static_visitor<bool> {
+    template <class X, class Y>
+    bool operator()( const X* a, const Y* b ) const {
+        return _intersects( *a, *b );
+    }
+};
+
+template <int Dim>
+struct inexact_intersects_cb {
+    bool operator()( const typename InexactPrimitiveBox<Dim>::Type& a,
+                     const typename InexactPrimitiveBox<Dim>::Type& b ) const {
+        return boost::apply_visitor( inexact_intersects_visitor(), a.handle()->handle, b.handle()->handle );
+    }
+};
+
+} // anonymous namespace
+
+template <int Dim>
+bool intersects( const InexactGeometrySet<Dim>& a, const InexactGeometrySet<Dim>& b )
+{
+    typename InexactGeometrySet<Dim>::HandleCollection ahandles, bhandles;
+    typename InexactGeometrySet<Dim>::BoxCollection aboxes, bboxes;
+    a.computeBoundingBoxes( ahandles, aboxes );
+    b.computeBoundingBoxes( bhandles, bboxes );
+
+    return box_intersection_until( aboxes.begin(), aboxes.end(),
+                                   bboxes.begin(), bboxes.end(),
+                                   inexact_intersects_cb<Dim>() );
+}
+
+namespace { // anonymous
+
+template <class Collection, class P>
+bool _intersectsAny( const Collection& primitives, const P& pt )
+{
+    for ( typename Collection::const_iterator it = primitives.begin(); it != primitives.end(); ++it ) {
+        if ( CGAL::do_overlap( it->bbox(), pt.bbox() ) && _intersects( *it, pt ) ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // anonymous namespace
+
+template <int Dim>
+bool intersects( const InexactGeometrySet<Dim>& a, const typename InexactTypeForDimension<Dim>::Point& pt )
+{
+    return _intersectsAny( a.points(), pt )
+           || _intersectsAny( a.segments(), pt )
+           || _intersectsAny( a.surfaces(), pt );
+}
+
+namespace { // anonymous
+
+//
+// Squared distances between primitives
+
+double _squaredDistance( const InexactPoint_2& a, const InexactPoint_2& b )
+{
+    return CGAL::squared_distance( a, b );
+}
+double _squaredDistance( const InexactSegment_2& a, const InexactPoint_2& b )
+{
+    return CGAL::squared_distance( a, b );
+}
+double _squaredDistance( const InexactSegment_2& a, const InexactSegment_2& b )
+{
+    return CGAL::squared_distance( a, b );
+}
+
+double _squaredDistance( const InexactPoint_3& a, const InexactPoint_3& b )
+{
+    return CGAL::squared_distance( a, b );
+}
+double _squaredDistance( const InexactSegment_3& a, const InexactPoint_3& b )
+{
+    return CGAL::squared_distance( a, b );
+}
+double _squaredDistance( const InexactSegment_3& a, const InexactSegment_3& b )
+{
+    return CGAL::squared_distance( a, b );
+}
+double _squaredDistance( const InexactTriangle_3& abc, const InexactPoint_3& p )
+{
+#if  CGAL_VERSION_NR >= 1041001000 // >= 4.10
+    return CGAL::squared_distance( p, abc );
+#else
+    const InexactPoint_3 projP = InexactPlane_3( abc.vertex( 0 ), abc.vertex( 1 ), abc.vertex( 2 ) ).projection( p );
+
+    if ( abc.has_on( projP ) ) {
+        return CGAL::squared_distance( p, projP ) ;
+    }
+
+    double dMin = CGAL::squared_distance( p, InexactSegment_3( abc.vertex( 0 ), abc.vertex( 1 ) ) ) ;
+    dMin = std::min( dMin, CGAL::squared_distance( p, InexactSegment_3( abc.vertex( 1 ), abc.vertex( 2 ) ) ) );
+    dMin = std::min( dMin, CGAL::squared_distance( p, InexactSegment_3( abc.vertex( 2 ), abc.vertex( 0 ) ) ) );
+    return dMin ;
+#endif
+}
+double _squaredDistance( const InexactTriangle_3& tABC, const InexactSegment_3& sAB )
+{
+    if ( CGAL::do_intersect( sAB, tABC ) ) {
+        return 0.0 ;
+    }
+
+    double dMin = _squaredDistance( tABC, sAB.vertex( 0 ) );
+    dMin = std::min( dMin, _squaredDistance( tABC, sAB.vertex( 1 ) ) );
+
+    for ( int i = 0; i < 3; i++ ) {
+        dMin = std::min( dMin, CGAL::squared_distance( sAB, InexactSegment_3( tABC.vertex( i ), tABC.vertex( i+1 ) ) ) ) ;
+    }
+
+    return dMin ;
+}
+double _squaredDistance( const InexactTriangle_3& triangleA, const InexactTriangle_3& triangleB )
+{
+    if ( CGAL::do_intersect( triangleA, triangleB ) ) {
+        return 0.0 ;
+    }
+
+    double dMin = std::numeric_limits< double >::infinity() ;
+
+    for ( int i = 0; i < 3; i++ ) {
+        dMin = std::min( dMin, _squaredDistance( triangleB, InexactSegment_3( triangleA.vertex( i ), triangleA.vertex( i+1 ) ) ) );
+        dMin = std::min( dMin, _squaredDistance( triangleA, InexactSegment_3( triangleB.vertex( i ), triangleB.vertex( i+1 ) ) ) );
+    }
+
+    return dMin ;
+}
+
+//
+// Symmetric calls
+template <class X, class Y>
+double _squaredDistance( const X& a, const Y& b )
+{
+    return _squaredDistance( b, a );
+}
+
+//
+// distance from a primitive to the primitives of an indexed collection, for BoxTree::nearest
+template <int Dim, class X, class Y>
+struct primitive_distance_cb {
+    const std::vector<Y>& ys;
+    const X& x;
+
+    primitive_distance_cb( const std::vector<Y>& y, const X& q ) : ys( y ), x( q ) {}
+
+    double operator()( const IndexedBox<Dim>& box ) const {
+        return std::sqrt( _squaredDistance( x, ys[ box.index() ] ) );
+    }
+};
+
+//
+// Lower dMin to the minimum distance between xs and ys. Pairs further than dMin
+// are pruned with a box hierarchy on the larger collection.
+template <int Dim, class X, class Y>
+void _minDistance( const std::vector<X>& xs, const std::vector<Y>& ys, double& dMin )
+{
+    if ( xs.empty() || ys.empty() || dMin == 0.0 ) {
+        return;
+    }
+
+    if ( xs.size() * ys.size() <= BRUTE_FORCE_PAIRS ) {
+        for ( typename std::vector<X>::const_iterator x = xs.begin(); x != xs.end(); ++x ) {
+            for ( typename std::vector<Y>::const_iterator y = ys.begin(); y != ys.end(); ++y ) {
+                dMin = std::min( dMin, std::sqrt( _squaredDistance( *x, *y ) ) );
+            }
+        }
+
+        return;
+    }
+
+    if ( xs.size() > ys.size() ) {
+        _minDistance<Dim>( ys, xs, dMin );
+        return;
+    }
+
+    std::vector< IndexedBox<Dim> > boxes;
+    boxes.reserve( ys.size() );
+
+    for ( size_t i = 0; i < ys.size(); ++i ) {
+        boxes.push_back( IndexedBox<Dim>( ys[i].bbox(), i ) );
+    }
+
+    BoxTree< Dim, IndexedBox<Dim> > tree;
+    tree.build( boxes.begin(), boxes.end() );
+
+    for ( size_t i = 0; i < xs.size() && dMin > 0.0; ++i ) {
+        dMin = tree.nearest( IndexedBox<Dim>( xs[i].bbox(), i ), primitive_distance_cb<Dim, X, Y>( ys, xs[i] ), dMin );
+    }
+}
+
+//
+// In 2D, the distance is reached on the boundary of polygons
+void _boundarySegments( const InexactGeometrySet<2>& g, std::vector<InexactSegment_2>& segments )
+{
+    segments = g.segments();
+
+    for ( InexactGeometrySet<2>::SurfaceCollection::const_iterator it = g.surfaces().begin(); it != g.surfaces().end(); ++it ) {
+        segments.insert( segments.end(), it->outer_boundary().edges_begin(), it->outer_boundary().edges_end() );
+
+        for ( InexactPolygon_with_holes_2::Hole_const_iterator hit = it->holes_begin(); hit != it->holes_end(); ++hit ) {
+            segments.insert( segments.end(), hit->edges_begin(), hit->edges_end() );
+        }
+    }
+}
+
+//
+// Pairs further than maxDistance are pruned : the result is the distance if it is
+// lower or equal to maxDistance, a greater value otherwise.
+double _distance( const InexactGeometrySet<2>& a, const InexactGeometrySet<2>& b, const double& maxDistance )
+{
+    std::vector<InexactSegment_2> sa, sb;
+    _boundarySegments( a, sa );
+    _boundarySegments( b, sb );
+
+    double dMin = std::nextafter( maxDistance, std::numeric_limits< double >::infinity() ) ;
+    _minDistance<2>( a.points(), b.points(), dMin );
+    _minDistance<2>( a.points(), sb, dMin );
+    _minDistance<2>( sa, b.points(), dMin );
+    _minDistance<2>( sa, sb, dMin );
+    return dMin ;
+}
+
+double _distance( const InexactGeometrySet<3>& a, const InexactGeometrySet<3>& b, const double& maxDistance )
+{
+    double dMin = std::nextafter( maxDistance, std::numeric_limits< double >::infinity() ) ;
+    _minDistance<3>( a.points(), b.points(), dMin );
+    _minDistance<3>( a.points(), b.segments(), dMin );
+    _minDistance<3>( a.points(), b.surfaces(), dMin );
+    _minDistance<3>( a.segments(), b.points(), dMin );
+    _minDistance<3>( a.segments(), b.segments(), dMin );
+    _minDistance<3>( a.segments(), b.surfaces(), dMin );
+    _minDistance<3>( a.surfaces(), b.points(), dMin );
+    _minDistance<3>( a.surfaces(), b.segments(), dMin );
+    _minDistance<3>( a.surfaces(), b.surfaces(), dMin );
+    return dMin ;
+}
+
+//
+// Comparison of a double evaluation of the squared distance between two primitives
+// with d^2. The rounding error of the evaluation is bounded by a multiple of u.M^2,
+// where M is the largest absolute coordinate of the (inflated) primitive boxes, so
+// that pairs too close to the threshold are left to the exact evaluation.
+//
+// The squared distances between points, segments and triangles are evaluated with
+// a few dozen operations on coordinate differences (at most 2M) : 256.eps.M^2 is
+// a conservative bound on their rounding error.
+const double SQUARED_DISTANCE_ERROR = 256 * std::numeric_limits< double >::epsilon();
+
+template <int Dim>
+class SquaredDistanceThreshold {
+public:
+    SquaredDistanceThreshold( const double& d ) :
+        _squaredDistance( d * d ),
+        _uncertain( false ) {}
+
+    /**
+     * true if the primitives of boxes a and b at the (double) squared distance
+     * squaredDistance are certainly closer than d. Uncertain comparisons are recorded.
+     */
+    template <class BoxA, class BoxB>
+    bool isWithin( const double& squaredDistance, const BoxA& a, const BoxB& b ) {
+        double m = 0.0;
+
+        for ( int i = 0; i < Dim; ++i ) {
+            m = std::max( m, std::max( std::max( std::abs( a.min_coord( i ) ), std::abs( a.max_coord( i ) ) ),
+                                       std::max( std::abs( b.min_coord( i ) ), std::abs( b.max_coord( i ) ) ) ) );
+        }
+
+        // the factor 2 covers the rounding of d*d and of the bound itself
+        const double bound = SQUARED_DISTANCE_ERROR * m * m + 2 * std::numeric_limits< double >::epsilon() * _squaredDistance;
+
+        if ( ! std::isfinite( bound ) || ! std::isfinite( squaredDistance ) ) {
+            _uncertain = true;
+            return false;
+        }
+
+        if ( squaredDistance + bound <= _squaredDistance ) {
+            return true;
+        }
+
+        if ( squaredDistance - bound <= _squaredDistance ) {
+            _uncertain = true;
+        }
+
+        return false;
+    }
+
+    /**
+     * true if a comparison was too close to be decided
+     */
+    bool isUncertain() const {
+        return _uncertain;
+    }
+
+private:
+    double _squaredDistance;
+    bool   _uncertain;
+};
+
+//
+// true if a pair of primitives certainly closer than d is found, for box_intersection_until
+template <int Dim, class X, class Y>
+struct within_distance_cb {
+    const std::vector<X>& xs;
+    const std::vector<Y>& ys;
+    SquaredDistanceThreshold<Dim>& threshold;
+
+    within_distance_cb( const std::vector<X>& x, const std::vector<Y>& y, SquaredDistanceThreshold<Dim>& t ) : xs( x ), ys( y ), threshold( t ) {}
+
+    bool operator()( const InflatedBox<Dim>& a, const IndexedBox<Dim>& b ) const {
+        return threshold.isWithin( _squaredDistance( xs[ a.index() ], ys[ b.index() ] ), a, b );
+    }
+};
+
+//
+// true if a primitive of xs is certainly at a distance lower or equal to d from a
+// primitive of ys. Only the pairs with intersecting inflated boxes are compared.
+template <int Dim, class X, class Y>
+bool _withinDistance( const std::vector<X>& xs, const std::vector<Y>& ys, SquaredDistanceThreshold<Dim>& threshold, const double& d )
+{
+    if ( xs.empty() || ys.empty() ) {
+        return false;
+    }
+
+    std::vector< InflatedBox<Dim> > boxesX;
+    boxesX.reserve( xs.size() );
+
+    for ( size_t i = 0; i < xs.size(); ++i ) {
+        boxesX.push_back( InflatedBox<Dim>( IndexedBox<Dim>( xs[i].bbox(), i ), d, i ) );
+    }
+
+    std::vector< IndexedBox<Dim> > boxesY;
+    boxesY.reserve( ys.size() );
+
+    for ( size_t i = 0; i < ys.size(); ++i ) {
+        boxesY.push_back( IndexedBox<Dim>( ys[i].bbox(), i ) );
+    }
+
+    return box_intersection_until( boxesX.begin(), boxesX.end(), boxesY.begin(), boxesY.end(),
+                                   within_distance_cb<Dim, X, Y>( xs, ys, threshold ) );
+}
+
+//
+// distance threshold on geometries which do not intersect
+bool _withinDistance( const InexactGeometrySet<2>& a, const InexactGeometrySet<2>& b, SquaredDistanceThreshold<2>& t, const double& d )
+{
+    std::vector<InexactSegment_2> sa, sb;
+    _boundarySegments( a, sa );
+    _boundarySegments( b, sb );
+
+    return _withinDistance<2>( a.points(), b.points(), t, d )
+           || _withinDistance<2>( a.points(), sb, t, d )
+           || _withinDistance<2>( sa, b.points(), t, d )
+           || _withinDistance<2>( sa, sb, t, d );
+}
+
+bool _withinDistance( const InexactGeometrySet<3>& a, const InexactGeometrySet<3>& b, SquaredDistanceThreshold<3>& t, const double& d )
+{
+    return _withinDistance<3>( a.points(), b.points(), t, d )
+           || _withinDistance<3>( a.points(), b.segments(), t, d )
+           || _withinDistance<3>( a.points(), b.surfaces(), t, d )
+           || _withinDistance<3>( a.segments(), b.points(), t, d )
+           || _withinDistance<3>( a.segments(), b.segments(), t, d )
+           || _withinDistance<3>( a.segments(), b.surfaces(), t, d )
+           || _withinDistance<3>( a.surfaces(), b.points(), t, d )
+           || _withinDistance<3>( a.surfaces(), b.segments(), t, d )
+           || _withinDistance<3>( a.surfaces(), b.surfaces(), t, d );
+}
+
+} // anonymous namespace
+
+template <int Dim>
+double distance( const InexactGeometrySet<Dim>& a, const InexactGeometrySet<Dim>& b, const double& maxDistance )
+{
+    if ( a.isEmpty() || b.isEmpty() ) {
+        return std::numeric_limits< double >::infinity() ;
+    }
+
+    if ( intersects( a, b ) ) {
+        return 0.0 ;
+    }
+
+    return _distance( a, b, maxDistance );
+}
+
+template <int Dim>
+boost::tribool dWithin( const InexactGeometrySet<Dim>& a, const InexactGeometrySet<Dim>& b, const double& d )
+{
+    if ( a.isEmpty() || b.isEmpty() || ! ( d >= 0.0 ) ) {
+        return false;
+    }
+
+    // primitive boxes of a inflated by d are disjoint from the boxes of b
+    {
+        typename InexactGeometrySet<Dim>::HandleCollection handlesA, handlesB;
+        typename InexactGeometrySet<Dim>::BoxCollection boxesA, boxesB;
+        a.computeBoundingBoxes( handlesA, boxesA );
+        b.computeBoundingBoxes( handlesB, boxesB );
+
+        if ( ! inflated_boxes_intersect<Dim>( boxesA.begin(), boxesA.end(), boxesB.begin(), boxesB.end(), d ) ) {
+            return false;
+        }
+    }
+
+    if ( intersects( a, b ) ) {
+        return true;
+    }
+
+    SquaredDistanceThreshold<Dim> threshold( d );
+
+    if ( _withinDistance( a, b, threshold, d ) ) {
+        return true;
+    }
+
+    if ( threshold.isUncertain() ) {
+        return boost::indeterminate;
+    }
+
+    return false;
+}
+
+template bool intersects<2>( const InexactGeometrySet<2>& a, const InexactGeometrySet<2>& b );
+template bool intersects<3>( const InexactGeometrySet<3>& a, const InexactGeometrySet<3>& b );
+
+template bool intersects<2>( const InexactGeometrySet<2>& a, const InexactTypeForDimension<2>::Point& pt );
+template bool intersects<3>( const InexactGeometrySet<3>& a, const InexactTypeForDimension<3>::Point& pt );
+
+template double distance<2>( const InexactGeometrySet<2>& a, const InexactGeometrySet<2>& b, const double& maxDistance );
+template double distance<3>( const InexactGeometrySet<3>& a, const InexactGeometrySet<3>& b, const double& maxDistance );
+
+template boost::tribool dWithin<2>( const InexactGeometrySet<2>& a, const InexactGeometrySet<2>& b, const double& d );
+template boost::tribool dWithin<3>( const InexactGeometrySet<3>& a, const InexactGeometrySet<3>& b, const double& d );
+
+} // namespace algorithm
+} // namespace SFCGAL
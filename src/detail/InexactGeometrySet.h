@@ -0,0 +1,222 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_INEXACT_GEOMETRY_SET_H_
+#define _SFCGAL_DETAIL_INEXACT_GEOMETRY_SET_H_
+
+#include <limits>
+#include <list>
+#include <vector>
+
+#include <boost/logic/tribool.hpp>
+#include <boost/variant.hpp>
+
+#include <SFCGAL/config.h>
+
+#include <SFCGAL/Kernel.h>
+
+#include <CGAL/Bbox_2.h>
+#include <CGAL/Bbox_3.h>
+#include <CGAL/Polygon_with_holes_2.h>
+#include <CGAL/Box_intersection_d/Box_with_handle_d.h>
+
+namespace SFCGAL {
+class Geometry;
+class Point;
+class LineString;
+namespace detail {
+
+///
+/// Double precision counterpart of TypeForDimension, built on InexactKernel
+template <int Dim>
+struct InexactTypeForDimension {
+    typedef CGAL::Bbox_2                               Bbox;
+    typedef InexactKernel::Point_2                     Point;
+    typedef InexactKernel::Segment_2                   Segment;
+    typedef CGAL::Polygon_with_holes_2<InexactKernel>  Surface;
+};
+
+template <>
+struct InexactTypeForDimension<3> {
+    typedef CGAL::Bbox_3                               Bbox;
+    typedef InexactKernel::Point_3                     Point;
+    typedef InexactKernel::Segment_3                   Segment;
+    typedef InexactKernel::Triangle_3                  Surface;
+};
+
+///
+/// Handle on a primitive of an InexactGeometrySet
+template <int Dim>
+struct InexactPrimitiveHandle {
+    typedef boost::variant< const typename InexactTypeForDimension<Dim>::Point*,
+            const typename InexactTypeForDimension<Dim>::Segment*,
+            const typename InexactTypeForDimension<Dim>::Surface* > Type;
+    Type handle;
+
+    template <class T>
+    InexactPrimitiveHandle( const T* p ) : handle( p ) {}
+
+    template <class T>
+    inline const T* as() const {
+        return boost::get<const T*>( handle );
+    }
+};
+
+///
+/// InexactPrimitiveBox. Type used for CGAL::Box_intersection_d
+template <int Dim>
+struct InexactPrimitiveBox {
+    typedef CGAL::Box_intersection_d::Box_with_handle_d<double, Dim, const InexactPrimitiveHandle<Dim>*> Type;
+};
+
+/**
+ * Double precision mirror of a Geometry.
+ *
+ * It is the GeometrySet<Dim> counterpart used by algorithms that only evaluate
+ * predicates or return a double (intersects, distance, coversPoints). Predicates
+ * are still exact (InexactKernel is a filtered kernel), but coordinates are plain
+ * doubles instead of lazy exact numbers.
+ *
+ * A mirror can only be built if every coordinate of the geometry is exactly
+ * representable by a double (so that the answer is the same as with Kernel) and if
+ * the geometry has no volume. build() returns false otherwise and the caller
+ * has to use the exact GeometrySet<Dim>.
+ */
+template <int Dim>
+class SFCGAL_API InexactGeometrySet {
+public:
+    typedef typename InexactTypeForDimension<Dim>::Point   Point;
+    typedef typename InexactTypeForDimension<Dim>::Segment Segment;
+    typedef typename InexactTypeForDimension<Dim>::Surface Surface;
+
+    typedef std::vector<Point>   PointCollection;
+    typedef std::vector<Segment> SegmentCollection;
+    typedef std::vector<Surface> SurfaceCollection;
+
+    typedef std::list< InexactPrimitiveHandle<Dim> >                 HandleCollection;
+    typedef std::vector< typename InexactPrimitiveBox<Dim>::Type >   BoxCollection;
+
+    InexactGeometrySet();
+
+    /**
+     * Build the mirror of g.
+     * @return false if g cannot be mirrored (the set is then left empty)
+     */
+    bool build( const Geometry& g );
+
+    /**
+     * Remove every primitive
+     */
+    void clear();
+
+    /**
+     * true if the set has no primitive
+     */
+    bool isEmpty() const;
+
+    const PointCollection& points() const {
+        return _points;
+    }
+    const SegmentCollection& segments() const {
+        return _segments;
+    }
+    const SurfaceCollection& surfaces() const {
+        return _surfaces;
+    }
+
+    /**
+     * Compute bounding boxes of every primitive
+     * @note handles must outlive boxes
+     */
+    void computeBoundingBoxes( HandleCollection& handles, BoxCollection& boxes ) const;
+
+private:
+    bool _decompose( const Geometry& g );
+
+    PointCollection   _points;
+    SegmentCollection _segments;
+    SurfaceCollection _surfaces;
+};
+
+/**
+ * Convert a Kernel number to a double.
+ * @return false if v is not exactly representable by a double
+ */
+SFCGAL_API bool toExactDouble( const Kernel::FT& v, double& d );
+
+/**
+ * Convert a Point to its InexactKernel counterpart.
+ * @return false if a coordinate is not exactly representable by a double
+ * @pre p is not empty
+ */
+SFCGAL_API bool toInexactPoint( const SFCGAL::Point& p, InexactKernel::Point_2& q );
+SFCGAL_API bool toInexactPoint( const SFCGAL::Point& p, InexactKernel::Point_3& q );
+
+/**
+ * Convert the points of a LineString to their InexactKernel counterpart,
+ * skipping consecutive double points.
+ * @return false if a coordinate is not exactly representable by a double
+ */
+SFCGAL_API bool toInexactPoints( const LineString& ls, std::vector<InexactKernel::Point_2>& points );
+SFCGAL_API bool toInexactPoints( const LineString& ls, std::vector<InexactKernel::Point_3>& points );
+
+} // namespace detail
+
+namespace algorithm {
+
+/**
+ * Intersection test on InexactGeometrySet
+ * @ingroup detail
+ */
+template <int Dim>
+bool intersects( const detail::InexactGeometrySet<Dim>& a, const detail::InexactGeometrySet<Dim>& b );
+
+/**
+ * Intersection test between an InexactGeometrySet and a point
+ * @ingroup detail
+ */
+template <int Dim>
+bool intersects( const detail::InexactGeometrySet<Dim>& a, const typename detail::InexactTypeForDimension<Dim>::Point& p );
+
+/**
+ * Distance between two InexactGeometrySet (infinity if one of them is empty).
+ * Pairs of primitives further than maxDistance are not evaluated.
+ *
+ * @return the distance if it is lower or equal to maxDistance, a value greater than maxDistance otherwise
+ * @ingroup detail
+ */
+template <int Dim>
+double distance( const detail::InexactGeometrySet<Dim>& a, const detail::InexactGeometrySet<Dim>& b,
+                 const double& maxDistance = std::numeric_limits<double>::infinity() );
+
+/**
+ * true if the distance between a and b is lower or equal to d (false if one of them is empty).
+ *
+ * Distances are evaluated with doubles : indeterminate is returned when the distance
+ * is too close to d to decide, the caller then has to use the exact GeometrySet<Dim>.
+ * @ingroup detail
+ */
+template <int Dim>
+boost::tribool dWithin( const detail::InexactGeometrySet<Dim>& a, const detail::InexactGeometrySet<Dim>& b, const double& d );
+
+} // namespace algorithm
+} // namespace SFCGAL
+
+#endif
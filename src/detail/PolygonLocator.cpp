@@ -0,0 +1,153 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/PolygonLocator.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace SFCGAL {
+namespace detail {
+
+namespace {
+template <class Ring, class OutputIterator>
+void ringEdges( const Ring& ring, OutputIterator out )
+{
+    for ( typename Ring::Edge_const_iterator it = ring.edges_begin(); it != ring.edges_end(); ++it ) {
+        if ( ! it->is_degenerate() ) {
+            *out++ = *it;
+        }
+    }
+}
+}
+
+///
+///
+///
+PolygonLocator::PolygonLocator( const Polygon_with_holes_2& polygon )
+{
+    std::back_insert_iterator< std::vector< Kernel::Segment_2 > > out( _edges );
+    ringEdges( polygon.outer_boundary(), out );
+
+    for ( Polygon_with_holes_2::Hole_const_iterator hit = polygon.holes_begin(); hit != polygon.holes_end(); ++hit ) {
+        ringEdges( *hit, out );
+    }
+
+    if ( _edges.empty() ) {
+        return;
+    }
+
+    _bbox = _edges[0].bbox();
+
+    for ( size_t i = 1; i < _edges.size(); ++i ) {
+        _bbox = _bbox + _edges[i].bbox();
+    }
+
+    // about sqrt(n) edges per band
+    _bands.resize( std::max( size_t( 1 ), size_t( std::sqrt( double( _edges.size() ) ) ) ) );
+
+    for ( size_t i = 0; i < _edges.size(); ++i ) {
+        const CGAL::Bbox_2 box = _edges[i].bbox();
+        const size_t last = _band( box.ymax() );
+
+        for ( size_t b = _band( box.ymin() ); b <= last; ++b ) {
+            _bands[b].push_back( i );
+        }
+    }
+}
+
+///
+///
+///
+size_t PolygonLocator::_band( const double& y ) const
+{
+    const double height = _bbox.ymax() - _bbox.ymin();
+
+    if ( height <= 0.0 || y <= _bbox.ymin() ) {
+        return 0;
+    }
+
+    const size_t b = size_t( ( y - _bbox.ymin() ) / height * _bands.size() );
+    return std::min( b, _bands.size() - 1 );
+}
+
+///
+///
+///
+CGAL::Bounded_side PolygonLocator::locate( const Kernel::Point_2& p ) const
+{
+    if ( _edges.empty() ) {
+        return CGAL::ON_UNBOUNDED_SIDE;
+    }
+
+    // the nearest double of a coordinate is in the double bounding box of any
+    // edge that contains the coordinate, so that every edge crossing the horizontal
+    // line through p is in the band of p
+    const double x = CGAL::to_double( p.x() );
+    const double y = CGAL::to_double( p.y() );
+
+    if ( x < _bbox.xmin() || x > _bbox.xmax() || y < _bbox.ymin() || y > _bbox.ymax() ) {
+        return CGAL::ON_UNBOUNDED_SIDE;
+    }
+
+    const std::vector< size_t >& band = _bands[ _band( y ) ];
+    bool inside = false;
+
+    for ( std::vector< size_t >::const_iterator it = band.begin(); it != band.end(); ++it ) {
+        const Kernel::Point_2& a = _edges[*it].source();
+        const Kernel::Point_2& b = _edges[*it].target();
+
+        const CGAL::Comparison_result ca = CGAL::compare_y( a, p );
+        const CGAL::Comparison_result cb = CGAL::compare_y( b, p );
+
+        if ( ca == CGAL::SMALLER && cb == CGAL::SMALLER ) {
+            continue;
+        }
+
+        if ( ca == CGAL::LARGER && cb == CGAL::LARGER ) {
+            continue;
+        }
+
+        const CGAL::Orientation o = CGAL::orientation( a, b, p );
+
+        if ( o == CGAL::COLLINEAR ) {
+            if ( CGAL::collinear_are_ordered_along_line( a, p, b ) ) {
+                return CGAL::ON_BOUNDARY;
+            }
+
+            continue;
+        }
+
+        // half open rule on y : an edge crosses the ray going to +x if one end
+        // is strictly above p and the other one is not
+        if ( ( ca == CGAL::LARGER ) == ( cb == CGAL::LARGER ) ) {
+            continue;
+        }
+
+        // upward edge with p on its left, or downward edge with p on its right
+        if ( ( cb == CGAL::LARGER ) == ( o == CGAL::LEFT_TURN ) ) {
+            inside = ! inside;
+        }
+    }
+
+    return inside ? CGAL::ON_BOUNDED_SIDE : CGAL::ON_UNBOUNDED_SIDE;
+}
+
+} // namespace detail
+} // namespace SFCGAL
@@ -0,0 +1,65 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_POLYGON_LOCATOR_H_
+#define _SFCGAL_DETAIL_POLYGON_LOCATOR_H_
+
+#include <vector>
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/Kernel.h>
+
+#include <CGAL/Polygon_with_holes_2.h>
+
+namespace SFCGAL {
+namespace detail {
+
+/**
+ * Point location in a polygon with holes, for repeated queries.
+ *
+ * Edges of every ring are bucketed in horizontal bands, so that the crossing number
+ * test of a point only looks at the edges of its band instead of every edge.
+ * Predicates are evaluated on Kernel, band selection only uses the (conservative)
+ * double bounding boxes of the edges.
+ *
+ * @ingroup detail
+ */
+class SFCGAL_API PolygonLocator {
+public:
+    typedef CGAL::Polygon_with_holes_2<Kernel> Polygon_with_holes_2;
+
+    PolygonLocator( const Polygon_with_holes_2& polygon ) ;
+
+    /**
+     * position of p relative to the polygon
+     */
+    CGAL::Bounded_side locate( const Kernel::Point_2& p ) const ;
+
+private:
+    size_t _band( const double& y ) const ;
+
+    std::vector< Kernel::Segment_2 >     _edges ;
+    std::vector< std::vector< size_t > > _bands ;
+    CGAL::Bbox_2                         _bbox ;
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
@@ -0,0 +1,258 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/PreparedIndex.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/triangulate/triangulateInGeometrySet.h>
+#include <SFCGAL/detail/SolidLocator.h>
+
+namespace SFCGAL {
+namespace detail {
+
+namespace {
+
+const Geometry& validGeometry( const Geometry& g, dim_t<2> )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+    return g;
+}
+
+const Geometry& validGeometry( const Geometry& g, dim_t<3> )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( g );
+    return g;
+}
+
+void buildLocators( const GeometrySet<2>& set,
+                    GeometrySet<2>& /*volumeTriangles*/,
+                    std::map< const void*, std::shared_ptr<PolygonLocator> >& polygonLocators )
+{
+    for ( GeometrySet<2>::SurfaceCollection::const_iterator it = set.surfaces().begin();
+            it != set.surfaces().end(); ++it ) {
+        polygonLocators[ &it->primitive() ] = std::make_shared<PolygonLocator>( it->primitive() );
+    }
+}
+
+void buildLocators( const GeometrySet<3>& set,
+                    GeometrySet<3>& volumeTriangles,
+                    std::map< const void*, std::shared_ptr<PolygonLocator> >& /*polygonLocators*/ )
+{
+    // points are located in the solids with the SolidLocator
+    for ( GeometrySet<3>::VolumeCollection::const_iterator it = set.volumes().begin();
+            it != set.volumes().end(); ++it ) {
+        triangulate::triangulate( it->primitive(), volumeTriangles );
+    }
+}
+
+bool locateInSurface( const std::map< const void*, std::shared_ptr<PolygonLocator> >& polygonLocators,
+                      const CGAL::Polygon_with_holes_2<Kernel>& surface,
+                      const Kernel::Point_2& p )
+{
+    std::map< const void*, std::shared_ptr<PolygonLocator> >::const_iterator it = polygonLocators.find( &surface );
+    BOOST_ASSERT( it != polygonLocators.end() );
+    return it->second->locate( p ) != CGAL::ON_UNBOUNDED_SIDE;
+}
+
+bool locateInSurface( const std::map< const void*, std::shared_ptr<PolygonLocator> >& /*polygonLocators*/,
+                      const Kernel::Triangle_3& surface,
+                      const Kernel::Point_3& p )
+{
+    return surface.has_on( p );
+}
+
+bool insideVolumes( const SolidLocator* /*solids*/, const Kernel::Point_2& )
+{
+    return false;
+}
+
+bool insideVolumes( const SolidLocator* solids, const Kernel::Point_3& p )
+{
+    return solids->locate( p ) != CGAL::ON_UNBOUNDED_SIDE;
+}
+
+//
+// a point of a surface
+const Kernel::Point_2& surfacePoint( const CGAL::Polygon_with_holes_2<Kernel>& surface )
+{
+    return *surface.outer_boundary().vertices_begin();
+}
+const Kernel::Point_3& surfacePoint( const Kernel::Triangle_3& surface )
+{
+    return surface.vertex( 0 );
+}
+
+//
+// a point of a primitive which is not a volume
+template <int Dim>
+const typename TypeForDimension<Dim>::Point& primitivePoint( const PrimitiveHandle<Dim>& h )
+{
+    switch ( h.handle.which() ) {
+    case PrimitivePoint:
+        return *h.template as< typename TypeForDimension<Dim>::Point >();
+
+    case PrimitiveSegment:
+        return h.template as< typename TypeForDimension<Dim>::Segment >()->source();
+
+    default:
+        BOOST_ASSERT( h.handle.which() == PrimitiveSurface );
+        return surfacePoint( *h.template as< typename TypeForDimension<Dim>::Surface >() );
+    }
+}
+
+} // anonymous namespace
+
+///
+///
+///
+template <int Dim>
+PreparedIndex<Dim>::PreparedIndex( const Geometry& g, const SolidLocator* solids ):
+    _set( validGeometry( g, dim_t<Dim>() ) ),
+    _solids( solids )
+{
+    BOOST_ASSERT( Dim == 2 || solids );
+    buildLocators( _set, _volumeTriangles, _polygonLocators );
+
+    typename BoxCollection<Dim>::Type boxes, triangleBoxes, indexed;
+    _set.computeBoundingBoxes( _handles, boxes );
+    _volumeTriangles.computeBoundingBoxes( _handles, triangleBoxes );
+
+    // volumes are tested with their locator and their boundary triangles
+    for ( size_t i = 0; i < boxes.size(); ++i ) {
+        if ( boxes[i].handle()->handle.which() != PrimitiveVolume ) {
+            indexed.push_back( boxes[i] );
+        }
+    }
+
+    indexed.insert( indexed.end(), triangleBoxes.begin(), triangleBoxes.end() );
+    _tree.build( indexed.begin(), indexed.end() );
+}
+
+///
+///
+///
+template <int Dim>
+PreparedIndex<Dim>::~PreparedIndex()
+{
+}
+
+///
+///
+///
+template <int Dim>
+bool PreparedIndex<Dim>::isEmpty() const
+{
+    return _set.dimension() == -1;
+}
+
+///
+///
+///
+template <int Dim>
+bool PreparedIndex<Dim>::_intersects( const PrimitiveHandle<Dim>& indexed, const PrimitiveHandle<Dim>& other ) const
+{
+    if ( indexed.handle.which() == PrimitiveSurface && other.handle.which() == PrimitivePoint ) {
+        return locateInSurface( _polygonLocators,
+                                *indexed.template as< typename TypeForDimension<Dim>::Surface >(),
+                                *other.template as< typename TypeForDimension<Dim>::Point >() );
+    }
+
+    return algorithm::intersects( indexed, other );
+}
+
+///
+///
+///
+template <int Dim>
+bool PreparedIndex<Dim>::_insideVolumes( const typename TypeForDimension<Dim>::Point& p ) const
+{
+    return insideVolumes( _solids, p );
+}
+
+///
+///
+///
+template <int Dim>
+bool PreparedIndex<Dim>::intersects( const typename TypeForDimension<Dim>::Point& p ) const
+{
+    if ( _insideVolumes( p ) ) {
+        return true;
+    }
+
+    const PrimitiveHandle<Dim> hp( &p );
+    return _tree.intersects_until( IndexedBox<Dim>( p.bbox(), 0 ), intersects_cb( *this, hp ) );
+}
+
+///
+///
+///
+template <int Dim>
+bool PreparedIndex<Dim>::intersects( const GeometrySet<Dim>& gs ) const
+{
+    if ( ! gs.volumes().empty() ) {
+        // volume against anything, no better than the generic test
+        return algorithm::intersects( _set, gs );
+    }
+
+    typename HandleCollection<Dim>::Type handles;
+    typename BoxCollection<Dim>::Type boxes;
+    gs.computeBoundingBoxes( handles, boxes );
+
+    for ( size_t i = 0; i < boxes.size(); ++i ) {
+        const PrimitiveHandle<Dim>& h = *boxes[i].handle();
+
+        // a primitive which does not cross the boundary of a volume is either
+        // inside or outside, one of its point tells
+        if ( ! _set.volumes().empty() && _insideVolumes( primitivePoint( h ) ) ) {
+            return true;
+        }
+
+        if ( _tree.intersects_until( boxes[i], intersects_cb( *this, h ) ) ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///
+///
+///
+template <int Dim>
+bool PreparedIndex<Dim>::intersects( const Geometry& g ) const
+{
+    if ( g.isEmpty() || isEmpty() ) {
+        return false;
+    }
+
+    if ( g.is< Point >() ) {
+        return intersects( g.as< Point >().toPoint_d<Dim>() );
+    }
+
+    return intersects( GeometrySet<Dim>( g ) );
+}
+
+template class PreparedIndex<2>;
+template class PreparedIndex<3>;
+
+} // namespace detail
+} // namespace SFCGAL
@@ -0,0 +1,125 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_PREPARED_INDEX_H_
+#define _SFCGAL_DETAIL_PREPARED_INDEX_H_
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/BoxTree.h>
+#include <SFCGAL/detail/PolygonLocator.h>
+
+namespace SFCGAL {
+class Geometry;
+namespace detail {
+
+class SolidLocator;
+
+/**
+ * Acceleration structures of a PreparedGeometry for intersects and covers tests,
+ * built once and reused for every test against the same geometry :
+ *
+ * - the GeometrySet decomposition of the geometry
+ * - a box hierarchy on its points, segments and surfaces
+ * - 2D : a PolygonLocator for each polygon
+ * - 3D : the SolidLocator of the geometry, the boundary triangles of the solids are
+ *   indexed as surfaces
+ *
+ * The geometry is checked for validity on construction.
+ *
+ * @ingroup detail
+ */
+template <int Dim>
+class SFCGAL_API PreparedIndex {
+public:
+    typedef typename PrimitiveBox<Dim>::Type Box;
+    typedef BoxTree< Dim, Box >              Tree;
+
+    /**
+     * @param solids point locator in the solids of g, required in 3D and kept by the index
+     */
+    PreparedIndex( const Geometry& g, const SolidLocator* solids = NULL );
+    ~PreparedIndex();
+
+    /**
+     * decomposition of the geometry
+     */
+    inline const GeometrySet<Dim>& geometrySet() const {
+        return _set;
+    }
+
+    /**
+     * true if the geometry is empty
+     */
+    bool isEmpty() const;
+
+    /**
+     * Intersection test with a point
+     */
+    bool intersects( const typename TypeForDimension<Dim>::Point& p ) const;
+
+    /**
+     * Intersection test with a GeometrySet
+     */
+    bool intersects( const GeometrySet<Dim>& gs ) const;
+
+    /**
+     * Intersection test with a geometry, using the point locators for points
+     * @warning no validity check on g
+     */
+    bool intersects( const Geometry& g ) const;
+
+private:
+    //
+    // test between a primitive of the index and a primitive of an other geometry
+    bool _intersects( const PrimitiveHandle<Dim>& indexed, const PrimitiveHandle<Dim>& other ) const;
+    //
+    // true if p is inside or on the boundary of a solid
+    bool _insideVolumes( const typename TypeForDimension<Dim>::Point& p ) const;
+
+    struct intersects_cb {
+        const PreparedIndex& index;
+        const PrimitiveHandle<Dim>& other;
+
+        intersects_cb( const PreparedIndex& i, const PrimitiveHandle<Dim>& o ) : index( i ), other( o ) {}
+
+        bool operator()( const Box& box ) const {
+            return index._intersects( *box.handle(), other );
+        }
+    };
+
+    GeometrySet<Dim> _set;
+    // boundary triangles of the volumes (3D)
+    GeometrySet<Dim> _volumeTriangles;
+    typename HandleCollection<Dim>::Type _handles;
+    Tree             _tree;
+    // locators of the surfaces, by address of the surface (2D)
+    std::map< const void*, std::shared_ptr<PolygonLocator> > _polygonLocators;
+    // locator of the solids (3D)
+    const SolidLocator* _solids;
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
@@ -0,0 +1,340 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/SolidLocator.h>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/Point_inside_polyhedron.h>
+#include <SFCGAL/detail/detachedCopy.h>
+#include <SFCGAL/detail/tools/ThreadPool.h>
+
+#include <functional>
+#include <mutex>
+
+namespace SFCGAL {
+namespace detail {
+
+namespace {
+
+//
+// copy of a polyhedron made of detached points
+std::unique_ptr< MarkedPolyhedron > detachedPolyhedron( const MarkedPolyhedron& polyhedron )
+{
+    std::unique_ptr< MarkedPolyhedron > copy( new MarkedPolyhedron( polyhedron ) );
+
+    for ( MarkedPolyhedron::Vertex_iterator v = copy->vertices_begin(); v != copy->vertices_end(); ++v ) {
+        v->point() = detachedPoint( v->point() );
+    }
+
+    return copy;
+}
+
+} // anonymous namespace
+
+///
+/// shell converted to a polyhedron and its ray shooting structure
+struct SolidLocator::Shell {
+    std::unique_ptr< MarkedPolyhedron >                                  polyhedron;
+    CGAL::Bbox_3                                                         bbox;
+    std::unique_ptr< Point_inside_polyhedron<MarkedPolyhedron, Kernel> > side;
+
+    Shell( const PolyhedralSurface& shell ) :
+        polyhedron( shell.toPolyhedron_3<Kernel, MarkedPolyhedron>() ),
+        bbox( compute_solid_bbox( *polyhedron, dim_t<3>() ) ),
+        side( new Point_inside_polyhedron<MarkedPolyhedron, Kernel>( *polyhedron ) ) {
+    }
+
+    // detached copy of an other shell
+    Shell( const Shell& other ) :
+        polyhedron( detachedPolyhedron( *other.polyhedron ) ),
+        bbox( other.bbox ),
+        side( new Point_inside_polyhedron<MarkedPolyhedron, Kernel>( *polyhedron ) ) {
+    }
+
+    CGAL::Bounded_side locate( const Kernel::Point_3& p ) const {
+        if ( ! CGAL::do_overlap( bbox, p.bbox() ) ) {
+            return CGAL::ON_UNBOUNDED_SIDE;
+        }
+
+        return ( *side )( p );
+    }
+};
+
+///
+/// exterior and interior shells of a solid
+struct SolidLocator::Volume {
+    std::vector< std::unique_ptr< Shell > > shells;
+
+    Volume() {}
+
+    // detached copy of an other volume
+    Volume( const Volume& other ) {
+        for ( size_t i = 0; i < other.shells.size(); i++ ) {
+            shells.push_back( std::unique_ptr< Shell >( new Shell( *other.shells[i] ) ) );
+        }
+    }
+
+    CGAL::Bounded_side locate( const Kernel::Point_3& p ) const {
+        const CGAL::Bounded_side exterior = shells[0]->locate( p );
+
+        if ( exterior != CGAL::ON_BOUNDED_SIDE ) {
+            return exterior;
+        }
+
+        for ( size_t i = 1; i < shells.size(); i++ ) {
+            switch ( shells[i]->locate( p ) ) {
+            case CGAL::ON_BOUNDED_SIDE:
+                return CGAL::ON_UNBOUNDED_SIDE;
+
+            case CGAL::ON_BOUNDARY:
+                return CGAL::ON_BOUNDARY;
+
+            default:
+                break;
+            }
+        }
+
+        return CGAL::ON_BOUNDED_SIDE;
+    }
+};
+
+///
+/// locates a point in the volumes whose box contains it, until it is found inside one of them
+struct SolidLocator::locate_cb {
+    const Volumes& volumes;
+    const Kernel::Point_3& point;
+    CGAL::Bounded_side& side;
+
+    locate_cb( const Volumes& v, const Kernel::Point_3& p, CGAL::Bounded_side& s ) :
+        volumes( v ), point( p ), side( s ) {}
+
+    bool operator()( const IndexedBox<3>& box ) const {
+        switch ( volumes[ box.index() ]->locate( point ) ) {
+        case CGAL::ON_BOUNDED_SIDE:
+            side = CGAL::ON_BOUNDED_SIDE;
+            return true;
+
+        case CGAL::ON_BOUNDARY:
+            side = CGAL::ON_BOUNDARY;
+            return false;
+
+        default:
+            return false;
+        }
+    }
+};
+
+///
+///
+///
+SolidLocator::SolidLocator( const Geometry& g ):
+    _poolThreads( 0 )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( g );
+
+    _build( g );
+}
+
+///
+///
+///
+SolidLocator::SolidLocator( const Geometry& g, algorithm::NoValidityCheck ):
+    _poolThreads( 0 )
+{
+    _build( g );
+}
+
+///
+///
+///
+void SolidLocator::_build( const Geometry& g )
+{
+    _addSolids( g );
+
+    std::vector< IndexedBox<3> > boxes;
+
+    for ( size_t i = 0; i < _volumes.size(); i++ ) {
+        boxes.push_back( IndexedBox<3>( _volumes[i]->shells[0]->bbox, i ) );
+    }
+
+    _tree.build( boxes.begin(), boxes.end() );
+}
+
+///
+///
+///
+SolidLocator::~SolidLocator()
+{
+}
+
+///
+///
+///
+void SolidLocator::_addSolids( const Geometry& g )
+{
+    if ( g.isEmpty() ) {
+        return;
+    }
+
+    switch ( g.geometryTypeId() ) {
+    case TYPE_SOLID: {
+        const Solid& solid = g.as< Solid >();
+        std::unique_ptr< Volume > volume( new Volume );
+
+        for ( size_t i = 0; i < solid.numShells(); i++ ) {
+            if ( ! solid.shellN( i ).isEmpty() ) {
+                volume->shells.push_back( std::unique_ptr< Shell >( new Shell( solid.shellN( i ) ) ) );
+            }
+        }
+
+        _volumes.push_back( std::move( volume ) );
+        return;
+    }
+
+    case TYPE_MULTISOLID:
+    case TYPE_GEOMETRYCOLLECTION:
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            _addSolids( g.geometryN( i ) );
+        }
+
+        return;
+
+    default:
+        return;
+    }
+}
+
+///
+///
+///
+CGAL::Bounded_side SolidLocator::locate( const Kernel::Point_3& p ) const
+{
+    return _locate( _volumes, p );
+}
+
+///
+///
+///
+CGAL::Bounded_side SolidLocator::locate( const Point& p ) const
+{
+    return locate( p.toPoint_3() );
+}
+
+///
+///
+///
+Kernel::Point_3 SolidLocator::_toPoint_3( const Point& p )
+{
+    return p.toPoint_3();
+}
+
+///
+///
+///
+CGAL::Bounded_side SolidLocator::_locate( const Volumes& volumes, const Kernel::Point_3& p ) const
+{
+    CGAL::Bounded_side side = CGAL::ON_UNBOUNDED_SIDE;
+    _tree.intersects_until( IndexedBox<3>( p.bbox(), 0 ), locate_cb( volumes, p, side ) );
+    return side;
+}
+
+///
+///
+///
+void SolidLocator::_locate( const std::vector< Kernel::Point_3 >& points, std::vector< CGAL::Bounded_side >& sides, size_t numThreads ) const
+{
+    sides.resize( points.size() );
+
+    // contiguous blocks of points, to keep the scheduling cost low
+    const size_t blockSize = 256;
+    const size_t numBlocks = ( points.size() + blockSize - 1 ) / blockSize;
+
+    if ( numThreads == 1 || numBlocks < 2 ) {
+        for ( size_t i = 0; i < points.size(); i++ ) {
+            sides[i] = locate( points[i] );
+        }
+
+        return;
+    }
+
+    if ( ! _pool || _poolThreads != numThreads ) {
+        _pool.reset( new tools::ThreadPool( numThreads ) );
+        _poolThreads = numThreads;
+    }
+
+    // lazy exact numbers are not thread safe : each running task takes its own copy
+    // of the volumes and locates detached copies of the points
+    while ( _copies.size() < _pool->size() ) {
+        Volumes copy;
+
+        for ( size_t i = 0; i < _volumes.size(); i++ ) {
+            copy.push_back( std::unique_ptr< Volume >( new Volume( *_volumes[i] ) ) );
+        }
+
+        _copies.push_back( std::move( copy ) );
+    }
+
+    std::vector< Kernel::Point_3 > detached;
+    detached.reserve( points.size() );
+
+    for ( size_t i = 0; i < points.size(); i++ ) {
+        detached.push_back( detachedPoint( points[i] ) );
+    }
+
+    // at most one task per thread runs at once, a copy is always free
+    std::mutex mutex;
+    std::vector< size_t > freeCopies;
+
+    for ( size_t i = 0; i < _pool->size(); i++ ) {
+        freeCopies.push_back( i );
+    }
+
+    std::function< void( size_t ) > locateBlock = [&]( size_t block ) {
+        size_t copy;
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            copy = freeCopies.back();
+            freeCopies.pop_back();
+        }
+
+        const size_t end = std::min( points.size(), ( block + 1 ) * blockSize );
+
+        try {
+            for ( size_t i = block * blockSize; i < end; i++ ) {
+                sides[i] = _locate( _copies[copy], detached[i] );
+            }
+        }
+        catch ( ... ) {
+            std::lock_guard< std::mutex > lock( mutex );
+            freeCopies.push_back( copy );
+            throw;
+        }
+
+        std::lock_guard< std::mutex > lock( mutex );
+        freeCopies.push_back( copy );
+    };
+
+    _pool->parallelFor( numBlocks, locateBlock );
+}
+
+} // namespace detail
+} // namespace SFCGAL
@@ -0,0 +1,141 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_SOLID_LOCATOR_H_
+#define _SFCGAL_DETAIL_SOLID_LOCATOR_H_
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/detail/BoxTree.h>
+#include <SFCGAL/detail/GeometrySet.h>
+
+namespace SFCGAL {
+class Geometry;
+class Point;
+namespace algorithm {
+struct NoValidityCheck;
+}
+namespace tools {
+class ThreadPool;
+}
+namespace detail {
+
+/**
+ * Point location in the solids of a geometry, for repeated queries.
+ *
+ * Each shell is converted once to a polyhedron with its own AABB tree for ray
+ * shooting, and the solids are indexed by their bounding boxes.
+ *
+ * The polyhedra share their lazy exact numbers with the geometry, which are not
+ * thread safe : a locator must not be used by several threads at once, nor while
+ * the geometry is used by an other thread. Parallel queries go through
+ * locate( begin, end, out, numThreads ).
+ *
+ * A point is inside a solid if it is inside its exterior shell and outside its
+ * interior shells. Members of the geometry which are not solids are ignored.
+ *
+ * @ingroup detail
+ */
+class SFCGAL_API SolidLocator {
+public:
+    /**
+     * @param g Solid, MultiSolid or GeometryCollection
+     * @pre g is a valid geometry
+     */
+    SolidLocator( const Geometry& g ) ;
+
+    /**
+     * @warning No actual validity check is done
+     */
+    SolidLocator( const Geometry& g, algorithm::NoValidityCheck ) ;
+
+    ~SolidLocator() ;
+
+    /**
+     * true if there is no solid to locate points in
+     */
+    inline bool isEmpty() const {
+        return _volumes.empty();
+    }
+
+    /**
+     * position of p relative to the union of the solids
+     */
+    CGAL::Bounded_side locate( const Kernel::Point_3& p ) const ;
+    CGAL::Bounded_side locate( const Point& p ) const ;
+
+    /**
+     * Position of every point of [begin,end) (Kernel::Point_3 or Point), written to out.
+     * Points are located by numThreads threads (0 for the number of cores).
+     *
+     * Each thread works on its own copy of the shells and of the points, built from
+     * their exact coordinates so that no number is shared between threads. The
+     * copies and the threads are kept for the next calls.
+     */
+    template <class InputIterator, class OutputIterator>
+    OutputIterator locate( InputIterator begin, InputIterator end, OutputIterator out, size_t numThreads = 1 ) const {
+        std::vector< Kernel::Point_3 > points ;
+
+        for ( ; begin != end; ++begin ) {
+            points.push_back( _toPoint_3( *begin ) );
+        }
+
+        std::vector< CGAL::Bounded_side > sides ;
+        _locate( points, sides, numThreads );
+        return std::copy( sides.begin(), sides.end(), out );
+    }
+
+private:
+    struct Shell ;
+    struct Volume ;
+    struct locate_cb ;
+
+    typedef std::vector< std::unique_ptr< Volume > > Volumes ;
+
+    SolidLocator( const SolidLocator& ) ;
+    SolidLocator& operator = ( const SolidLocator& ) ;
+
+    void _build( const Geometry& g ) ;
+    void _addSolids( const Geometry& g ) ;
+    CGAL::Bounded_side _locate( const Volumes& volumes, const Kernel::Point_3& p ) const ;
+    void _locate( const std::vector< Kernel::Point_3 >& points, std::vector< CGAL::Bounded_side >& sides, size_t numThreads ) const ;
+
+    static inline const Kernel::Point_3& _toPoint_3( const Kernel::Point_3& p ) {
+        return p;
+    }
+    static Kernel::Point_3 _toPoint_3( const Point& p ) ;
+
+    Volumes                                  _volumes ;
+    BoxTree< 3, IndexedBox<3> >              _tree ;
+
+    // threads of the parallel queries, and the number of threads they were asked for
+    mutable std::unique_ptr< tools::ThreadPool > _pool ;
+    mutable size_t                               _poolThreads ;
+    // copies of the volumes, one for each thread of the pool
+    mutable std::vector< Volumes >               _copies ;
+};
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
@@ -19,11 +19,14 @@
  */
 
 
+#include <memory>
+
 #include <SFCGAL/detail/algorithm/coversPoints.h>
 #include <SFCGAL/Geometry.h>
 #include <SFCGAL/Point.h>
 #include <SFCGAL/algorithm/intersects.h>
 #include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
 
 namespace SFCGAL {
@@ -36,7 +39,10 @@ bool _coversPoints( const Geometry& ga, const Geometry& gb )
         return false;
     }
 
-    GeometrySet<Dim> gsa( ga );
+    // double precision mirror of ga, the exact GeometrySet is only built if needed
+    InexactGeometrySet<Dim> isa;
+    const bool inexact = isa.build( ga );
+    std::unique_ptr< GeometrySet<Dim> > gsa;
 
     // get all points of gb;
     detail::GetPointsVisitor visitor;
@@ -45,10 +51,24 @@ bool _coversPoints( const Geometry& ga, const Geometry& gb )
     for ( detail::GetPointsVisitor::const_iterator it = visitor.points.begin(); it != visitor.points.end(); ++it ) {
         const Point* ppt = *it;
 
+        typename InexactTypeForDimension<Dim>::Point ipt;
+
+        if ( inexact && toInexactPoint( *ppt, ipt ) ) {
+            if ( !SFCGAL::algorithm::intersects( isa, ipt ) ) {
+                return false;
+            }
+
+            continue;
+        }
+
+        if ( ! gsa.get() ) {
+            gsa.reset( new GeometrySet<Dim>( ga ) );
+        }
+
         // a geometry set of one point
         GeometrySet<Dim> gsp( *ppt );
 
-        if ( !SFCGAL::algorithm::intersects( gsp, gsa ) ) {
+        if ( !SFCGAL::algorithm::intersects( gsp, *gsa ) ) {
             return false;
         }
     }
@@ -0,0 +1,108 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/detachedCopy.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Transform.h>
+
+namespace SFCGAL {
+namespace detail {
+
+namespace {
+
+//
+// rebuilds each point from its exact coordinates
+class DetachTransform : public Transform {
+public:
+    using Transform::visit;
+
+    virtual void transform( Point& p ) {
+        if ( p.isEmpty() ) {
+            return;
+        }
+
+        const Coordinate& c = p.coordinate();
+
+        if ( c.is3D() ) {
+            p.coordinate() = Coordinate( Kernel::FT( CGAL::exact( c.x() ) ),
+                                         Kernel::FT( CGAL::exact( c.y() ) ),
+                                         Kernel::FT( CGAL::exact( c.z() ) ) );
+        }
+        else {
+            p.coordinate() = Coordinate( Kernel::FT( CGAL::exact( c.x() ) ),
+                                         Kernel::FT( CGAL::exact( c.y() ) ) );
+        }
+    }
+
+    virtual void visit( LineString& g ) {
+        // points of a compact LineString are built from its doubles when they
+        // are read, visiting them would uncompact it for nothing
+        if ( g.isCompact() ) {
+            return;
+        }
+
+        Transform::visit( g );
+    }
+};
+
+} // anonymous namespace
+
+///
+///
+///
+Kernel::Point_2 detachedPoint( const Kernel::Point_2& p )
+{
+    return Kernel::Point_2( Kernel::FT( CGAL::exact( p.x() ) ),
+                            Kernel::FT( CGAL::exact( p.y() ) ) );
+}
+
+///
+///
+///
+Kernel::Point_3 detachedPoint( const Kernel::Point_3& p )
+{
+    return Kernel::Point_3( Kernel::FT( CGAL::exact( p.x() ) ),
+                            Kernel::FT( CGAL::exact( p.y() ) ),
+                            Kernel::FT( CGAL::exact( p.z() ) ) );
+}
+
+///
+///
+///
+void detach( Geometry& g )
+{
+    DetachTransform t;
+    g.accept( t );
+}
+
+///
+///
+///
+std::unique_ptr< Geometry > detachedCopy( const Geometry& g )
+{
+    std::unique_ptr< Geometry > copy( g.clone() );
+    detach( *copy );
+    return copy;
+}
+
+} // namespace detail
+} // namespace SFCGAL
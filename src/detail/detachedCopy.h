@@ -0,0 +1,65 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_DETACHEDCOPY_H_
+#define _SFCGAL_DETAIL_DETACHEDCOPY_H_
+
+#include <memory>
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/Kernel.h>
+
+namespace SFCGAL {
+class Geometry;
+namespace detail {
+
+/*
+ * Copies of a point (Point, Kernel::Point_3, clone() of a geometry...) share the
+ * representation of their lazy exact numbers, which CGAL updates without any
+ * synchronization when they are copied or read. Two threads can't use geometries
+ * sharing numbers at the same time.
+ *
+ * A detached copy is built from the exact values of the coordinates and shares no
+ * number with its source nor with an other copy. Building it reads the source, which
+ * must not be used by an other thread meanwhile.
+ */
+
+/**
+ * copy of p which shares no lazy number with p
+ */
+SFCGAL_API Kernel::Point_2 detachedPoint( const Kernel::Point_2& p ) ;
+SFCGAL_API Kernel::Point_3 detachedPoint( const Kernel::Point_3& p ) ;
+
+/**
+ * Rebuilds the coordinates of g from their exact values, so that g no longer shares
+ * any lazy number with an other geometry. Compact LineStrings, which store doubles,
+ * are left as is.
+ */
+SFCGAL_API void detach( Geometry& g ) ;
+
+/**
+ * copy of g which shares no lazy number with g
+ */
+SFCGAL_API std::unique_ptr< Geometry > detachedCopy( const Geometry& g ) ;
+
+} // namespace detail
+} // namespace SFCGAL
+
+#endif
@@ -0,0 +1,334 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_GRAPH_COMPACTGEOMETRYGRAPH_H_
+#define _SFCGAL_GRAPH_COMPACTGEOMETRYGRAPH_H_
+
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <SFCGAL/detail/graph/Vertex.h>
+#include <SFCGAL/detail/graph/Edge.h>
+#include <SFCGAL/detail/graph/GeometryGraph.h>
+
+namespace SFCGAL {
+namespace graph {
+
+/**
+ * @brief [private]Vector based counterpart of GeometryGraphT.
+ *
+ * Vertices and edges are identified by their index and their properties are stored
+ * in contiguous arrays. Vertices and edges can only be added. Once every edge is added,
+ * buildAdjacency() computes in and out edges of each vertex in compressed sparse
+ * row arrays (edges of a vertex are sorted by insertion order).
+ *
+ * Suited to the algorithms which build a graph and only read it afterwards
+ * (no vertex or edge removal, no edge reversal).
+ *
+ * @warning duplicate matching is performed in CompactGeometryGraphBuilderT
+ */
+template < typename VertexProperties, typename EdgeProperties >
+class CompactGeometryGraphT {
+public:
+    typedef VertexProperties                             vertex_properties ;
+    typedef EdgeProperties                               edge_properties ;
+
+    typedef size_t                                       vertex_descriptor ;
+    typedef size_t                                       edge_descriptor ;
+    /**
+     * An edge descriptor, with a direction.
+     *
+     * From the vertex point of view, out edges are DIRECT, in edges are REVERSE.
+     */
+    typedef std::pair< edge_descriptor, EdgeDirection >  directed_edge_descriptor ;
+
+    /**
+     * range of edges, see outEdges() and inEdges()
+     */
+    typedef std::vector< edge_descriptor >::const_iterator adjacent_edge_iterator ;
+
+    /**
+     * reserve memory for numVertices vertices and numEdges edges
+     */
+    void reserve( const size_t& numVertices, const size_t& numEdges ) {
+        _vertices.reserve( numVertices );
+        _edges.reserve( numEdges );
+        _sources.reserve( numEdges );
+        _targets.reserve( numEdges );
+    }
+
+    /**
+     * [vertex]returns the number of vertices
+     */
+    inline size_t     numVertices() const {
+        return _vertices.size();
+    }
+
+    /**
+     * [vertex]add a vertex to the graph
+     * @return the identifier of the vertex
+     */
+    vertex_descriptor addVertex( const vertex_properties& properties = vertex_properties() ) {
+        _vertices.push_back( properties );
+        return _vertices.size() - 1 ;
+    }
+
+    /**
+     * [edge]returns the number of edges
+     */
+    inline size_t     numEdges() const {
+        return _edges.size();
+    }
+
+    /**
+     * [edge]Add an Edge to the Graph
+     * @return the identifier of the edge
+     */
+    edge_descriptor   addEdge(
+        const vertex_descriptor& source,
+        const vertex_descriptor& target,
+        const edge_properties& properties = edge_properties()
+    ) {
+        BOOST_ASSERT( source < numVertices() && target < numVertices() );
+
+        _edges.push_back( properties );
+        _sources.push_back( source );
+        _targets.push_back( target );
+        return _edges.size() - 1 ;
+    }
+
+    /**
+     * [edge]get the source vertex for an edge
+     */
+    inline vertex_descriptor source( const edge_descriptor& edge ) const {
+        return _sources[ edge ] ;
+    }
+    /**
+     * [edge]get the source vertex for an edge with a direction
+     */
+    inline vertex_descriptor source( const edge_descriptor& edge, const EdgeDirection& direction ) const {
+        return direction == DIRECT ? _sources[ edge ] : _targets[ edge ] ;
+    }
+    /**
+     * [edge]get the source vertex for an edge with a direction
+     */
+    inline vertex_descriptor source( const directed_edge_descriptor& edge ) const {
+        return source( edge.first, edge.second ) ;
+    }
+
+    /**
+     * [edge]get the target vertex for an edge
+     */
+    inline vertex_descriptor target( const edge_descriptor& edge ) const {
+        return _targets[ edge ] ;
+    }
+    /**
+     * [edge]get the target vertex for an edge with a direction
+     */
+    inline vertex_descriptor target( const edge_descriptor& edge, const EdgeDirection& direction ) const {
+        return direction == DIRECT ? _targets[ edge ] : _sources[ edge ] ;
+    }
+    /**
+     * [edge]get the target vertex for an edge with a direction
+     */
+    inline vertex_descriptor target( const directed_edge_descriptor& edge ) const {
+        return target( edge.first, edge.second );
+    }
+
+    /**
+     * [adjacency]compute in and out edges of each vertex. Has to be called
+     * again if edges are added.
+     */
+    void buildAdjacency() {
+        _buildAdjacency( _sources, _outOffsets, _outEdges );
+        _buildAdjacency( _targets, _inOffsets, _inEdges );
+    }
+
+    /**
+     * [adjacency]indicates if buildAdjacency() is up to date
+     */
+    inline bool hasAdjacency() const {
+        return _outEdges.size() == numEdges() && _outOffsets.size() == numVertices() + 1 ;
+    }
+
+    /**
+     * [adjacency]range of the out edges of a vertex
+     * @pre hasAdjacency()
+     */
+    inline std::pair< adjacent_edge_iterator, adjacent_edge_iterator > outEdges( const vertex_descriptor& vertex ) const {
+        BOOST_ASSERT( hasAdjacency() );
+        return std::make_pair(
+                   _outEdges.begin() + _outOffsets[ vertex ],
+                   _outEdges.begin() + _outOffsets[ vertex + 1 ]
+               );
+    }
+    /**
+     * [adjacency]range of the in edges of a vertex
+     * @pre hasAdjacency()
+     */
+    inline std::pair< adjacent_edge_iterator, adjacent_edge_iterator > inEdges( const vertex_descriptor& vertex ) const {
+        BOOST_ASSERT( hasAdjacency() );
+        return std::make_pair(
+                   _inEdges.begin() + _inOffsets[ vertex ],
+                   _inEdges.begin() + _inOffsets[ vertex + 1 ]
+               );
+    }
+
+    /**
+     * [adjacency]returns the degree of a vertex (in and out edges)
+     * @pre hasAdjacency()
+     */
+    inline size_t degree( const vertex_descriptor& vertex ) const {
+        BOOST_ASSERT( hasAdjacency() );
+        return _outOffsets[ vertex + 1 ] - _outOffsets[ vertex ]
+               + _inOffsets[ vertex + 1 ] - _inOffsets[ vertex ] ;
+    }
+
+    /**
+     * [adjacency]Get edges from a to b and from b to a
+     * @pre hasAdjacency()
+     */
+    std::vector< directed_edge_descriptor > edges( const vertex_descriptor& a, const vertex_descriptor& b ) const {
+        std::vector< directed_edge_descriptor > result ;
+        _appendEdges( a, b, DIRECT, result );
+        _appendEdges( b, a, REVERSE, result );
+        return result ;
+    }
+
+    /**
+     * [adjacency]number of edges from a to b and from b to a, without
+     * building the list of edges()
+     * @pre hasAdjacency()
+     */
+    size_t numEdges( const vertex_descriptor& a, const vertex_descriptor& b ) const {
+        return _countEdges( a, b ) + _countEdges( b, a ) ;
+    }
+
+    /**
+     * [helper]indicates if edges are opposite
+     */
+    inline bool areOpposite( const edge_descriptor& a, const edge_descriptor& b ) const {
+        return source( a ) == target( b ) && target( a ) == source( b ) ;
+    }
+    /**
+     * [helper]indicates if edges are parallel
+     */
+    inline bool areParallel( const edge_descriptor& a, const edge_descriptor& b ) const {
+        return source( a ) == source( b ) && target( a ) == target( b ) ;
+    }
+
+    /**
+     * returns the VertexProperties attached to a Vertex
+     */
+    inline const vertex_properties& operator [] ( const vertex_descriptor& vertex ) const {
+        return _vertices[ vertex ];
+    }
+    /**
+     * returns the VertexProperties attached to a Vertex
+     */
+    inline vertex_properties& operator [] ( const vertex_descriptor& vertex ) {
+        return _vertices[ vertex ];
+    }
+
+    /**
+     * returns the EdgeProperties attached to an Edge
+     */
+    inline const edge_properties& edge( const edge_descriptor& e ) const {
+        return _edges[ e ];
+    }
+    /**
+     * returns the EdgeProperties attached to an Edge
+     */
+    inline edge_properties& edge( const edge_descriptor& e ) {
+        return _edges[ e ];
+    }
+
+private:
+    std::vector< vertex_properties > _vertices ;
+    std::vector< edge_properties >   _edges ;
+    std::vector< vertex_descriptor > _sources ;
+    std::vector< vertex_descriptor > _targets ;
+
+    std::vector< size_t >            _outOffsets ;
+    std::vector< edge_descriptor >   _outEdges ;
+    std::vector< size_t >            _inOffsets ;
+    std::vector< edge_descriptor >   _inEdges ;
+
+    /**
+     * counting sort of the edges according to one of their end
+     */
+    void _buildAdjacency(
+        const std::vector< vertex_descriptor >& ends,
+        std::vector< size_t >& offsets,
+        std::vector< edge_descriptor >& edges
+    ) const {
+        offsets.assign( numVertices() + 1, 0 );
+
+        for ( size_t i = 0; i < ends.size(); i++ ) {
+            offsets[ ends[i] + 1 ]++ ;
+        }
+
+        for ( size_t i = 0; i < numVertices(); i++ ) {
+            offsets[ i + 1 ] += offsets[ i ] ;
+        }
+
+        std::vector< size_t > positions( offsets.begin(), offsets.end() - 1 );
+        edges.resize( ends.size() );
+
+        for ( size_t i = 0; i < ends.size(); i++ ) {
+            edges[ positions[ ends[i] ]++ ] = i ;
+        }
+    }
+
+    void _appendEdges(
+        const vertex_descriptor& a,
+        const vertex_descriptor& b,
+        const EdgeDirection& direction,
+        std::vector< directed_edge_descriptor >& result
+    ) const {
+        adjacent_edge_iterator it, end ;
+
+        for ( boost::tie( it, end ) = outEdges( a ); it != end; ++it ) {
+            if ( target( *it ) == b ) {
+                result.push_back( std::make_pair( *it, direction ) );
+            }
+        }
+    }
+
+    size_t _countEdges( const vertex_descriptor& a, const vertex_descriptor& b ) const {
+        size_t count = 0 ;
+        adjacent_edge_iterator it, end ;
+
+        for ( boost::tie( it, end ) = outEdges( a ); it != end; ++it ) {
+            if ( target( *it ) == b ) {
+                count++ ;
+            }
+        }
+
+        return count ;
+    }
+};
+
+typedef CompactGeometryGraphT< Vertex, Edge > CompactGeometryGraph ;
+
+}//graph
+}//SFCGAL
+
+#endif
@@ -0,0 +1,220 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_GRAPH_COMPACTGEOMETRYGRAPHBUILDER_H_
+#define _SFCGAL_GRAPH_COMPACTGEOMETRYGRAPHBUILDER_H_
+
+#include <unordered_map>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/TriangulatedSurface.h>
+
+#include <SFCGAL/detail/CoordinateHash.h>
+#include <SFCGAL/detail/graph/CompactGeometryGraph.h>
+
+namespace SFCGAL {
+namespace graph {
+
+/**
+ * @brief [private]Convert Geometries to a CompactGeometryGraph (duplicate points are
+ * matched with a hash table).
+ *
+ * Edges added for a geometry are consecutive, so the add methods return the identifier
+ * of the first edge added instead of the list of edges.
+ */
+template < typename Graph >
+class CompactGeometryGraphBuilderT {
+public:
+    typedef Graph                                      graph_t ;
+
+    typedef typename graph_t::vertex_properties        vertex_properties ;
+    typedef typename graph_t::edge_properties          edge_properties ;
+    typedef typename graph_t::vertex_descriptor        vertex_descriptor ;
+    typedef typename graph_t::edge_descriptor          edge_descriptor ;
+
+    /**
+     * allows to match duplicates
+     */
+    typedef std::unordered_map< Coordinate, vertex_descriptor, detail::CoordinateHash > coordinate_list ;
+
+    /**
+     * constructor with the expected number of points (reserves memory
+     * for numPoints vertices and edges)
+     */
+    CompactGeometryGraphBuilderT( graph_t& graph, const size_t& numPoints = 0 ):
+        _graph( graph ) {
+        if ( numPoints > 0 ) {
+            _graph.reserve( numPoints, numPoints );
+            _vertices.reserve( numPoints );
+        }
+    }
+
+    /**
+     * add a Point to the Graph
+     */
+    vertex_descriptor addPoint( const Point& point ) {
+        BOOST_ASSERT( ! point.isEmpty() );
+
+        std::pair< typename coordinate_list::iterator, bool > inserted = _vertices.insert(
+                    std::make_pair( point.coordinate(), _graph.numVertices() )
+                );
+
+        if ( inserted.second ) {
+            _graph.addVertex( vertex_properties( point.coordinate() ) );
+        }
+
+        return inserted.first->second ;
+    }
+
+    /**
+     * add a line segment to the Graph
+     * @return the edge inserted into the graph
+     */
+    edge_descriptor   addLineSegment(
+        const Point& a,
+        const Point& b,
+        const edge_properties& edgeProperties = edge_properties()
+    ) {
+        BOOST_ASSERT( ! a.isEmpty() );
+        BOOST_ASSERT( ! b.isEmpty() );
+
+        const vertex_descriptor source = addPoint( a );
+        const vertex_descriptor target = addPoint( b );
+        return _graph.addEdge( source, target, edgeProperties );
+    }
+
+    /**
+     * add a LineString to the graph
+     * @return the first edge inserted into the graph (numPoints()-1 edges are inserted)
+     */
+    edge_descriptor addLineString(
+        const LineString& lineString,
+        const edge_properties& edgeProperties = edge_properties()
+    ) {
+        BOOST_ASSERT( ! lineString.isEmpty() );
+
+        const edge_descriptor first = _graph.numEdges() ;
+        vertex_descriptor source = addPoint( lineString.pointN( 0 ) );
+
+        for ( size_t i = 1; i < lineString.numPoints(); i++ ) {
+            const vertex_descriptor target = addPoint( lineString.pointN( i ) );
+            _graph.addEdge( source, target, edgeProperties );
+            source = target ;
+        }
+
+        return first ;
+    }
+
+    /**
+     * add a Triangle to the graph
+     * @return the first edge inserted into the graph (3 edges are inserted)
+     */
+    edge_descriptor addTriangle(
+        const Triangle& triangle,
+        const edge_properties& edgeProperties = edge_properties()
+    ) {
+        BOOST_ASSERT( ! triangle.isEmpty() );
+
+        const edge_descriptor first = _graph.numEdges() ;
+
+        for ( size_t i = 0; i < 3; i++ ) {
+            addLineSegment( triangle.vertex( i ), triangle.vertex( i+1 ), edgeProperties );
+        }
+
+        return first ;
+    }
+
+    /**
+     * add a Polygon to the graph
+     * @return the first edge inserted into the graph (rings are inserted in order)
+     */
+    edge_descriptor addPolygon(
+        const Polygon& polygon,
+        const edge_properties& edgeProperties = edge_properties()
+    ) {
+        BOOST_ASSERT( ! polygon.isEmpty() );
+
+        const edge_descriptor first = _graph.numEdges() ;
+
+        for ( size_t i = 0; i < polygon.numRings(); i++ ) {
+            addLineString( polygon.ringN( i ), edgeProperties );
+        }
+
+        return first ;
+    }
+
+    /**
+     * add a TriangulatedSurface to the graph
+     * @return the first edge inserted into the graph (3 edges per triangle)
+     */
+    edge_descriptor addTriangulatedSurface(
+        const TriangulatedSurface& triangulatedSurface,
+        const edge_properties& edgeProperties = edge_properties()
+    ) {
+        BOOST_ASSERT( ! triangulatedSurface.isEmpty() );
+
+        const edge_descriptor first = _graph.numEdges() ;
+
+        for ( size_t i = 0; i < triangulatedSurface.numGeometries(); i++ ) {
+            addTriangle( triangulatedSurface.geometryN( i ), edgeProperties );
+        }
+
+        return first ;
+    }
+
+    /**
+     * add a PolyhedralSurface to the graph
+     * @return the first edge inserted into the graph (polygons are inserted in order)
+     */
+    edge_descriptor addPolyhedralSurface(
+        const PolyhedralSurface& polyhedralSurface,
+        const edge_properties& edgeProperties = edge_properties()
+    ) {
+        BOOST_ASSERT( ! polyhedralSurface.isEmpty() );
+
+        const edge_descriptor first = _graph.numEdges() ;
+
+        for ( size_t i = 0; i < polyhedralSurface.numPolygons(); i++ ) {
+            addPolygon( polyhedralSurface.polygonN( i ), edgeProperties );
+        }
+
+        return first ;
+    }
+
+private:
+    graph_t&          _graph ;
+    coordinate_list   _vertices ;
+
+    /**
+     * no copy constructor
+     */
+    CompactGeometryGraphBuilderT( const CompactGeometryGraphBuilderT& other ) ;
+};
+
+
+typedef CompactGeometryGraphBuilderT< CompactGeometryGraph > CompactGeometryGraphBuilder ;
+
+}//graph
+}//SFCGAL
+
+#endif
@@ -0,0 +1,904 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/io/FlatGeometry.h>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/MultiPoint.h>
+#include <SFCGAL/MultiLineString.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/numeric.h>
+#include <SFCGAL/detail/CoordinateBuffer.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <gmp.h>
+#ifdef CGAL_USE_GMPXX
+#include <CGAL/mpq_class.h>
+#endif
+
+namespace SFCGAL {
+namespace io {
+
+namespace {
+
+const char   FLAT_MAGIC[4] = { 'S', 'F', 'G', 'B' };
+const size_t HEADER_SIZE   = 48;
+const size_t NODE_SIZE     = 24;
+// nesting limit of the nodes, materialize() recurses once per level
+const size_t MAX_DEPTH     = 128;
+
+// node flags
+const uint8_t NODE_3D       = 1;
+const uint8_t NODE_MEASURED = 2;
+const uint8_t NODE_EMPTY    = 4;
+const uint8_t NODE_EXACT    = 8;
+
+typedef Kernel::Exact_kernel::FT ExactFT;
+
+template <class T>
+inline void put( std::string& s, size_t offset, const T& v )
+{
+    std::memcpy( &s[offset], &v, sizeof( T ) );
+}
+
+template <class T>
+inline T get( const char* p )
+{
+    T v;
+    std::memcpy( &v, p, sizeof( T ) );
+    return v;
+}
+
+void flatError( const std::string& message )
+{
+    BOOST_THROW_EXCEPTION( Exception( "flat geometry : " + message ) );
+}
+
+mpq_srcptr toMpq( const CGAL::Gmpq& q )
+{
+    return q.mpq();
+}
+
+void fromMpq( mpq_srcptr q, CGAL::Gmpq& out )
+{
+    out = CGAL::Gmpq( q );
+}
+
+#ifdef CGAL_USE_GMPXX
+mpq_srcptr toMpq( const mpq_class& q )
+{
+    return q.get_mpq_t();
+}
+
+void fromMpq( mpq_srcptr q, mpq_class& out )
+{
+    out = mpq_class( q );
+}
+#endif
+
+bool isPointSequence( const int type )
+{
+    return type == TYPE_POINT || type == TYPE_LINESTRING || type == TYPE_TRIANGLE;
+}
+
+// true if a collection of type collectionType may contain a geometry of type type
+bool isAllowedMember( const int collectionType, const int type )
+{
+    switch ( collectionType ) {
+    case TYPE_MULTIPOINT:
+        return type == TYPE_POINT;
+
+    case TYPE_MULTILINESTRING:
+        return type == TYPE_LINESTRING;
+
+    case TYPE_MULTIPOLYGON:
+        return type == TYPE_POLYGON;
+
+    case TYPE_MULTISOLID:
+        return type == TYPE_SOLID;
+
+    default:
+        return true;
+    }
+}
+
+bool isGeometryType( const int type )
+{
+    switch ( type ) {
+    case TYPE_POINT:
+    case TYPE_LINESTRING:
+    case TYPE_POLYGON:
+    case TYPE_MULTIPOINT:
+    case TYPE_MULTILINESTRING:
+    case TYPE_MULTIPOLYGON:
+    case TYPE_GEOMETRYCOLLECTION:
+    case TYPE_POLYHEDRALSURFACE:
+    case TYPE_TRIANGULATEDSURFACE:
+    case TYPE_TRIANGLE:
+    case TYPE_SOLID:
+    case TYPE_MULTISOLID:
+        return true;
+    default:
+        return false;
+    }
+}
+
+///
+/// Builds the flat layout of a geometry, nodes are written in breadth first order
+/// so that the children of a node are consecutive
+///
+class FlatWriter {
+public:
+    std::string write( const Geometry& g, const srid_t& srid ) {
+        std::deque< std::pair< size_t, const Geometry* > > queue;
+        _nodes.push_back( Node() );
+        queue.push_back( std::make_pair( size_t( 0 ), &g ) );
+
+        while ( ! queue.empty() ) {
+            const size_t index = queue.front().first;
+            const Geometry& geometry = *queue.front().second;
+            queue.pop_front();
+
+            Node node;
+            node.type  = uint8_t( geometry.geometryTypeId() );
+            node.flags = ( geometry.is3D() ? NODE_3D : 0 )
+                         | ( geometry.isMeasured() ? NODE_MEASURED : 0 )
+                         | ( geometry.isEmpty() ? NODE_EMPTY : 0 );
+
+            if ( isPointSequence( node.type ) ) {
+                _writePoints( geometry, node );
+            }
+            else {
+                std::vector< const Geometry* > children;
+                _children( geometry, children );
+                node.first = _nodes.size();
+                node.count = uint32_t( children.size() );
+                _nodes.resize( _nodes.size() + children.size() );
+
+                for ( size_t i = 0; i < children.size(); ++i ) {
+                    queue.push_back( std::make_pair( size_t( node.first + i ), children[i] ) );
+                }
+            }
+
+            _nodes[index] = node;
+        }
+
+        if ( _nodes.size() > std::numeric_limits< uint32_t >::max() ) {
+            flatError( "too many nodes" );
+        }
+
+        const size_t coordinatesOffset = HEADER_SIZE + NODE_SIZE * _nodes.size();
+        const size_t exactOffset       = coordinatesOffset + sizeof( double ) * _coordinates.size();
+
+        std::string s( exactOffset + _exact.size(), '\0' );
+        std::memcpy( &s[0], FLAT_MAGIC, sizeof( FLAT_MAGIC ) );
+        put( s, 4, FLAT_GEOMETRY_VERSION );
+        put( s, 6, uint16_t( 0 ) );
+        put( s, 8, uint32_t( srid ) );
+        put( s, 12, uint32_t( _nodes.size() ) );
+        put( s, 16, uint64_t( coordinatesOffset ) );
+        put( s, 24, uint64_t( _coordinates.size() ) );
+        put( s, 32, uint64_t( _exact.empty() ? 0 : exactOffset ) );
+        put( s, 40, uint64_t( _exact.size() ) );
+
+        for ( size_t i = 0; i < _nodes.size(); ++i ) {
+            const size_t offset = HEADER_SIZE + NODE_SIZE * i;
+            put( s, offset, _nodes[i].type );
+            put( s, offset + 1, _nodes[i].flags );
+            put( s, offset + 2, uint16_t( 0 ) );
+            put( s, offset + 4, _nodes[i].count );
+            put( s, offset + 8, _nodes[i].first );
+            put( s, offset + 16, _nodes[i].exact );
+        }
+
+        if ( ! _coordinates.empty() ) {
+            std::memcpy( &s[coordinatesOffset], &_coordinates[0], sizeof( double ) * _coordinates.size() );
+        }
+
+        if ( ! _exact.empty() ) {
+            std::memcpy( &s[exactOffset], _exact.data(), _exact.size() );
+        }
+
+        return s;
+    }
+
+private:
+    struct Node {
+        uint8_t  type;
+        uint8_t  flags;
+        uint32_t count;
+        uint64_t first;
+        uint64_t exact;
+        Node() : type( 0 ), flags( 0 ), count( 0 ), first( 0 ), exact( 0 ) {}
+    };
+
+    std::vector< Node >   _nodes;
+    std::vector< double > _coordinates;
+    std::string           _exact;
+
+    void _children( const Geometry& g, std::vector< const Geometry* >& children ) {
+        switch ( g.geometryTypeId() ) {
+        case TYPE_POLYGON: {
+            const Polygon& polygon = g.as< Polygon >();
+
+            for ( size_t i = 0; i < polygon.numRings(); ++i ) {
+                children.push_back( &polygon.ringN( i ) );
+            }
+
+            return;
+        }
+
+        case TYPE_POLYHEDRALSURFACE: {
+            const PolyhedralSurface& surface = g.as< PolyhedralSurface >();
+
+            for ( size_t i = 0; i < surface.numPolygons(); ++i ) {
+                children.push_back( &surface.polygonN( i ) );
+            }
+
+            return;
+        }
+
+        case TYPE_TRIANGULATEDSURFACE: {
+            const TriangulatedSurface& tin = g.as< TriangulatedSurface >();
+
+            for ( size_t i = 0; i < tin.numTriangles(); ++i ) {
+                children.push_back( &tin.triangleN( i ) );
+            }
+
+            return;
+        }
+
+        case TYPE_SOLID: {
+            const Solid& solid = g.as< Solid >();
+
+            for ( size_t i = 0; i < solid.numShells(); ++i ) {
+                children.push_back( &solid.shellN( i ) );
+            }
+
+            return;
+        }
+
+        default:
+            for ( size_t i = 0; i < g.numGeometries(); ++i ) {
+                children.push_back( &g.geometryN( i ) );
+            }
+        }
+    }
+
+    void _writePoints( const Geometry& g, Node& node ) {
+        node.first = _coordinates.size();
+
+        if ( g.isEmpty() ) {
+            return;
+        }
+
+        if ( g.geometryTypeId() == TYPE_LINESTRING && g.as< LineString >().isCompact() ) {
+            // coordinates are already doubles
+            const detail::CoordinateBuffer& buffer = *g.as< LineString >().coordinates();
+            node.count = uint32_t( buffer.size() );
+
+            for ( size_t i = 0; i < buffer.size(); ++i ) {
+                _pushCoordinates( node, buffer.x( i ), buffer.y( i ), buffer.z( i ), buffer.m( i ) );
+            }
+
+            return;
+        }
+
+        std::vector< const Point* > points;
+
+        switch ( g.geometryTypeId() ) {
+        case TYPE_POINT:
+            points.push_back( &g.as< Point >() );
+            break;
+
+        case TYPE_LINESTRING: {
+            const LineString& ls = g.as< LineString >();
+
+            for ( size_t i = 0; i < ls.numPoints(); ++i ) {
+                points.push_back( &ls.pointN( i ) );
+            }
+
+            break;
+        }
+
+        default: {
+            const Triangle& triangle = g.as< Triangle >();
+
+            for ( int i = 0; i < 3; ++i ) {
+                points.push_back( &triangle.vertex( i ) );
+            }
+        }
+        }
+
+        node.count = uint32_t( points.size() );
+        const bool is3D = ( node.flags & NODE_3D ) != 0;
+
+        // doubles if possible, exact values in the sidecar otherwise
+        std::vector< double > values;
+        values.reserve( points.size() * 3 );
+        bool exact = false;
+
+        for ( size_t i = 0; i < points.size() && ! exact; ++i ) {
+            double d;
+            exact = ! detail::toExactDouble( points[i]->x(), d ) || ! detail::toExactDouble( points[i]->y(), d )
+                    || ( is3D && ! detail::toExactDouble( points[i]->z(), d ) );
+        }
+
+        if ( exact ) {
+            node.flags |= NODE_EXACT;
+            node.exact  = _exact.size();
+        }
+
+        for ( size_t i = 0; i < points.size(); ++i ) {
+            const Point& p = *points[i];
+            const Kernel::FT x = p.x();
+            const Kernel::FT y = p.y();
+            const Kernel::FT z = is3D ? p.z() : Kernel::FT( 0 );
+            _pushCoordinates( node, CGAL::to_double( x ), CGAL::to_double( y ), CGAL::to_double( z ), p.m() );
+
+            if ( exact ) {
+                _pushRational( CGAL::exact( x ) );
+                _pushRational( CGAL::exact( y ) );
+
+                if ( is3D ) {
+                    _pushRational( CGAL::exact( z ) );
+                }
+            }
+        }
+    }
+
+    void _pushCoordinates( const Node& node, const double& x, const double& y, const double& z, const double& m ) {
+        _coordinates.push_back( x );
+        _coordinates.push_back( y );
+
+        if ( node.flags & NODE_3D ) {
+            _coordinates.push_back( z );
+        }
+
+        if ( node.flags & NODE_MEASURED ) {
+            _coordinates.push_back( m );
+        }
+    }
+
+    // int32 signed number of words of the numerator, uint32 number of words of
+    // the denominator, then the 64 bits words, least significant first
+    void _pushRational( const ExactFT& v ) {
+        mpq_srcptr q = toMpq( v );
+        std::vector< uint64_t > num, den;
+        _export( mpq_numref( q ), num );
+        _export( mpq_denref( q ), den );
+
+        const int32_t numSize = mpz_sgn( mpq_numref( q ) ) < 0 ? -int32_t( num.size() ) : int32_t( num.size() );
+        const uint32_t denSize = uint32_t( den.size() );
+        _exact.append( reinterpret_cast< const char* >( &numSize ), sizeof( numSize ) );
+        _exact.append( reinterpret_cast< const char* >( &denSize ), sizeof( denSize ) );
+
+        if ( ! num.empty() ) {
+            _exact.append( reinterpret_cast< const char* >( &num[0] ), sizeof( uint64_t ) * num.size() );
+        }
+
+        _exact.append( reinterpret_cast< const char* >( &den[0] ), sizeof( uint64_t ) * den.size() );
+    }
+
+    void _export( mpz_srcptr z, std::vector< uint64_t >& words ) {
+        words.resize( ( mpz_sizeinbase( z, 2 ) + 63 ) / 64 );
+        size_t count = 0;
+        mpz_export( words.empty() ? NULL : &words[0], &count, -1, sizeof( uint64_t ), 0, 0, z );
+        words.resize( count );
+    }
+};
+
+///
+/// Sequential reader of the rationals of a node in the exact sidecar
+///
+class RationalReader {
+public:
+    RationalReader( const char* begin, const char* end ):
+        _p( begin ),
+        _end( end ) {
+        mpq_init( _q );
+    }
+    ~RationalReader() {
+        mpq_clear( _q );
+    }
+
+    Kernel::FT next() {
+        if ( _end - _p < 8 ) {
+            flatError( "truncated exact coordinates" );
+        }
+
+        const int32_t numSize  = get< int32_t >( _p );
+        const uint32_t denSize = get< uint32_t >( _p + 4 );
+        const uint64_t numWords = numSize < 0 ? uint64_t( -int64_t( numSize ) ) : uint64_t( numSize );
+        _p += 8;
+
+        if ( denSize == 0 || uint64_t( _end - _p ) / sizeof( uint64_t ) < numWords + denSize ) {
+            flatError( "invalid exact coordinate" );
+        }
+
+        mpz_import( mpq_numref( _q ), numWords, -1, sizeof( uint64_t ), 0, 0, _p );
+
+        if ( numSize < 0 ) {
+            mpz_neg( mpq_numref( _q ), mpq_numref( _q ) );
+        }
+
+        _p += numWords * sizeof( uint64_t );
+        mpz_import( mpq_denref( _q ), denSize, -1, sizeof( uint64_t ), 0, 0, _p );
+        _p += denSize * sizeof( uint64_t );
+
+        if ( mpz_sgn( mpq_denref( _q ) ) == 0 ) {
+            flatError( "invalid exact coordinate" );
+        }
+
+        mpq_canonicalize( _q );
+        ExactFT v;
+        fromMpq( _q, v );
+        return Kernel::FT( v );
+    }
+
+private:
+    const char* _p;
+    const char* _end;
+    mpq_t       _q;
+
+    RationalReader( const RationalReader& );
+    RationalReader& operator = ( const RationalReader& );
+};
+
+template <class T>
+T* materializeAs( const FlatGeometryView& view, const GeometryType& type )
+{
+    if ( view.geometryTypeId() != type ) {
+        flatError( "unexpected child type" );
+    }
+
+    return static_cast< T* >( view.materialize().release() );
+}
+
+} // namespace
+
+///
+///
+///
+std::string writeFlatGeometry( const Geometry& g, const srid_t& srid )
+{
+    FlatWriter writer;
+    return writer.write( g, srid );
+}
+
+///
+///
+///
+std::string writeFlatPrepared( const PreparedGeometry& g )
+{
+    return writeFlatGeometry( g.geometry(), g.SRID() );
+}
+
+///
+///
+///
+bool FlatGeometryView::isFlatGeometry( const char* data, size_t size )
+{
+    return size >= HEADER_SIZE && std::memcmp( data, FLAT_MAGIC, sizeof( FLAT_MAGIC ) ) == 0;
+}
+
+///
+///
+///
+FlatGeometryView::FlatGeometryView( const char* data, size_t size ):
+    _data( data ),
+    _size( size ),
+    _depth( 0 )
+{
+    if ( ! isFlatGeometry( data, size ) ) {
+        flatError( "bad header" );
+    }
+
+    if ( get< uint16_t >( data + 4 ) != FLAT_GEOMETRY_VERSION ) {
+        flatError( "unsupported version" );
+    }
+
+    _srid              = get< uint32_t >( data + 8 );
+    _numNodes          = get< uint32_t >( data + 12 );
+    _coordinatesOffset = get< uint64_t >( data + 16 );
+    _numCoordinates    = get< uint64_t >( data + 24 );
+    _exactOffset       = get< uint64_t >( data + 32 );
+    _exactSize         = get< uint64_t >( data + 40 );
+
+    if ( _numNodes == 0 || ( size - HEADER_SIZE ) / NODE_SIZE < _numNodes
+            || _coordinatesOffset > size || ( size - _coordinatesOffset ) / sizeof( double ) < _numCoordinates
+            || _exactOffset > size || size - _exactOffset < _exactSize ) {
+        flatError( "truncated buffer" );
+    }
+
+    _load( 0 );
+}
+
+///
+///
+///
+FlatGeometryView::FlatGeometryView( const FlatGeometryView& parent, size_t node ):
+    _data( parent._data ),
+    _size( parent._size ),
+    _srid( parent._srid ),
+    _numNodes( parent._numNodes ),
+    _coordinatesOffset( parent._coordinatesOffset ),
+    _numCoordinates( parent._numCoordinates ),
+    _exactOffset( parent._exactOffset ),
+    _exactSize( parent._exactSize ),
+    _depth( parent._depth + 1 )
+{
+    if ( _depth > MAX_DEPTH ) {
+        flatError( "too many nested geometries" );
+    }
+
+    _load( node );
+}
+
+///
+///
+///
+void FlatGeometryView::_load( size_t node )
+{
+    BOOST_ASSERT( node < _numNodes );
+    const char* p = _data + HEADER_SIZE + NODE_SIZE * node;
+    _node  = node;
+    _type  = get< uint8_t >( p );
+    _flags = get< uint8_t >( p + 1 );
+    _count = get< uint32_t >( p + 4 );
+    _first = get< uint64_t >( p + 8 );
+    _exact = get< uint64_t >( p + 16 );
+
+    if ( ! isGeometryType( _type ) ) {
+        flatError( "unknown geometry type" );
+    }
+
+    if ( _isPointSequence() ) {
+        if ( _first > _numCoordinates || ( _numCoordinates - _first ) / _stride() < _count
+                || ( _type == TYPE_POINT && _count > 1 ) || ( _type == TYPE_TRIANGLE && _count != 0 && _count != 3 ) ) {
+            flatError( "invalid coordinates" );
+        }
+
+        if ( ( _flags & NODE_EXACT ) && _exact >= _exactSize ) {
+            flatError( "invalid exact coordinates" );
+        }
+    }
+    else if ( _count > 0 && ( _first <= node || _first > _numNodes || _numNodes - _first < _count ) ) {
+        // children follow their parent, which also prevents cycles
+        flatError( "invalid children" );
+    }
+}
+
+///
+///
+///
+bool FlatGeometryView::_isPointSequence() const
+{
+    return isPointSequence( _type );
+}
+
+///
+///
+///
+size_t FlatGeometryView::_stride() const
+{
+    return 2 + ( ( _flags & NODE_3D ) ? 1 : 0 ) + ( ( _flags & NODE_MEASURED ) ? 1 : 0 );
+}
+
+///
+///
+///
+double FlatGeometryView::_coordinate( size_t i, size_t k ) const
+{
+    BOOST_ASSERT( i < numPoints() );
+    return get< double >( _data + _coordinatesOffset + sizeof( double ) * ( _first + i * _stride() + k ) );
+}
+
+///
+///
+///
+GeometryType FlatGeometryView::geometryTypeId() const
+{
+    return GeometryType( _type );
+}
+
+///
+///
+///
+bool FlatGeometryView::isEmpty() const
+{
+    return ( _flags & NODE_EMPTY ) != 0;
+}
+
+///
+///
+///
+bool FlatGeometryView::is3D() const
+{
+    return ( _flags & NODE_3D ) != 0;
+}
+
+///
+///
+///
+bool FlatGeometryView::isMeasured() const
+{
+    return ( _flags & NODE_MEASURED ) != 0;
+}
+
+///
+///
+///
+bool FlatGeometryView::hasExactCoordinates() const
+{
+    return ( _flags & NODE_EXACT ) != 0;
+}
+
+///
+///
+///
+size_t FlatGeometryView::numChildren() const
+{
+    return _isPointSequence() ? 0 : _count;
+}
+
+///
+///
+///
+FlatGeometryView FlatGeometryView::childN( size_t n ) const
+{
+    BOOST_ASSERT( n < numChildren() );
+    return FlatGeometryView( *this, size_t( _first + n ) );
+}
+
+///
+///
+///
+size_t FlatGeometryView::numPoints() const
+{
+    return _isPointSequence() ? _count : 0;
+}
+
+///
+///
+///
+double FlatGeometryView::x( size_t i ) const
+{
+    return _coordinate( i, 0 );
+}
+
+///
+///
+///
+double FlatGeometryView::y( size_t i ) const
+{
+    return _coordinate( i, 1 );
+}
+
+///
+///
+///
+double FlatGeometryView::z( size_t i ) const
+{
+    return is3D() ? _coordinate( i, 2 ) : 0.0;
+}
+
+///
+///
+///
+double FlatGeometryView::m( size_t i ) const
+{
+    return isMeasured() ? _coordinate( i, is3D() ? 3 : 2 ) : NaN();
+}
+
+///
+///
+///
+std::unique_ptr< Geometry > FlatGeometryView::materialize() const
+{
+    switch ( _type ) {
+    case TYPE_POINT:
+    case TYPE_LINESTRING:
+    case TYPE_TRIANGLE: {
+        std::vector< Point > points;
+        points.reserve( _count );
+
+        if ( hasExactCoordinates() ) {
+            RationalReader reader( _data + _exactOffset + _exact, _data + _exactOffset + _exactSize );
+
+            for ( size_t i = 0; i < _count; ++i ) {
+                const Kernel::FT x = reader.next();
+                const Kernel::FT y = reader.next();
+
+                if ( is3D() ) {
+                    const Kernel::FT z = reader.next();
+                    points.push_back( Point( x, y, z, m( i ) ) );
+                }
+                else {
+                    points.push_back( Point( x, y ) );
+                    points.back().setM( m( i ) );
+                }
+            }
+        }
+        else if ( _type == TYPE_LINESTRING ) {
+            // doubles, build a compact LineString
+            if ( _count == 0 ) {
+                return std::unique_ptr< Geometry >( new LineString() );
+            }
+
+            detail::CoordinateBuffer buffer( is3D(), isMeasured() );
+            buffer.reserve( _count );
+
+            for ( size_t i = 0; i < _count; ++i ) {
+                buffer.push_back( x( i ), y( i ), z( i ), m( i ) );
+            }
+
+            return std::unique_ptr< Geometry >( new LineString( buffer ) );
+        }
+        else {
+            for ( size_t i = 0; i < _count; ++i ) {
+                if ( is3D() ) {
+                    points.push_back( Point( x( i ), y( i ), z( i ), m( i ) ) );
+                }
+                else {
+                    points.push_back( Point( x( i ), y( i ) ) );
+                    points.back().setM( m( i ) );
+                }
+            }
+        }
+
+        if ( _type == TYPE_POINT ) {
+            return std::unique_ptr< Geometry >( points.empty() ? new Point() : new Point( points[0] ) );
+        }
+        else if ( _type == TYPE_TRIANGLE ) {
+            return std::unique_ptr< Geometry >( points.empty() ? new Triangle() : new Triangle( points[0], points[1], points[2] ) );
+        }
+
+        return std::unique_ptr< Geometry >( new LineString( points ) );
+    }
+
+    case TYPE_POLYGON: {
+        if ( _count == 0 ) {
+            return std::unique_ptr< Geometry >( new Polygon() );
+        }
+
+        std::unique_ptr< Polygon > polygon( new Polygon( materializeAs< LineString >( childN( 0 ), TYPE_LINESTRING ) ) );
+
+        for ( size_t i = 1; i < _count; ++i ) {
+            polygon->addRing( materializeAs< LineString >( childN( i ), TYPE_LINESTRING ) );
+        }
+
+        return std::unique_ptr< Geometry >( polygon.release() );
+    }
+
+    case TYPE_POLYHEDRALSURFACE: {
+        std::unique_ptr< PolyhedralSurface > surface( new PolyhedralSurface() );
+
+        for ( size_t i = 0; i < _count; ++i ) {
+            surface->addPolygon( materializeAs< Polygon >( childN( i ), TYPE_POLYGON ) );
+        }
+
+        return std::unique_ptr< Geometry >( surface.release() );
+    }
+
+    case TYPE_TRIANGULATEDSURFACE: {
+        std::unique_ptr< TriangulatedSurface > tin( new TriangulatedSurface() );
+        tin->reserve( _count );
+
+        for ( size_t i = 0; i < _count; ++i ) {
+            tin->addTriangle( materializeAs< Triangle >( childN( i ), TYPE_TRIANGLE ) );
+        }
+
+        return std::unique_ptr< Geometry >( tin.release() );
+    }
+
+    case TYPE_SOLID: {
+        if ( _count == 0 ) {
+            return std::unique_ptr< Geometry >( new Solid() );
+        }
+
+        std::unique_ptr< Solid > solid( new Solid( materializeAs< PolyhedralSurface >( childN( 0 ), TYPE_POLYHEDRALSURFACE ) ) );
+
+        for ( size_t i = 1; i < _count; ++i ) {
+            solid->addInteriorShell( materializeAs< PolyhedralSurface >( childN( i ), TYPE_POLYHEDRALSURFACE ) );
+        }
+
+        return std::unique_ptr< Geometry >( solid.release() );
+    }
+
+    default: {
+        std::unique_ptr< GeometryCollection > collection;
+
+        switch ( _type ) {
+        case TYPE_MULTIPOINT:
+            collection.reset( new MultiPoint() );
+            break;
+
+        case TYPE_MULTILINESTRING:
+            collection.reset( new MultiLineString() );
+            break;
+
+        case TYPE_MULTIPOLYGON:
+            collection.reset( new MultiPolygon() );
+            break;
+
+        case TYPE_MULTISOLID:
+            collection.reset( new MultiSolid() );
+            break;
+
+        default:
+            collection.reset( new GeometryCollection() );
+        }
+
+        for ( size_t i = 0; i < _count; ++i ) {
+            const FlatGeometryView child = childN( i );
+
+            if ( ! isAllowedMember( _type, child.geometryTypeId() ) ) {
+                flatError( "unexpected child type" );
+            }
+
+            collection->addGeometry( child.materialize().release() );
+        }
+
+        return std::unique_ptr< Geometry >( collection.release() );
+    }
+    }
+}
+
+///
+///
+///
+std::unique_ptr< PreparedGeometry > FlatGeometryView::materializePrepared() const
+{
+    return std::unique_ptr< PreparedGeometry >( new PreparedGeometry( materialize(), _srid ) );
+}
+
+///
+///
+///
+std::unique_ptr<Geometry> readFlatGeometry( const char* data, size_t size )
+{
+    return FlatGeometryView( data, size ).materialize();
+}
+
+///
+///
+///
+std::unique_ptr<PreparedGeometry> readFlatPrepared( const char* data, size_t size )
+{
+    return FlatGeometryView( data, size ).materializePrepared();
+}
+
+}
+}
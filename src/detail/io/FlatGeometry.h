@@ -0,0 +1,183 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_IO_FLAT_GEOMETRY_H_
+#define _SFCGAL_IO_FLAT_GEOMETRY_H_
+
+#include <SFCGAL/config.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/PreparedGeometry.h>
+
+#include <memory>
+#include <string>
+
+#include <stdint.h>
+
+namespace SFCGAL {
+namespace io {
+
+/**
+ * Version of the layout written by writeFlatGeometry
+ */
+const uint16_t FLAT_GEOMETRY_VERSION = 1;
+
+/**
+ * Convert a Geometry to the flat binary layout.
+ *
+ * Unlike writeBinaryGeometry, the result can be read in place (from a memory
+ * mapped file, a database page...) with a FlatGeometryView, without building
+ * any Geometry. The layout, in host byte order, is :
+ *
+ * - a 48 bytes header : magic "SFGB", version, SRID, number of nodes and
+ *   offsets and sizes of the coordinate block and of the exact sidecar
+ * - a table of 24 bytes nodes, one per geometry, ring or shell, in breadth
+ *   first order. The root is the node 0 and the children of a node are
+ *   consecutive.
+ * - the coordinate block : doubles x,y[,z][,m] of every point, 8 bytes aligned
+ * - the exact sidecar : numerators and denominators of the coordinates which
+ *   are not exactly representable by a double (as 64 bits words)
+ *
+ * @warning resulting string may contain 0s
+ */
+SFCGAL_API std::string writeFlatGeometry( const Geometry& g, const srid_t& srid = 0 );
+
+/**
+ * Convert a PreparedGeometry to the flat binary layout (the cache is not written)
+ * @warning resulting string may contain 0s
+ */
+SFCGAL_API std::string writeFlatPrepared( const PreparedGeometry& g );
+
+/**
+ * Read only view on a geometry stored with writeFlatGeometry.
+ *
+ * The buffer is neither copied nor required to be aligned, it must outlive the view
+ * and the views returned by childN(). Offsets are checked against the buffer size,
+ * a truncated or corrupted buffer throws an Exception instead of reading out of it.
+ * Nodes nested more than 128 levels deep are rejected the same way.
+ *
+ * Coordinates returned by x(), y(), z() are the nearest doubles. materialize() builds
+ * the Geometry of a node with its exact coordinates.
+ */
+class SFCGAL_API FlatGeometryView {
+public:
+    /**
+     * View on the root geometry of a buffer
+     * @throw Exception if data is not a flat geometry of a supported version
+     */
+    FlatGeometryView( const char* data, size_t size );
+
+    /**
+     * true if data starts with the header of a flat geometry
+     */
+    static bool isFlatGeometry( const char* data, size_t size );
+
+    /**
+     * SRID of the buffer
+     */
+    inline const srid_t& SRID() const {
+        return _srid;
+    }
+
+    GeometryType geometryTypeId() const ;
+    bool         isEmpty() const ;
+    bool         is3D() const ;
+    bool         isMeasured() const ;
+    /**
+     * true if some coordinates of the node are not exactly representable by doubles
+     */
+    bool         hasExactCoordinates() const ;
+
+    /**
+     * Number of children (rings of a Polygon, polygons of a PolyhedralSurface,
+     * triangles of a TIN, shells of a Solid, geometries of a collection)
+     */
+    size_t           numChildren() const ;
+    /**
+     * n-th child
+     */
+    FlatGeometryView childN( size_t n ) const ;
+
+    /**
+     * Number of points of a Point (0 or 1), LineString or Triangle (0 or 3), 0 otherwise
+     */
+    size_t numPoints() const ;
+    double x( size_t i ) const ;
+    double y( size_t i ) const ;
+    /**
+     * z coordinate, 0 if the node is not 3D
+     */
+    double z( size_t i ) const ;
+    /**
+     * m coordinate, NaN if the node is not measured
+     */
+    double m( size_t i ) const ;
+
+    /**
+     * Build the Geometry of the node (and of its children)
+     */
+    std::unique_ptr< Geometry >         materialize() const ;
+    /**
+     * Build a PreparedGeometry with the Geometry of the node and the SRID of the buffer
+     */
+    std::unique_ptr< PreparedGeometry > materializePrepared() const ;
+
+private:
+    FlatGeometryView( const FlatGeometryView& parent, size_t node );
+
+    void _load( size_t node );
+    bool _isPointSequence() const ;
+    size_t _stride() const ;
+    double _coordinate( size_t i, size_t k ) const ;
+
+    const char* _data;
+    size_t      _size;
+    srid_t      _srid;
+    uint32_t    _numNodes;
+    uint64_t    _coordinatesOffset;
+    uint64_t    _numCoordinates;
+    uint64_t    _exactOffset;
+    uint64_t    _exactSize;
+    // nesting level of the node, 0 for the root
+    size_t      _depth;
+
+    // current node
+    size_t      _node;
+    uint8_t     _type;
+    uint8_t     _flags;
+    uint32_t    _count;
+    uint64_t    _first;
+    uint64_t    _exact;
+};
+
+/**
+ * Read a Geometry from the flat binary layout
+ */
+SFCGAL_API std::unique_ptr<Geometry> readFlatGeometry( const char* data, size_t size );
+
+/**
+ * Read a PreparedGeometry from the flat binary layout
+ */
+SFCGAL_API std::unique_ptr<PreparedGeometry> readFlatPrepared( const char* data, size_t size );
+
+}
+}
+
+#endif
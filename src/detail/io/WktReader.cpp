@@ -20,7 +20,11 @@
 
 #include <SFCGAL/detail/io/WktReader.h>
 
+#include <cctype>
 #include <memory>
+#include <string>
+
+#include <boost/algorithm/string/predicate.hpp>
 
 #include <SFCGAL/Point.h>
 #include <SFCGAL/LineString.h>
@@ -41,14 +45,119 @@ namespace SFCGAL {
 namespace detail {
 namespace io {
 
+namespace {
+
+//
+// true for the chars of a geometry text before its first parenthesis
+// (white spaces, keywords and the EWKT SRID prefix)
+bool isHeaderChar( char c )
+{
+    return std::isalnum( static_cast< unsigned char >( c ) )
+           || std::isspace( static_cast< unsigned char >( c ) )
+           || c == '=' || c == ';' || c == '(' ;
+}
+
+//
+// extracts from the stream the text of the next geometry, up to its last closing
+// parenthesis or its EMPTY keyword. The stream is left right after this text,
+// without any seek, so that pipes are supported and the following geometries
+// are not read again.
+std::string extractGeometryText( std::istream& s )
+{
+    typedef std::char_traits< char > traits;
+
+    std::string text;
+    std::streambuf* buf = s.rdbuf();
+
+    if ( ! s.good() || ! buf ) {
+        return text;
+    }
+
+    std::string word;
+    int depth = 0;
+
+    while ( true ) {
+        const traits::int_type c = buf->sgetc();
+
+        if ( traits::eq_int_type( c, traits::eof() ) ) {
+            s.setstate( std::ios_base::eofbit );
+            break;
+        }
+
+        const char ch = traits::to_char_type( c );
+
+        // not a part of this geometry, let the parser report it
+        if ( depth == 0 && ! isHeaderChar( ch ) ) {
+            break;
+        }
+
+        buf->sbumpc();
+        text += ch;
+
+        if ( ch == '(' ) {
+            ++depth;
+        }
+        else if ( ch == ')' ) {
+            if ( --depth == 0 ) {
+                break;
+            }
+        }
+        else if ( depth == 0 ) {
+            if ( ! std::isalpha( static_cast< unsigned char >( ch ) ) ) {
+                word.clear();
+                continue;
+            }
+
+            word += ch;
+
+            if ( boost::algorithm::iequals( word, "EMPTY" ) ) {
+                const traits::int_type next = buf->sgetc();
+
+                if ( traits::eq_int_type( next, traits::eof() ) || ! std::isalpha( static_cast< unsigned char >( traits::to_char_type( next ) ) ) ) {
+                    break;
+                }
+            }
+        }
+    }
+
+    return text;
+}
+
+} // namespace
+
 ///
 ///
 ///
 WktReader::WktReader( std::istream& s ):
-    _reader( s )
+    _buffer( extractGeometryText( s ) ),
+    _reader( _buffer.data(), _buffer.data() + _buffer.size() )
 {
 
+}
 
+///
+///
+///
+WktReader::WktReader( const char* begin, const char* end ):
+    _reader( begin, end )
+{
+
+}
+
+///
+///
+///
+bool WktReader::eof()
+{
+    return _reader.eof();
+}
+
+///
+///
+///
+std::string WktReader::remaining() const
+{
+    return _reader.remaining();
 }
 
 ///
@@ -59,7 +168,13 @@ srid_t WktReader::readSRID()
     srid_t srid = 0;
 
     if ( _reader.imatch( "SRID=" ) ) {
-        _reader.read( srid );
+        boost::uint32_t value = 0;
+
+        if ( ! _reader.read( value ) ) {
+            BOOST_THROW_EXCEPTION( WktParseException( parseErrorMessage() ) );
+        }
+
+        srid = value;
 
         if ( !_reader.match( ";" ) ) {
             BOOST_THROW_EXCEPTION( WktParseException( parseErrorMessage() ) );
@@ -618,53 +733,85 @@ void WktReader::readInnerMultiSolid( MultiSolid& g )
 ///
 bool WktReader::readPointCoordinate( Point& p )
 {
-    std::vector< Kernel::Exact_kernel::FT > coordinates ;
-    Kernel::Exact_kernel::FT d;
+    tools::CharArrayReader::Number coordinates[4] ;
+    size_t size = 0 ;
 
     if ( _reader.imatch( "EMPTY" ) ) {
         p = Point();
         return false;
     }
 
-    while ( _reader.read( d ) ) {
-        coordinates.push_back( d );
+    while ( size < 4 && _reader.read( coordinates[size] ) ) {
+        ++size ;
     }
 
-    if ( coordinates.size() < 2 ) {
+    if ( size < 2 ) {
         BOOST_THROW_EXCEPTION( WktParseException(
                                    ( boost::format( "WKT parse error, Coordinate dimension < 2 (%s)" ) % _reader.context() ).str()
                                ) );
     }
 
-    if ( coordinates.size() > 4 ) {
+    tools::CharArrayReader::Number extra ;
+
+    if ( size == 4 && _reader.read( extra ) ) {
         BOOST_THROW_EXCEPTION( WktParseException( "WKT parse error, Coordinate dimension > 4" ) );
     }
 
+    // coordinates exactly representable by a double are copied without building exact numbers
+    // (M is only stored as a double)
+    const size_t nXYZ = ( _is3D || ( ! _isMeasured && size == 3 ) ) ? 3 : 2 ;
+    bool isDouble = true ;
+
+    for ( size_t i = 0; i < nXYZ && i < size; i++ ) {
+        isDouble = isDouble && coordinates[i].isDouble ;
+    }
+
     if ( _isMeasured && _is3D ) {
         // XYZM
-        if ( coordinates.size() != 4 ) {
+        if ( size != 4 ) {
             BOOST_THROW_EXCEPTION( WktParseException( "bad coordinate dimension" ) );
         }
 
-        p = Point( coordinates[0], coordinates[1], coordinates[2] );
-        p.setM( CGAL::to_double(coordinates[3]) );
+        if ( isDouble ) {
+            p = Point( coordinates[0].value, coordinates[1].value, coordinates[2].value, coordinates[3].toDouble() );
+        }
+        else {
+            p = Point( coordinates[0].toFT(), coordinates[1].toFT(), coordinates[2].toFT() );
+            p.setM( coordinates[3].toDouble() );
+        }
     }
     else if ( _isMeasured && ! _is3D ) {
         // XYM
-        if ( coordinates.size() != 3 ) {
+        if ( size != 3 ) {
             BOOST_THROW_EXCEPTION( WktParseException( "bad coordinate dimension (expecting XYM coordinates)" ) );
         }
 
-        p = Point( coordinates[0], coordinates[1] );
-        p.setM( CGAL::to_double(coordinates[2]) );
+        if ( isDouble ) {
+            p = Point( coordinates[0].value, coordinates[1].value );
+        }
+        else {
+            p = Point( coordinates[0].toFT(), coordinates[1].toFT() );
+        }
+
+        p.setM( coordinates[2].toDouble() );
     }
-    else if ( coordinates.size() == 3 ) {
+    else if ( size == 3 ) {
         // XYZ
-        p = Point( coordinates[0], coordinates[1], coordinates[2] );
+        if ( isDouble ) {
+            p = Point( coordinates[0].value, coordinates[1].value, coordinates[2].value );
+        }
+        else {
+            p = Point( coordinates[0].toFT(), coordinates[1].toFT(), coordinates[2].toFT() );
+        }
     }
     else {
         // XY
-        p = Point( coordinates[0], coordinates[1] );
+        if ( isDouble ) {
+            p = Point( coordinates[0].value, coordinates[1].value );
+        }
+        else {
+            p = Point( coordinates[0].toFT(), coordinates[1].toFT() );
+        }
     }
 
     return true ;
@@ -28,7 +28,7 @@
 #include <SFCGAL/Geometry.h>
 #include <SFCGAL/PreparedGeometry.h>
 
-#include <SFCGAL/detail/tools/InputStreamReader.h>
+#include <SFCGAL/detail/tools/CharArrayReader.h>
 
 namespace SFCGAL {
 namespace detail {
@@ -44,8 +44,26 @@ class SFCGAL_API WktReader {
 public:
     /**
      * read WKT from input stream
+     *
+     * The text of one geometry is extracted from the stream, which is left right
+     * after it (no seek, pipes are supported).
      */
     WktReader( std::istream& s );
+    /**
+     * read WKT from the char array [begin,end)
+     *
+     * @warning the array must outlive the reader
+     */
+    WktReader( const char* begin, const char* end );
+
+    /**
+     * true if only white spaces remain after the text read so far
+     */
+    bool          eof() ;
+    /**
+     * text remaining after the text read so far
+     */
+    std::string   remaining() const ;
 
     /**
      * read an SRID, if present
@@ -141,9 +159,13 @@ public:
 
 private:
     /**
-     * input stream
+     * text of the geometry extracted from the input stream, if any
+     */
+    std::string _buffer ;
+    /**
+     * reader on the WKT text
      */
-    tools::InputStreamReader _reader;
+    tools::CharArrayReader _reader;
 
     /**
      * actually reading 3D ?
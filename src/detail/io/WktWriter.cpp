@@ -33,6 +33,12 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 
+#include <algorithm>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <exception>
 #include <boost/exception/all.hpp>
 
@@ -41,31 +47,141 @@ namespace detail {
 namespace io {
 
 namespace impl {
-std::ostream& writeFT(std::ostream& s, const CGAL::Gmpq& ft)
+
+///
+/// append a rational as num/den
+///
+void appendRational( std::string& out, mpq_srcptr q )
+{
+    // mpz_get_str writes the sign and a terminating null character
+    const size_t pos = out.size();
+    out.resize( pos + mpz_sizeinbase( mpq_numref( q ), 10 ) + mpz_sizeinbase( mpq_denref( q ), 10 ) + 5 );
+    char* p = &out[pos];
+    mpz_get_str( p, 10, mpq_numref( q ) );
+    p += std::strlen( p );
+    *p++ = '/';
+    mpz_get_str( p, 10, mpq_denref( q ) );
+    p += std::strlen( p );
+    out.resize( p - out.data() );
+}
+
+void writeFT( std::string& out, const CGAL::Gmpq& ft )
 {
-  s << ft;
-  return s;
+    appendRational( out, ft.mpq() );
 }
 
 #ifdef CGAL_USE_GMPXX
-std::ostream& writeFT(std::ostream& s, const mpq_class& ft)
+void writeFT( std::string& out, const mpq_class& ft )
 {
-  s << ft.get_num() << "/" << ft.get_den();
-  return s;
+    appendRational( out, ft.get_mpq_t() );
 }
 #endif
+
+///
+/// replace the decimal point of the C locale (LC_NUMERIC) by '.' in the n chars
+/// of a number printed by printf, returns the new length
+///
+int normalizeDecimalPoint( char* buf, int n )
+{
+    const char* point = std::localeconv()->decimal_point;
+
+    if ( point[0] == '.' && point[1] == '\0' ) {
+        return n;
+    }
+
+    const size_t length = std::strlen( point );
+    char* found = std::search( buf, buf + n, point, point + length );
+
+    if ( length == 0 || found == buf + n ) {
+        return n;
+    }
+
+    *found = '.';
+    std::memmove( found + 1, found + length, ( buf + n ) - ( found + length ) );
+    return n - static_cast< int >( length - 1 );
+}
+
+///
+/// append a double with a printf format taking a precision, whatever the locale
+///
+void appendDouble( std::string& out, const char* format, int precision, const double& v )
+{
+    char buf[64];
+    const int n = std::snprintf( buf, sizeof( buf ), format, precision, v );
+
+    if ( n < 0 ) {
+        return;
+    }
+
+    if ( static_cast< size_t >( n ) < sizeof( buf ) ) {
+        out.append( buf, normalizeDecimalPoint( buf, n ) );
+        return;
+    }
+
+    // large numbers in fixed notation
+    const size_t pos = out.size();
+    out.resize( pos + n + 1 );
+    std::snprintf( &out[pos], n + 1, format, precision, v );
+    out.resize( pos + normalizeDecimalPoint( &out[pos], n ) );
+}
+
+///
+/// append the shortest %g representation of a double reading back to the same double
+///
+void appendShortestDouble( std::string& out, const double& v )
+{
+    if ( ! std::isfinite( v ) ) {
+        appendDouble( out, "%.*g", 17, v );
+        return;
+    }
+
+    // 17 significant digits always round trip, and a shorter representation
+    // is found by the rounding to 15 or 16 digits (trailing zeros are removed by %g)
+    char buf[32];
+
+    for ( int precision = 15; precision < 17; precision++ ) {
+        const int n = std::snprintf( buf, sizeof( buf ), "%.*g", precision, v );
+
+        // strtod reads the decimal point of the locale printf wrote
+        if ( std::strtod( buf, NULL ) == v ) {
+            out.append( buf, normalizeDecimalPoint( buf, n ) );
+            return;
+        }
+    }
+
+    appendDouble( out, "%.*g", 17, v );
+}
 } //end of impl namespace
 
 ///
 ///
 ///
 WktWriter::WktWriter( std::ostream& s ):
-    _s( s ),
+    _s( &s ),
+    _out( &_streamBuffer ),
+    _format( ( s.flags() & std::ios::floatfield ) == std::ios::fixed ? FORMAT_FIXED : FORMAT_GENERAL ),
+    _precision( static_cast< int >( s.precision() ) ),
+    _exactWrite( false )
+{
+
+}
+
+///
+///
+///
+WktWriter::WktWriter( std::string& buffer, const int& numDecimals ):
+    _s( NULL ),
+    _out( &buffer ),
+    _format( numDecimals >= 0 ? FORMAT_FIXED : FORMAT_SHORTEST ),
+    _precision( numDecimals ),
     _exactWrite( false )
 {
 
 }
 
+///
+///
+///
 void WktWriter::writeRec( const Geometry& g )
 {
     switch( g.geometryTypeId() ) {
@@ -130,6 +246,57 @@ void WktWriter::write( const Geometry& g, bool exact )
 {
     _exactWrite = exact;
     writeRec( g );
+
+    if ( _s ) {
+        _s->write( _streamBuffer.data(), _streamBuffer.size() );
+        _streamBuffer.clear();
+    }
+}
+
+///
+///
+///
+void WktWriter::writeNumber( const Kernel::FT& v )
+{
+    if ( _exactWrite ) {
+        impl::writeFT( *_out, CGAL::exact( v ) );
+    }
+    else {
+        writeNumber( CGAL::to_double( v ) );
+    }
+}
+
+///
+///
+///
+void WktWriter::writeNumber( const double& v )
+{
+    switch ( _format ) {
+    case FORMAT_FIXED:
+        impl::appendDouble( *_out, "%.*f", _precision, v );
+        return;
+
+    case FORMAT_GENERAL:
+        impl::appendDouble( *_out, "%.*g", _precision, v );
+        return;
+
+    case FORMAT_SHORTEST:
+        impl::appendShortestDouble( *_out, v );
+        return;
+    }
+}
+
+///
+///
+///
+void WktWriter::writeExactNumber( const double& v )
+{
+    if ( _exactWrite ) {
+        impl::writeFT( *_out, Kernel::Exact_kernel::FT( v ) );
+    }
+    else {
+        writeNumber( v );
+    }
 }
 
 ///
@@ -138,10 +305,10 @@ void WktWriter::write( const Geometry& g, bool exact )
 void WktWriter::writeCoordinateType( const Geometry& g )
 {
     if ( g.is3D() && g.isMeasured() ) {
-        _s << " ZM";
+        *_out += " ZM";
     }
     else if ( ! g.is3D() && g.isMeasured() ) {
-        _s << " M";
+        *_out += " M";
     }
 }
 
@@ -150,26 +317,19 @@ void WktWriter::writeCoordinateType( const Geometry& g )
 ///
 void WktWriter::writeCoordinate( const Point& g )
 {
-    if ( _exactWrite ) {
-        impl::writeFT(_s, CGAL::exact( g.x() )) << " ";
-        impl::writeFT(_s, CGAL::exact( g.y() ));
+    writeNumber( g.x() );
+    *_out += ' ';
+    writeNumber( g.y() );
 
-        if ( g.is3D() ) {
-            _s << " ";
-            impl::writeFT(_s, CGAL::exact( g.z() ));
-        }
-    }
-    else {
-        _s << g.x() << " " << g.y() ;
-
-        if ( g.is3D() ) {
-            _s << " " << g.z() ;
-        }
+    if ( g.is3D() ) {
+        *_out += ' ';
+        writeNumber( g.z() );
     }
 
     // m coordinate
     if ( g.isMeasured() ) {
-        _s << " " << g.m() ;
+        *_out += ' ';
+        writeNumber( g.m() );
     }
 }
 
@@ -178,11 +338,11 @@ void WktWriter::writeCoordinate( const Point& g )
 ///
 void WktWriter::write( const Point& g )
 {
-    _s << "POINT" ;
+    *_out += "POINT" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
@@ -195,13 +355,13 @@ void WktWriter::write( const Point& g )
 void WktWriter::writeInner( const Point& g )
 {
     if ( g.isEmpty() ) {
-        _s << "EMPTY" ;
+        *_out += "EMPTY" ;
         return ;
     }
 
-    _s << "(";
+    *_out += "(";
     writeCoordinate( g );
-    _s << ")";
+    *_out += ")";
 }
 
 ///
@@ -209,11 +369,11 @@ void WktWriter::writeInner( const Point& g )
 ///
 void WktWriter::write( const LineString& g )
 {
-    _s << "LINESTRING" ;
+    *_out += "LINESTRING" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
@@ -225,17 +385,43 @@ void WktWriter::write( const LineString& g )
 ///
 void WktWriter::writeInner( const LineString& g )
 {
-    _s << "(";
+    *_out += "(";
+
+    if ( const CoordinateBuffer* coordinates = g.coordinates() ) {
+        // compact LineString, no Point to build
+        for ( size_t i = 0; i < coordinates->size(); i++ ) {
+            if ( i != 0 ) {
+                *_out += ",";
+            }
+
+            writeExactNumber( coordinates->x( i ) );
+            *_out += ' ';
+            writeExactNumber( coordinates->y( i ) );
+
+            if ( coordinates->is3D() ) {
+                *_out += ' ';
+                writeExactNumber( coordinates->z( i ) );
+            }
+
+            if ( coordinates->isMeasured() ) {
+                *_out += ' ';
+                writeNumber( coordinates->m( i ) );
+            }
+        }
+
+        *_out += ")";
+        return;
+    }
 
     for ( size_t i = 0; i < g.numPoints(); i++ ) {
         if ( i != 0 ) {
-            _s << ",";
+            *_out += ",";
         }
 
         writeCoordinate( g.pointN( i ) );
     }
 
-    _s << ")";
+    *_out += ")";
 }
 
 
@@ -244,11 +430,11 @@ void WktWriter::writeInner( const LineString& g )
 ///
 void WktWriter::write( const Polygon& g )
 {
-    _s << "POLYGON" ;
+    *_out += "POLYGON" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
@@ -260,15 +446,15 @@ void WktWriter::write( const Polygon& g )
 ///
 void WktWriter::writeInner( const Polygon& g )
 {
-    _s << "(";
+    *_out += "(";
     writeInner( g.exteriorRing() );
 
     for ( size_t i = 0; i < g.numInteriorRings(); i++ ) {
-        _s << ",";
+        *_out += ",";
         writeInner( g.interiorRingN( i ) );
     }
 
-    _s << ")";
+    *_out += ")";
 }
 
 ///
@@ -276,25 +462,25 @@ void WktWriter::writeInner( const Polygon& g )
 ///
 void WktWriter::write( const GeometryCollection& g )
 {
-    _s << "GEOMETRYCOLLECTION" ;
+    *_out += "GEOMETRYCOLLECTION" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
-    _s << "(" ;
+    *_out += "(" ;
 
     for ( size_t i = 0 ; i < g.numGeometries(); i++ ) {
         if ( i != 0 ) {
-            _s << ",";
+            *_out += ",";
         }
 
         writeRec( g.geometryN( i ) );
     }
 
-    _s << ")" ;
+    *_out += ")" ;
 }
 
 ///
@@ -302,25 +488,25 @@ void WktWriter::write( const GeometryCollection& g )
 ///
 void WktWriter::write( const MultiPoint& g )
 {
-    _s << "MULTIPOINT" ;
+    *_out += "MULTIPOINT" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
-    _s << "(";
+    *_out += "(";
 
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
         if ( i != 0 ) {
-            _s << "," ;
+            *_out += "," ;
         }
 
         writeInner( g.geometryN( i ).as< Point >() );
     }
 
-    _s << ")";
+    *_out += ")";
 }
 
 ///
@@ -328,25 +514,25 @@ void WktWriter::write( const MultiPoint& g )
 ///
 void WktWriter::write( const MultiLineString& g )
 {
-    _s << "MULTILINESTRING" ;
+    *_out += "MULTILINESTRING" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
-    _s << "(";
+    *_out += "(";
 
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
         if ( i != 0 ) {
-            _s << "," ;
+            *_out += "," ;
         }
 
         writeInner( g.geometryN( i ).as< LineString >() );
     }
 
-    _s << ")";
+    *_out += ")";
 }
 
 ///
@@ -354,25 +540,25 @@ void WktWriter::write( const MultiLineString& g )
 ///
 void WktWriter::write( const MultiPolygon& g )
 {
-    _s << "MULTIPOLYGON" ;
+    *_out += "MULTIPOLYGON" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
-    _s << "(";
+    *_out += "(";
 
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
         if ( i != 0 ) {
-            _s << "," ;
+            *_out += "," ;
         }
 
         writeInner( g.geometryN( i ).as< Polygon >() );
     }
 
-    _s << ")";
+    *_out += ")";
 }
 
 
@@ -381,25 +567,25 @@ void WktWriter::write( const MultiPolygon& g )
 ///
 void WktWriter::write( const MultiSolid& g )
 {
-    _s << "MULTISOLID" ;
+    *_out += "MULTISOLID" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
-    _s << "(";
+    *_out += "(";
 
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
         if ( i != 0 ) {
-            _s << "," ;
+            *_out += "," ;
         }
 
         writeInner( g.geometryN( i ).as< Solid >() );
     }
 
-    _s << ")";
+    *_out += ")";
 }
 
 ///
@@ -407,11 +593,11 @@ void WktWriter::write( const MultiSolid& g )
 ///
 void WktWriter::write( const Triangle& g )
 {
-    _s << "TRIANGLE" ;
+    *_out += "TRIANGLE" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
@@ -423,20 +609,20 @@ void WktWriter::write( const Triangle& g )
 ///
 void WktWriter::writeInner( const Triangle& g )
 {
-    _s << "(";
-    _s << "(";
+    *_out += "(";
+    *_out += "(";
 
     //close triangle
     for ( size_t i = 0; i < 4; i++ ) {
         if ( i != 0 ) {
-            _s << "," ;
+            *_out += "," ;
         }
 
         writeCoordinate( g.vertex( i ) );
     }
 
-    _s << ")";
-    _s << ")";
+    *_out += ")";
+    *_out += ")";
 }
 
 ///
@@ -444,25 +630,25 @@ void WktWriter::writeInner( const Triangle& g )
 ///
 void WktWriter::write( const TriangulatedSurface& g )
 {
-    _s << "TIN" ;
+    *_out += "TIN" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
-    _s << "(" ; //begin TIN
+    *_out += "(" ; //begin TIN
 
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
         if ( i != 0 ) {
-            _s << ",";
+            *_out += ",";
         }
 
         writeInner( g.geometryN( i ) );
     }
 
-    _s << ")" ; //end TIN
+    *_out += ")" ; //end TIN
 }
 
 
@@ -471,11 +657,11 @@ void WktWriter::write( const TriangulatedSurface& g )
 ///
 void WktWriter::write( const PolyhedralSurface& g )
 {
-    _s << "POLYHEDRALSURFACE" ;
+    *_out += "POLYHEDRALSURFACE" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
@@ -487,17 +673,17 @@ void WktWriter::write( const PolyhedralSurface& g )
 ///
 void WktWriter::writeInner( const PolyhedralSurface& g )
 {
-    _s << "(" ; //begin POLYHEDRALSURFACE
+    *_out += "(" ; //begin POLYHEDRALSURFACE
 
     for ( size_t i = 0; i < g.numPolygons(); i++ ) {
         if ( i != 0 ) {
-            _s << ",";
+            *_out += ",";
         }
 
         writeInner( g.polygonN( i ) );
     }
 
-    _s << ")" ; //end POLYHEDRALSURFACE
+    *_out += ")" ; //end POLYHEDRALSURFACE
 }
 
 ///
@@ -505,11 +691,11 @@ void WktWriter::writeInner( const PolyhedralSurface& g )
 ///
 void WktWriter::write( const Solid& g )
 {
-    _s << "SOLID" ;
+    *_out += "SOLID" ;
     writeCoordinateType( g );
 
     if ( g.isEmpty() ) {
-        _s << " EMPTY" ;
+        *_out += " EMPTY" ;
         return ;
     }
 
@@ -521,15 +707,15 @@ void WktWriter::write( const Solid& g )
 ///
 void WktWriter::writeInner( const Solid& g )
 {
-    _s << "(" ; //begin SOLID
+    *_out += "(" ; //begin SOLID
     writeInner( g.exteriorShell() );
 
     for ( size_t i = 0; i < g.numInteriorShells(); i++ ) {
-        _s << ",";
+        *_out += ",";
         writeInner( g.interiorShellN( i ) );
     }
 
-    _s << ")" ; //end SOLID
+    *_out += ")" ; //end SOLID
 }
 
 
@@ -22,8 +22,10 @@
 #define _SFCGAL_IO_WKTWRITER_H_
 
 #include <sstream>
+#include <string>
 
 #include <SFCGAL/config.h>
+#include <SFCGAL/Kernel.h>
 #include <SFCGAL/Geometry.h>
 
 namespace SFCGAL {
@@ -33,12 +35,25 @@ namespace io {
 /**
  * Writer for WKT
  *
+ * The text is appended to a std::string, numbers are formatted without ostream.
+ *
  * @warning Triangles are transformed into polygons
  */
 class SFCGAL_API WktWriter {
 public:
+    /**
+     * Writes to a stream. Non exact numbers are formatted according to
+     * the precision and the std::fixed flag of s.
+     */
     WktWriter( std::ostream& s ) ;
 
+    /**
+     * Appends to buffer
+     * @param numDecimals number of decimals of non exact numbers, a negative value
+     * for the shortest decimal representation which reads back to the same double
+     */
+    WktWriter( std::string& buffer, const int& numDecimals = -1 ) ;
+
     /**
      * @todo replace with visitor dispatch
      */
@@ -82,7 +97,33 @@ protected:
     // for recursive call use
     void writeRec( const Geometry& g ) ;
 private:
-    std::ostream& _s ;
+    /**
+     * format of non exact numbers
+     */
+    enum NumberFormat {
+        FORMAT_FIXED,    ///< printf %.<precision>f
+        FORMAT_GENERAL,  ///< printf %.<precision>g
+        FORMAT_SHORTEST  ///< shortest representation reading back to the same double
+    };
+
+    void writeNumber( const Kernel::FT& v ) ;
+    void writeNumber( const double& v ) ;
+    void writeExactNumber( const double& v ) ;
+
+    /**
+     * stream to flush to (NULL if appending to a string)
+     */
+    std::ostream* _s ;
+    /**
+     * text buffer when writing to a stream
+     */
+    std::string _streamBuffer ;
+    /**
+     * output text
+     */
+    std::string* _out ;
+    NumberFormat _format ;
+    int _precision ;
     bool _exactWrite;
 };
 
@@ -0,0 +1,374 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/detail/tools/CharArrayReader.h>
+
+#include <cmath>
+#include <cstdlib>
+
+namespace SFCGAL {
+namespace tools {
+
+namespace {
+
+// number of decimal digits exactly held by a double mantissa
+const int MAX_DOUBLE_DIGITS = 15;
+
+// largest power of ten exactly representable by a double
+const int MAX_DOUBLE_POW10 = 22;
+
+// decimal exponent beyond the range of doubles (1.8e308, 4.9e-324), numbers whose
+// exponent exceeds it by more than their number of digits are rejected so that the
+// size of an exact value is bounded by the size of the text
+const long MAX_EXPONENT10 = 350;
+
+const double POW10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+inline bool isDigit( char c )
+{
+    return c >= '0' && c <= '9';
+}
+
+//
+// value of the digits of [begin,end), skipping the '.'
+// @pre at most MAX_DOUBLE_DIGITS digits
+boost::uint64_t digitsValue( const char* begin, const char* end )
+{
+    boost::uint64_t value = 0;
+
+    for ( const char* c = begin; c != end; ++c ) {
+        if ( *c != '.' ) {
+            value = value * 10 + ( *c - '0' );
+        }
+    }
+
+    return value;
+}
+
+//
+// exact value of the digits of [begin,end), skipping the '.'
+CharArrayReader::ExactNumber exactDigitsValue( const char* begin, const char* end )
+{
+    typedef CharArrayReader::ExactNumber ET;
+    ET value( 0 );
+    boost::uint64_t chunk = 0;
+    int chunkDigits = 0;
+
+    // chunks of digits are exact doubles
+    for ( const char* c = begin; c != end; ++c ) {
+        if ( *c == '.' ) {
+            continue;
+        }
+
+        chunk = chunk * 10 + ( *c - '0' );
+
+        if ( ++chunkDigits == MAX_DOUBLE_DIGITS ) {
+            value = value * ET( POW10[chunkDigits] ) + ET( double( chunk ) );
+            chunk = 0;
+            chunkDigits = 0;
+        }
+    }
+
+    if ( chunkDigits ) {
+        value = value * ET( POW10[chunkDigits] ) + ET( double( chunk ) );
+    }
+
+    return value;
+}
+
+//
+// exact 10^n
+CharArrayReader::ExactNumber exactPow10( long n )
+{
+    typedef CharArrayReader::ExactNumber ET;
+    ET result( 1 );
+    ET base( 10 );
+
+    for ( ; n > 0; n >>= 1 ) {
+        if ( n & 1 ) {
+            result = result * base;
+        }
+
+        if ( n > 1 ) {
+            base = base * base;
+        }
+    }
+
+    return result;
+}
+
+}
+
+///
+///
+///
+bool CharArrayReader::match( const char* str )
+{
+    skipWhiteSpaces();
+    const char* p = _p;
+
+    for ( ; *str; ++str, ++p ) {
+        if ( p == _end || *p != *str ) {
+            return false;
+        }
+    }
+
+    _p = p;
+    return true;
+}
+
+///
+///
+///
+bool CharArrayReader::imatch( const char* str )
+{
+    skipWhiteSpaces();
+    const char* p = _p;
+
+    for ( ; *str; ++str, ++p ) {
+        if ( p == _end || ::tolower( static_cast< unsigned char >( *p ) ) != ::tolower( static_cast< unsigned char >( *str ) ) ) {
+            return false;
+        }
+    }
+
+    _p = p;
+    return true;
+}
+
+///
+///
+///
+bool CharArrayReader::read( boost::uint32_t& value )
+{
+    skipWhiteSpaces();
+    const char* p = _p;
+    boost::uint64_t v = 0;
+
+    for ( ; p != _end && isDigit( *p ); ++p ) {
+        v = v * 10 + ( *p - '0' );
+
+        if ( v > 0xFFFFFFFFu ) {
+            return false;
+        }
+    }
+
+    if ( p == _p ) {
+        return false;
+    }
+
+    value = boost::uint32_t( v );
+    _p = p;
+    return true;
+}
+
+///
+///
+///
+bool CharArrayReader::read( Number& value )
+{
+    skipWhiteSpaces();
+    const char* p = _p;
+
+    bool negative = false;
+
+    if ( p != _end && ( *p == '-' || *p == '+' ) ) {
+        negative = ( *p == '-' );
+        ++p;
+    }
+
+    // mantissa, with an optional '.'
+    const char* mantissaBegin = p;
+    int numDigits = 0;
+    int numDecimals = 0;
+
+    for ( ; p != _end && isDigit( *p ); ++p ) {
+        ++numDigits;
+    }
+
+    if ( p != _end && *p == '.' ) {
+        for ( ++p; p != _end && isDigit( *p ); ++p ) {
+            ++numDigits;
+            ++numDecimals;
+        }
+    }
+
+    const char* mantissaEnd = p;
+
+    if ( numDigits == 0 ) {
+        return false;
+    }
+
+    // leading zeros are not significant
+    const char* significantBegin = mantissaBegin;
+    int numSignificantDigits = numDigits;
+
+    while ( significantBegin != mantissaEnd && ( *significantBegin == '0' || *significantBegin == '.' ) ) {
+        if ( *significantBegin == '0' ) {
+            --numSignificantDigits;
+        }
+
+        ++significantBegin;
+    }
+
+    // optional exponent (left unread if not followed by digits)
+    long exponent = 0;
+
+    if ( p != _end && ( *p == 'e' || *p == 'E' ) ) {
+        const char* q = p + 1;
+        bool negativeExponent = false;
+
+        if ( q != _end && ( *q == '-' || *q == '+' ) ) {
+            negativeExponent = ( *q == '-' );
+            ++q;
+        }
+
+        if ( q != _end && isDigit( *q ) ) {
+            for ( ; q != _end && isDigit( *q ); ++q ) {
+                exponent = exponent * 10 + ( *q - '0' );
+
+                if ( exponent > 100000000L ) {
+                    return false;
+                }
+            }
+
+            if ( negativeExponent ) {
+                exponent = -exponent;
+            }
+
+            p = q;
+        }
+    }
+
+    // optional denominator for integers
+    const char* denominatorBegin = p;
+    const char* denominatorEnd = p;
+
+    if ( numDecimals == 0 && p == mantissaEnd && p != _end && *p == '/'
+            && p + 1 != _end && isDigit( p[1] ) ) {
+        denominatorBegin = ++p;
+
+        for ( ; p != _end && isDigit( *p ); ++p ) {}
+
+        denominatorEnd = p;
+    }
+
+    const long exponent10 = exponent - numDecimals;
+
+    if ( numSignificantDigits > 0 && std::labs( exponent10 ) > MAX_EXPONENT10 + numDigits ) {
+        return false;
+    }
+
+    bool isDouble = false;
+    double v = 0.0;
+
+    if ( denominatorBegin == denominatorEnd && numSignificantDigits <= MAX_DOUBLE_DIGITS ) {
+        // exact double if m * 10^e is an integer lower than 2^53 or a multiple of 5^-e
+        const boost::uint64_t m = digitsValue( significantBegin, mantissaEnd );
+        const boost::uint64_t maxInteger = boost::uint64_t( 1 ) << 53;
+
+        if ( m == 0 ) {
+            isDouble = true;
+        }
+        else if ( exponent10 >= 0 && exponent10 <= MAX_DOUBLE_POW10 ) {
+            const boost::uint64_t scale = boost::uint64_t( POW10[exponent10] );
+
+            if ( exponent10 < 16 && m <= maxInteger / scale ) {
+                v = double( m * scale );
+                isDouble = true;
+            }
+        }
+        else if ( exponent10 < 0 && exponent10 >= -MAX_DOUBLE_POW10 ) {
+            boost::uint64_t pow5 = 1;
+
+            for ( long i = 0; i < -exponent10; i++ ) {
+                pow5 *= 5;
+            }
+
+            if ( m % pow5 == 0 ) {
+                v = std::ldexp( double( m / pow5 ), int( exponent10 ) );
+                isDouble = true;
+            }
+        }
+    }
+
+    value.isDouble = isDouble;
+
+    if ( isDouble ) {
+        value.value = negative ? -v : v;
+        value.exact = boost::none;
+    }
+    else {
+        ExactNumber exact = exactDigitsValue( significantBegin, mantissaEnd );
+
+        if ( denominatorBegin != denominatorEnd ) {
+            const ExactNumber denominator = exactDigitsValue( denominatorBegin, denominatorEnd );
+
+            if ( denominator == 0 ) {
+                return false;
+            }
+
+            exact = exact / denominator;
+        }
+        else if ( exponent10 > 0 ) {
+            exact = exact * exactPow10( exponent10 );
+        }
+        else if ( exponent10 < 0 ) {
+            exact = exact / exactPow10( -exponent10 );
+        }
+
+        value.exact = negative ? -exact : exact;
+    }
+
+    _p = p;
+    return true;
+}
+
+///
+///
+///
+bool CharArrayReader::read( ExactNumber& value )
+{
+    Number n;
+
+    if ( ! read( n ) ) {
+        return false;
+    }
+
+    value = n.toExact();
+    return true;
+}
+
+///
+///
+///
+std::string CharArrayReader::context( size_t nMax ) const
+{
+    if ( size_t( _end - _p ) <= nMax ) {
+        return std::string( _p, _end );
+    }
+
+    return std::string( _p, _p + nMax ) + "...";
+}
+
+}//tools
+}//SFCGAL
@@ -0,0 +1,171 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_TOOLS_CHARARRAYREADER_H_
+#define _SFCGAL_TOOLS_CHARARRAYREADER_H_
+
+#include <SFCGAL/config.h>
+
+#include <cctype>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/optional.hpp>
+
+#include <SFCGAL/Kernel.h>
+
+namespace SFCGAL {
+namespace tools {
+
+/**
+ * Helper class to parse text from a contiguous buffer.
+ *
+ * Pointer based counterpart of BasicInputStreamReader : a failed match or read
+ * leaves the position unchanged, without stream state to save and restore.
+ * White spaces are skipped before each token.
+ */
+class SFCGAL_API CharArrayReader {
+public:
+    typedef Kernel::Exact_kernel::FT ExactNumber;
+
+    /**
+     * A decimal or rational number, stored as a double if it is exactly
+     * representable by a double
+     */
+    struct Number {
+        bool                            isDouble;
+        double                          value;
+        boost::optional< ExactNumber >  exact; ///< set if ! isDouble
+
+        /**
+         * the number as a Kernel number
+         */
+        Kernel::FT toFT() const {
+            return isDouble ? Kernel::FT( value ) : Kernel::FT( *exact );
+        }
+        /**
+         * the number as an exact number
+         */
+        ExactNumber toExact() const {
+            return isDouble ? ExactNumber( value ) : *exact;
+        }
+        /**
+         * the number rounded to a double
+         */
+        double toDouble() const {
+            return isDouble ? value : CGAL::to_double( *exact );
+        }
+    };
+
+    /// \brief constructor with the buffer [begin,end)
+    CharArrayReader( const char* begin, const char* end ) :
+        _begin( begin ),
+        _p( begin ),
+        _end( end ) {
+    }
+
+    /// \brief try to match a char
+    inline bool match( char c ) {
+        skipWhiteSpaces();
+
+        if ( _p != _end && *_p == c ) {
+            ++_p;
+            return true;
+        }
+
+        return false;
+    }
+
+    /// \brief try to match a char, case-insensitive variant
+    inline bool imatch( char c ) {
+        skipWhiteSpaces();
+
+        if ( _p != _end && ::tolower( static_cast< unsigned char >( *_p ) ) == ::tolower( static_cast< unsigned char >( c ) ) ) {
+            ++_p;
+            return true;
+        }
+
+        return false;
+    }
+
+    /// \brief try to match a null terminated string
+    bool match( const char* str ) ;
+
+    /// \brief try to match a null terminated string, case-insensitive variant
+    bool imatch( const char* str ) ;
+
+    /**
+     * try to read an unsigned integer
+     */
+    bool read( boost::uint32_t& value ) ;
+
+    /**
+     * try to read a number : [+-]digits[.digits][(e|E)[+-]digits] or [+-]digits/digits
+     *
+     * Fails on a non zero number far beyond the range of doubles (an exponent
+     * exceeding 350 by more than the number of digits).
+     */
+    bool read( Number& value ) ;
+
+    /**
+     * try to read a number as an exact number
+     */
+    bool read( ExactNumber& value ) ;
+
+    /// \brief test if the end of the buffer is reached (white spaces excepted)
+    inline bool eof() {
+        skipWhiteSpaces();
+        return _p == _end;
+    }
+
+    /// \brief number of chars read from the beginning of the buffer
+    inline size_t consumed() const {
+        return _p - _begin;
+    }
+
+    /**
+     * returns the text from the current position to the end of the buffer
+     */
+    inline std::string remaining() const {
+        return std::string( _p, _end );
+    }
+
+    /**
+     * returns a string corresponding to the current state
+     */
+    std::string context( size_t nMax = 20 ) const ;
+
+private:
+    const char* _begin ;
+    const char* _p ;
+    const char* _end ;
+
+    /// \brief skip white spaces
+    inline void skipWhiteSpaces() {
+        while ( _p != _end && std::isspace( static_cast< unsigned char >( *_p ) ) ) {
+            ++_p;
+        }
+    }
+};
+
+}//tools
+}//SFCGAL
+
+#endif
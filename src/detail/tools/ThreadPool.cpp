@@ -0,0 +1,220 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/tools/ThreadPool.h>
+
+#include <algorithm>
+
+namespace SFCGAL {
+namespace tools {
+
+///
+///
+///
+ThreadPool::ThreadPool( size_t numThreads ):
+    _task( 0 ),
+    _generation( 0 ),
+    _pending( 0 ),
+    _stop( false )
+{
+    if ( numThreads == 0 ) {
+        numThreads = std::max( 1U, std::thread::hardware_concurrency() );
+    }
+
+    for ( size_t i = 0; i < numThreads; ++i ) {
+        _ranges.push_back( std::unique_ptr< Range >( new Range() ) );
+    }
+
+    // the calling thread is the thread 0
+    for ( size_t i = 1; i < numThreads; ++i ) {
+        _threads.push_back( std::thread( &ThreadPool::_worker, this, i ) );
+    }
+}
+
+///
+///
+///
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stop = true;
+    }
+    _wake.notify_all();
+
+    for ( size_t i = 0; i < _threads.size(); ++i ) {
+        _threads[i].join();
+    }
+}
+
+///
+///
+///
+void ThreadPool::parallelFor( size_t n, const std::function< void( size_t ) >& task )
+{
+    if ( _threads.empty() || n < 2 ) {
+        for ( size_t i = 0; i < n; ++i ) {
+            task( i );
+        }
+
+        return;
+    }
+
+    const size_t numThreads = size();
+
+    for ( size_t i = 0; i < numThreads; ++i ) {
+        std::lock_guard< std::mutex > lock( _ranges[i]->mutex );
+        _ranges[i]->begin = n * i / numThreads;
+        _ranges[i]->end   = n * ( i + 1 ) / numThreads;
+    }
+
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _task = &task;
+        _exception = std::exception_ptr();
+        _pending = _threads.size();
+        ++_generation;
+    }
+    _wake.notify_all();
+
+    _run( 0 );
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock< std::mutex > lock( _mutex );
+        _done.wait( lock, [this] { return _pending == 0; } );
+        _task = 0;
+        std::swap( exception, _exception );
+    }
+
+    if ( exception ) {
+        std::rethrow_exception( exception );
+    }
+}
+
+///
+///
+///
+void ThreadPool::_worker( size_t id )
+{
+    size_t generation = 0;
+
+    for ( ;; ) {
+        {
+            std::unique_lock< std::mutex > lock( _mutex );
+            _wake.wait( lock, [&] { return _stop || _generation != generation; } );
+
+            if ( _stop ) {
+                return;
+            }
+
+            generation = _generation;
+        }
+
+        _run( id );
+
+        std::lock_guard< std::mutex > lock( _mutex );
+
+        if ( --_pending == 0 ) {
+            _done.notify_one();
+        }
+    }
+}
+
+///
+///
+///
+void ThreadPool::_run( size_t id )
+{
+    size_t index;
+
+    for ( ;; ) {
+        if ( ! _pop( id, index ) ) {
+            if ( _steal( id ) ) {
+                continue;
+            }
+
+            return;
+        }
+
+        try {
+            ( *_task )( index );
+        }
+        catch ( ... ) {
+            std::lock_guard< std::mutex > lock( _mutex );
+
+            if ( ! _exception ) {
+                _exception = std::current_exception();
+            }
+        }
+    }
+}
+
+///
+///
+///
+bool ThreadPool::_pop( size_t id, size_t& index )
+{
+    Range& range = *_ranges[id];
+    std::lock_guard< std::mutex > lock( range.mutex );
+
+    if ( range.begin == range.end ) {
+        return false;
+    }
+
+    index = range.begin++;
+    return true;
+}
+
+///
+///
+///
+bool ThreadPool::_steal( size_t id )
+{
+    const size_t numThreads = size();
+
+    for ( size_t k = 1; k < numThreads; ++k ) {
+        Range& victim = *_ranges[ ( id + k ) % numThreads ];
+        size_t begin, end;
+
+        {
+            std::lock_guard< std::mutex > lock( victim.mutex );
+
+            if ( victim.begin == victim.end ) {
+                continue;
+            }
+
+            // upper half, rounded up so that a single index can be stolen
+            begin = victim.begin + ( victim.end - victim.begin ) / 2;
+            end = victim.end;
+            victim.end = begin;
+        }
+
+        Range& range = *_ranges[id];
+        std::lock_guard< std::mutex > lock( range.mutex );
+        range.begin = begin;
+        range.end = end;
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace tools
+} // namespace SFCGAL
@@ -0,0 +1,103 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_THREAD_POOL_H_
+#define _SFCGAL_THREAD_POOL_H_
+
+#include <SFCGAL/config.h>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SFCGAL {
+namespace tools {
+
+/**
+ * Fixed size pool of threads running parallel loops with work stealing.
+ *
+ * parallelFor( n, task ) splits [0,n) in one range per thread. Each thread takes
+ * the indices of its own range one by one and, once it is empty, steals the upper
+ * half of the range of another thread, so that unbalanced tasks (geometries of
+ * very different sizes) keep every thread busy.
+ *
+ * The calling thread takes part in the loop, a pool of size n starts n-1 threads.
+ * parallelFor must not be called concurrently on the same pool, nor from a task.
+ */
+class SFCGAL_API ThreadPool {
+public:
+    /**
+     * @param numThreads number of threads, including the calling one
+     * (0 for std::thread::hardware_concurrency())
+     */
+    explicit ThreadPool( size_t numThreads = 0 );
+    ~ThreadPool();
+
+    /**
+     * number of threads running a loop, including the calling one
+     */
+    inline size_t size() const {
+        return _ranges.size();
+    }
+
+    /**
+     * call task( i ) for i in [0,n) and wait for completion.
+     * The first exception thrown by a task is rethrown once every task is done.
+     */
+    void parallelFor( size_t n, const std::function< void( size_t ) >& task );
+
+private:
+    // range of indices owned by a thread
+    struct Range {
+        std::mutex mutex;
+        size_t begin;
+        size_t end;
+        Range() : begin( 0 ), end( 0 ) {}
+    };
+
+    ThreadPool( const ThreadPool& );
+    ThreadPool& operator = ( const ThreadPool& );
+
+    void _worker( size_t id );
+    void _run( size_t id );
+    bool _pop( size_t id, size_t& index );
+    bool _steal( size_t id );
+
+    std::vector< std::unique_ptr< Range > > _ranges;
+    std::vector< std::thread >              _threads;
+
+    std::mutex                                        _mutex;
+    std::condition_variable                           _wake;
+    std::condition_variable                           _done;
+    const std::function< void( size_t ) >*            _task;
+    std::exception_ptr                                _exception;
+    size_t                                            _generation;
+    size_t                                            _pending;
+    bool                                              _stop;
+};
+
+} // namespace tools
+} // namespace SFCGAL
+
+#endif
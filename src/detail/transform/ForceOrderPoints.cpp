@@ -100,7 +100,8 @@ void ForceOrderPoints::visit( Polygon& p )
             }
         }
 
-        Transform::visit( p );
+        // points are left unchanged, visiting them would turn compact rings
+        // back to Point storage
     }
 
 }
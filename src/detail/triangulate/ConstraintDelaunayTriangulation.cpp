@@ -26,6 +26,10 @@
 
 #include <SFCGAL/detail/triangulate/markDomains.h>
 
+#include <CGAL/property_map.h>
+#include <CGAL/spatial_sort.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+
 namespace SFCGAL {
 namespace triangulate {
 
@@ -69,6 +73,69 @@ void  ConstraintDelaunayTriangulation::addConstraint( Vertex_handle source, Vert
     _cdt.insert_constraint( source, target );
 }
 
+///
+///
+///
+std::vector< ConstraintDelaunayTriangulation::Vertex_handle > ConstraintDelaunayTriangulation::addVertices( const std::vector< Coordinate >& positions )
+{
+    std::vector< CDT::Point > points ;
+    points.reserve( positions.size() );
+
+    for ( size_t i = 0; i < positions.size(); i++ ) {
+        if ( positions[i].isEmpty() ) {
+            BOOST_THROW_EXCEPTION( Exception(
+                                       "try to add empty position to ConstraintDelaunayTriangulation"
+                                   ) );
+        }
+
+        points.push_back( _projectionPlane
+                          ? _projectionPlane->to_2d( positions[i].toPoint_3() )
+                          : positions[i].toPoint_2() );
+    }
+
+    std::vector< Vertex_handle > vertices( points.size() );
+
+    if ( points.empty() ) {
+        return vertices ;
+    }
+
+    // insertion order along a Hilbert curve (indices in points)
+    typedef CGAL::Spatial_sort_traits_adapter_2< Kernel, CGAL::Pointer_property_map< CDT::Point >::const_type > Sort_traits ;
+    std::vector< size_t > order( points.size() );
+
+    for ( size_t i = 0; i < order.size(); i++ ) {
+        order[i] = i ;
+    }
+
+    CGAL::spatial_sort( order.begin(), order.end(), Sort_traits( CGAL::make_property_map( points ) ) );
+
+    Face_handle hint ;
+
+    for ( size_t k = 0; k < order.size(); k++ ) {
+        Vertex_handle vertex = _cdt.insert( points[ order[k] ], hint );
+        vertices[ order[k] ] = vertex ;
+        hint = vertex->face();
+    }
+
+    // original coordinates in the input order, so that the last one is kept for duplicated points
+    for ( size_t i = 0; i < positions.size(); i++ ) {
+        vertices[i]->info().original = positions[i] ;
+    }
+
+    return vertices ;
+}
+
+///
+///
+///
+void ConstraintDelaunayTriangulation::addConstraints( const std::vector< Vertex_handle >& vertices, const std::vector< std::pair< size_t, size_t > >& constraints )
+{
+    for ( size_t i = 0; i < constraints.size(); i++ ) {
+        BOOST_ASSERT( constraints[i].first < vertices.size() && constraints[i].second < vertices.size() );
+        addConstraint( vertices[ constraints[i].first ], vertices[ constraints[i].second ] );
+    }
+}
+
 ///
 ///
 ///
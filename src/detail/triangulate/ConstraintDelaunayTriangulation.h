@@ -21,6 +21,9 @@
 #ifndef _SFCGAL_TRIANGULATE_CONSTRAINTDELAUNAYTRIANGULATION_H_
 #define _SFCGAL_TRIANGULATE_CONSTRAINTDELAUNAYTRIANGULATION_H_
 
+#include <utility>
+#include <vector>
+
 #include <boost/optional.hpp>
 
 #include <SFCGAL/config.h>
@@ -94,6 +97,20 @@ public:
      */
     void  addConstraint( Vertex_handle source, Vertex_handle target ) ;
 
+    /**
+     * @brief add vertices to the triangulation, in the order of a Hilbert curve so that
+     * each point is located from the previous one
+     * @return the vertices of the positions, the last coordinate being kept for duplicated
+     * positions as with successive calls to addVertex
+     * @warning the triangles may differ from the ones of successive calls to addVertex when
+     * four or more points are cocircular, the Delaunay triangulation is then not unique
+     */
+    std::vector< Vertex_handle > addVertices( const std::vector< Coordinate >& positions ) ;
+    /**
+     * @brief add constraints between vertices given by their index in vertices
+     */
+    void  addConstraints( const std::vector< Vertex_handle >& vertices, const std::vector< std::pair< size_t, size_t > >& constraints ) ;
+
 
     /**
      * @brief clear the triangulation
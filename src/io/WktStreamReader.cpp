@@ -0,0 +1,305 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/io/WktStreamReader.h>
+
+#include <algorithm>
+#include <cctype>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/detail/io/WktReader.h>
+#include <SFCGAL/detail/tools/CharArrayReader.h>
+#include <SFCGAL/detail/tools/ThreadPool.h>
+
+namespace SFCGAL {
+namespace io {
+
+namespace {
+
+///
+/// true if text ends with the EMPTY keyword (a geometry without parenthesis)
+///
+bool endsWithEmpty( const std::string& text )
+{
+    static const char keyword[] = "EMPTY";
+    const size_t n = sizeof( keyword ) - 1;
+
+    if ( text.size() < n ) {
+        return false;
+    }
+
+    if ( text.size() > n && std::isalnum( static_cast< unsigned char >( text[ text.size() - n - 1 ] ) ) ) {
+        return false;
+    }
+
+    for ( size_t i = 0; i < n; i++ ) {
+        if ( std::toupper( static_cast< unsigned char >( text[ text.size() - n + i ] ) ) != keyword[i] ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// true if text is "[SRID=n;]GEOMETRYCOLLECTION[ Z][ M]"
+///
+bool isCollectionHeader( const std::string& text, srid_t& srid )
+{
+    tools::CharArrayReader reader( text.data(), text.data() + text.size() );
+    boost::uint32_t value = 0;
+
+    if ( reader.imatch( "SRID=" ) && ( ! reader.read( value ) || ! reader.match( ';' ) ) ) {
+        return false;
+    }
+
+    if ( ! reader.imatch( "GEOMETRYCOLLECTION" ) ) {
+        return false;
+    }
+
+    reader.imatch( 'Z' );
+    reader.imatch( 'M' );
+
+    if ( ! reader.eof() ) {
+        return false;
+    }
+
+    srid = value;
+    return true;
+}
+
+} // namespace
+
+///
+///
+///
+WktStreamReader::WktStreamReader( std::istream& s, bool expandCollections, size_t numThreads, size_t batchSize ):
+    _stream( s ),
+    _expandCollections( expandCollections ),
+    _batchSize( numThreads == 1 ? 1 : std::max( batchSize, size_t( 1 ) ) ),
+    _inCollection( false ),
+    _collectionSrid( 0 ),
+    _srid( 0 )
+{
+    if ( numThreads != 1 ) {
+        _pool.reset( new tools::ThreadPool( numThreads ) );
+    }
+}
+
+///
+///
+///
+WktStreamReader::~WktStreamReader()
+{
+
+}
+
+///
+///
+///
+std::unique_ptr< Geometry > WktStreamReader::next()
+{
+    // a batch may give no geometry (GEOMETRYCOLLECTION EMPTY)
+    while ( _items.empty() && readBatch() ) {
+    }
+
+    if ( _items.empty() ) {
+        _srid = 0;
+        return std::unique_ptr< Geometry >();
+    }
+
+    Item item( std::move( _items.front() ) );
+    _items.pop_front();
+
+    if ( item.error ) {
+        std::rethrow_exception( item.error );
+    }
+
+    _srid = item.srid;
+    return std::move( item.geometry );
+}
+
+///
+///
+///
+bool WktStreamReader::readRecord( Record& record )
+{
+    std::streambuf* sb = _stream.rdbuf();
+    record.text.clear();
+    record.member = _inCollection;
+    record.srid   = _inCollection ? _collectionSrid : 0;
+
+    // parenthesis depth, relative to the collection for a member
+    int depth = 0;
+
+    for ( int c = sb->sbumpc(); c != std::char_traits< char >::eof(); c = sb->sbumpc() ) {
+        if ( record.text.empty() && std::isspace( c ) ) {
+            continue;
+        }
+
+        if ( _inCollection && depth == 0 && ( c == ',' || c == ')' ) ) {
+            // end of a member
+            if ( c == ')' ) {
+                _inCollection = false;
+            }
+
+            if ( ! record.text.empty() ) {
+                return true;
+            }
+
+            if ( c == ',' ) {
+                BOOST_THROW_EXCEPTION( WktParseException( "WKT parse error, empty GEOMETRYCOLLECTION member" ) );
+            }
+
+            record.text.clear();
+            record.member = false;
+            record.srid   = 0;
+            continue;
+        }
+
+        if ( c == '(' ) {
+            if ( depth == 0 && ! _inCollection && _expandCollections && isCollectionHeader( record.text, _collectionSrid ) ) {
+                // the members are the next records
+                _inCollection = true;
+                record.text.clear();
+                record.member = true;
+                record.srid   = _collectionSrid;
+                continue;
+            }
+
+            ++depth;
+        }
+        else if ( c == ')' && depth > 0 ) {
+            --depth;
+
+            if ( depth == 0 && ! _inCollection ) {
+                record.text += ')';
+                return true;
+            }
+        }
+        else if ( depth == 0 && ! _inCollection && std::isspace( c ) && endsWithEmpty( record.text ) ) {
+            return true;
+        }
+
+        record.text += static_cast< char >( c );
+    }
+
+    if ( _inCollection ) {
+        _inCollection = false;
+        BOOST_THROW_EXCEPTION( WktParseException( "WKT parse error, unterminated GEOMETRYCOLLECTION" ) );
+    }
+
+    return ! record.text.empty();
+}
+
+///
+///
+///
+void WktStreamReader::parseRecord( const Record& record, std::vector< Item >& items ) const
+{
+    try {
+        detail::io::WktReader reader( record.text.data(), record.text.data() + record.text.size() );
+
+        while ( ! reader.eof() ) {
+            srid_t srid = reader.readSRID();
+
+            if ( srid == 0 ) {
+                srid = record.srid;
+            }
+
+            std::unique_ptr< Geometry > g( reader.readGeometry() );
+
+            if ( _expandCollections && ! record.member && g->geometryTypeId() == TYPE_GEOMETRYCOLLECTION ) {
+                // GEOMETRYCOLLECTION EMPTY or collection following another geometry in the record
+                for ( size_t i = 0; i < g->numGeometries(); i++ ) {
+                    Item item;
+                    item.srid = srid;
+                    item.geometry.reset( g->geometryN( i ).clone() );
+                    items.push_back( std::move( item ) );
+                }
+
+                continue;
+            }
+
+            Item item;
+            item.srid = srid;
+            item.geometry = std::move( g );
+            items.push_back( std::move( item ) );
+        }
+    }
+    catch ( ... ) {
+        Item item;
+        item.srid  = 0;
+        item.error = std::current_exception();
+        items.push_back( std::move( item ) );
+    }
+}
+
+///
+///
+///
+bool WktStreamReader::readBatch()
+{
+    std::vector< Record > records;
+    std::exception_ptr    readError;
+
+    try {
+        Record record;
+
+        while ( records.size() < _batchSize && readRecord( record ) ) {
+            records.push_back( record );
+        }
+    }
+    catch ( ... ) {
+        readError = std::current_exception();
+    }
+
+    std::vector< std::vector< Item > > items( records.size() );
+
+    if ( _pool.get() && records.size() > 1 ) {
+        _pool->parallelFor( records.size(), [&]( size_t i ) {
+            parseRecord( records[i], items[i] );
+        } );
+    }
+    else {
+        for ( size_t i = 0; i < records.size(); i++ ) {
+            parseRecord( records[i], items[i] );
+        }
+    }
+
+    for ( size_t i = 0; i < items.size(); i++ ) {
+        for ( size_t j = 0; j < items[i].size(); j++ ) {
+            _items.push_back( std::move( items[i][j] ) );
+        }
+    }
+
+    if ( readError ) {
+        Item item;
+        item.srid  = 0;
+        item.error = readError;
+        _items.push_back( std::move( item ) );
+    }
+
+    return ! records.empty() || readError;
+}
+
+}//io
+}//SFCGAL
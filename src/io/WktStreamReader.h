@@ -0,0 +1,148 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_IO_WKTSTREAMREADER_H_
+#define _SFCGAL_IO_WKTSTREAMREADER_H_
+
+#include <SFCGAL/config.h>
+
+#include <deque>
+#include <exception>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <SFCGAL/PreparedGeometry.h>
+
+namespace SFCGAL {
+
+class Geometry ;
+
+namespace tools {
+class ThreadPool ;
+}
+
+namespace io {
+
+/**
+ * Pull reader for a stream of WKT/EWKT geometries (one geometry per line, or
+ * geometries separated by white spaces).
+ *
+ * The stream is split in records on geometry boundaries (a closing parenthesis or
+ * EMPTY at the top level), so that only a bounded number of geometries is in memory.
+ * The members of top level GEOMETRYCOLLECTIONs can be returned one by one.
+ *
+ * Records can be parsed by several threads, by batches. Geometries are returned in
+ * the order of the stream whatever the number of threads, and a parse error is thrown
+ * by next() once the geometries preceding it have been returned.
+ *
+ * ex :
+ * @code
+ * WktStreamReader reader( ifs );
+ * while ( std::unique_ptr< Geometry > g = reader.next() ) {
+ *     ...
+ * }
+ * @endcode
+ */
+class SFCGAL_API WktStreamReader {
+public:
+    /**
+     * @param s input stream
+     * @param expandCollections if true, the members of top level GEOMETRYCOLLECTIONs are returned
+     * instead of the collections
+     * @param numThreads number of threads parsing the records (0 for the number of cores)
+     * @param batchSize number of records read before being parsed by the threads
+     */
+    WktStreamReader( std::istream& s, bool expandCollections = false, size_t numThreads = 1, size_t batchSize = 256 );
+    ~WktStreamReader();
+
+    /**
+     * read the next geometry
+     * @return NULL at the end of the stream
+     * @throw WktParseException
+     */
+    std::unique_ptr< Geometry > next() ;
+
+    /**
+     * SRID of the last geometry returned by next() (0 if not specified)
+     */
+    inline srid_t srid() const {
+        return _srid;
+    }
+
+private:
+    /**
+     * text of a geometry or of a member of a GEOMETRYCOLLECTION
+     */
+    struct Record {
+        std::string text;
+        bool        member;
+        srid_t      srid; ///< SRID of the collection of a member
+    };
+
+    /**
+     * a parsed geometry, or the error raised by a record
+     */
+    struct Item {
+        srid_t                      srid;
+        std::unique_ptr< Geometry > geometry;
+        std::exception_ptr          error;
+    };
+
+    WktStreamReader( const WktStreamReader& );
+    WktStreamReader& operator = ( const WktStreamReader& );
+
+    /**
+     * read the next record
+     * @return false at the end of the stream
+     */
+    bool readRecord( Record& record ) ;
+
+    /**
+     * parse a record (errors are stored in items)
+     */
+    void parseRecord( const Record& record, std::vector< Item >& items ) const ;
+
+    /**
+     * read and parse the next batch of records
+     * @return false at the end of the stream
+     */
+    bool readBatch() ;
+
+    std::istream&                         _stream ;
+    bool                                  _expandCollections ;
+    size_t                                _batchSize ;
+    std::unique_ptr< tools::ThreadPool >  _pool ;
+
+    /**
+     * reading the members of a GEOMETRYCOLLECTION ?
+     */
+    bool                                  _inCollection ;
+    srid_t                                _collectionSrid ;
+
+    std::deque< Item >                    _items ;
+    srid_t                                _srid ;
+};
+
+}//io
+}//SFCGAL
+
+#endif
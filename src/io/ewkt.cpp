@@ -22,7 +22,6 @@
 
 #include <SFCGAL/detail/io/WktReader.h>
 #include <SFCGAL/detail/io/WktWriter.h>
-#include <SFCGAL/detail/tools/CharArrayBuffer.h>
 
 using namespace SFCGAL::detail::io;
 
@@ -46,11 +45,7 @@ std::unique_ptr< PreparedGeometry > readEwkt( std::istream& s )
 ///
 std::unique_ptr< PreparedGeometry > readEwkt( const std::string& s )
 {
-    std::istringstream iss( s );
-    WktReader wktReader( iss );
-    srid_t srid = wktReader.readSRID();
-    std::unique_ptr< Geometry > g( wktReader.readGeometry() );
-    return std::unique_ptr<PreparedGeometry>( new PreparedGeometry( std::move(g), srid ) );
+    return readEwkt( s.data(), s.size() );
 }
 
 ///
@@ -58,14 +53,27 @@ std::unique_ptr< PreparedGeometry > readEwkt( const std::string& s )
 ///
 std::unique_ptr< PreparedGeometry > readEwkt( const char* str, size_t len )
 {
-    CharArrayBuffer buf( str, str + len );
-    std::istream istr( &buf );
-    WktReader wktReader( istr );
+    WktReader wktReader( str, str + len );
     srid_t srid = wktReader.readSRID();
     std::unique_ptr< Geometry > g( wktReader.readGeometry() );
     return std::unique_ptr<PreparedGeometry>( new PreparedGeometry( std::move(g), srid ) );
 }
 
+///
+///
+///
+void writeEwkt( const PreparedGeometry& g, std::string& buffer, const int& numDecimals )
+{
+    if ( g.SRID() != 0 ) {
+        buffer += "SRID=";
+        buffer += std::to_string( g.SRID() );
+        buffer += ';';
+    }
+
+    WktWriter writer( buffer, numDecimals );
+    writer.write( g.geometry(), numDecimals == -1 );
+}
+
 }//io
 }//SFCGAL
 
@@ -46,6 +46,12 @@ SFCGAL_API std::unique_ptr< PreparedGeometry > readEwkt( const std::string& s )
  * Read a EWKT geometry from a char*
  */
 SFCGAL_API std::unique_ptr< PreparedGeometry > readEwkt( const char*, size_t );
+/**
+ * Append the extended WKT of a prepared geometry to a string
+ * @param numDecimals number of decimals, -1 for the exact rational representation,
+ * lower than -1 for the shortest decimal representation of the rounded coordinates
+ */
+SFCGAL_API void writeEwkt( const PreparedGeometry& g, std::string& buffer, const int& numDecimals = -1 );
 }
 }
 
@@ -22,7 +22,6 @@
 
 #include <SFCGAL/detail/io/WktReader.h>
 #include <SFCGAL/detail/io/WktWriter.h>
-#include <SFCGAL/detail/tools/CharArrayBuffer.h>
 #include <SFCGAL/Exception.h>
 
 using namespace SFCGAL::detail::io;
@@ -44,16 +43,7 @@ std::unique_ptr< Geometry > readWkt( std::istream& s )
 ///
 std::unique_ptr< Geometry > readWkt( const std::string& s )
 {
-    std::istringstream iss( s );
-    WktReader wktReader( iss );
-    std::unique_ptr< Geometry > geom( wktReader.readGeometry() );
-
-    char extra;
-    if ( iss >> extra ) {
-        std::string remaining( s.substr( int(iss.tellg()) - 1 ) );
-        throw WktParseException( "Extra characters in WKT: " + remaining );
-    }
-    return geom;
+    return readWkt( s.data(), s.size() );
 }
 
 ///
@@ -61,18 +51,25 @@ std::unique_ptr< Geometry > readWkt( const std::string& s )
 ///
 std::unique_ptr< Geometry > readWkt( const char* str, size_t len )
 {
-    CharArrayBuffer buf( str, str + len );
-    std::istream istr( &buf );
-    WktReader wktReader( istr );
+    WktReader wktReader( str, str + len );
     std::unique_ptr< Geometry > geom( wktReader.readGeometry() );
-    char extra;
-    if ( istr >> extra ) {
-        std::string remaining( str + int(istr.tellg()) - 1, str + len );
-        throw WktParseException( "Extra characters in WKT: " + remaining );
+
+    if ( ! wktReader.eof() ) {
+        throw WktParseException( "Extra characters in WKT: " + wktReader.remaining() );
     }
+
     return geom;
 }
 
+///
+///
+///
+void writeWkt( const Geometry& g, std::string& buffer, const int& numDecimals )
+{
+    WktWriter writer( buffer, numDecimals );
+    writer.write( g, numDecimals == -1 );
+}
+
 }//io
 }//SFCGAL
 
@@ -45,6 +45,12 @@ SFCGAL_API std::unique_ptr< Geometry > readWkt( const std::string& s ) ;
  * Read a WKT geometry from a char*
  */
 SFCGAL_API std::unique_ptr< Geometry > readWkt( const char*, size_t );
+/**
+ * Append the WKT of a geometry to a string
+ * @param numDecimals number of decimals, -1 for the exact rational representation,
+ * lower than -1 for the shortest decimal representation of the rounded coordinates
+ */
+SFCGAL_API void writeWkt( const Geometry& g, std::string& buffer, const int& numDecimals = -1 );
 }
 }
 
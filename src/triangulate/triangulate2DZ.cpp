@@ -33,101 +33,102 @@ namespace triangulate {
 
 typedef ConstraintDelaunayTriangulation::Vertex_handle Vertex_handle ;
 
+namespace {
+
+/**
+ * vertices and constraints of a geometry, added at once to the triangulation
+ */
+struct Batch {
+    std::vector< Coordinate >                   positions ;
+    std::vector< std::pair< size_t, size_t > >  constraints ;
+
+    /**
+     * add a polyline, the constraints link consecutive points
+     */
+    template < typename PointAccessor >
+    void addPolyline( size_t numPoints, PointAccessor pointN ) {
+        const size_t first = positions.size();
+
+        for ( size_t i = 0; i < numPoints; i++ ) {
+            positions.push_back( pointN( i ).coordinate() );
+
+            if ( i != 0 ) {
+                constraints.push_back( std::make_pair( first + i - 1, first + i ) );
+            }
+        }
+    }
+};
+
+void collect2DZ( const Geometry& g, Batch& batch );
+
 ///
 ///
 ///
-void triangulate2DZ( const Point& g, ConstraintDelaunayTriangulation& triangulation )
+void collect2DZ( const Point& g, Batch& batch )
 {
-    triangulation.addVertex( g.coordinate() );
+    batch.positions.push_back( g.coordinate() );
 }
 ///
 ///
 ///
-void triangulate2DZ( const LineString& g, ConstraintDelaunayTriangulation& triangulation )
+void collect2DZ( const LineString& g, Batch& batch )
 {
-    Vertex_handle last ;
-
-    for ( size_t i = 0; i < g.numPoints(); i++ ) {
-        Vertex_handle vertex = triangulation.addVertex( g.pointN( i ).coordinate() );
-
-        if ( i != 0 ) {
-            triangulation.addConstraint( last, vertex ) ;
-        }
-
-        last = vertex ;
-    }
+    batch.addPolyline( g.numPoints(), [&]( size_t i ) -> const Point& {
+        return g.pointN( i );
+    } );
 }
 ///
 ///
 ///
-void triangulate2DZ( const Polygon& g, ConstraintDelaunayTriangulation& triangulation )
+void collect2DZ( const Polygon& g, Batch& batch )
 {
     for ( size_t i = 0; i < g.numRings(); i++ ) {
-        triangulate2DZ( g.ringN( i ), triangulation ) ;
+        collect2DZ( g.ringN( i ), batch ) ;
     }
 }
 ///
 ///
 ///
-void triangulate2DZ( const Triangle& g, ConstraintDelaunayTriangulation& triangulation )
+void collect2DZ( const Triangle& g, Batch& batch )
 {
-    Vertex_handle last ;
-
-    for ( size_t i = 0; i < 4; i++ ) {
-        Vertex_handle vertex = triangulation.addVertex( g.vertex( i ).coordinate() );
-
-        if ( i != 0 ) {
-            triangulation.addConstraint( last, vertex ) ;
-        }
-
-        last = vertex ;
-    }
+    batch.addPolyline( 4, [&]( size_t i ) -> const Point& {
+        return g.vertex( i );
+    } );
 }
 ///
 ///
 ///
-void triangulateCollection2DZ( const Geometry& g, ConstraintDelaunayTriangulation& triangulation )
+void collectCollection2DZ( const Geometry& g, Batch& batch )
 {
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
-        triangulate2DZ( g.geometryN( i ), triangulation ) ;
+        collect2DZ( g.geometryN( i ), batch ) ;
     }
 }
 
-
-
 ///
 ///
 ///
-void triangulate2DZ( const Geometry& g, ConstraintDelaunayTriangulation& triangulation )
+void collect2DZ( const Geometry& g, Batch& batch )
 {
-
     if ( g.isEmpty() ) {
         return;
     }
 
-    if ( triangulation.hasProjectionPlane() ) {
-        SFCGAL_ASSERT_GEOMETRY_VALIDITY_ON_PLANE( g );
-    }
-    else {
-        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
-    }
-
-
     switch ( g.geometryTypeId() ) {
     case TYPE_POINT:
-        triangulate2DZ( g.as< Point >(), triangulation );
+        collect2DZ( g.as< Point >(), batch );
         return ;
 
     case TYPE_LINESTRING:
-        triangulate2DZ( g.as< LineString >(), triangulation );
+        collect2DZ( g.as< LineString >(), batch );
         return ;
 
     case TYPE_POLYGON:
-        triangulate2DZ( g.as< Polygon >(), triangulation );
+        collect2DZ( g.as< Polygon >(), batch );
         return ;
 
     case TYPE_TRIANGLE:
-        triangulate2DZ( g.as< Triangle >(), triangulation );
+        collect2DZ( g.as< Triangle >(), batch );
         return ;
 
     case TYPE_MULTIPOINT:
@@ -136,7 +137,7 @@ void triangulate2DZ( const Geometry& g, ConstraintDelaunayTriangulation& triangu
     case TYPE_POLYHEDRALSURFACE:
     case TYPE_TRIANGULATEDSURFACE:
     case TYPE_GEOMETRYCOLLECTION:
-        triangulateCollection2DZ( g, triangulation );
+        collectCollection2DZ( g, batch );
         return ;
 
     case TYPE_SOLID:
@@ -151,6 +152,33 @@ void triangulate2DZ( const Geometry& g, ConstraintDelaunayTriangulation& triangu
     }
 }
 
+} // namespace
+
+///
+///
+///
+void triangulate2DZ( const Geometry& g, ConstraintDelaunayTriangulation& triangulation )
+{
+
+    if ( g.isEmpty() ) {
+        return;
+    }
+
+    if ( triangulation.hasProjectionPlane() ) {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_ON_PLANE( g );
+    }
+    else {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+    }
+
+    // vertices are inserted at once, then constraints
+    Batch batch ;
+    collect2DZ( g, batch );
+
+    std::vector< Vertex_handle > vertices = triangulation.addVertices( batch.positions );
+    triangulation.addConstraints( vertices, batch.constraints );
+}
+
 
 ///
 ///
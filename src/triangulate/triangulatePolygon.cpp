@@ -31,6 +31,14 @@
 #include <SFCGAL/algorithm/normal.h>
 #include <SFCGAL/algorithm/isValid.h>
 
+#include <SFCGAL/detail/tools/ThreadPool.h>
+#include <SFCGAL/detail/detachedCopy.h>
+
+#include <CGAL/Polygon_2_algorithms.h>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
 #include <iostream>
 
 
@@ -39,12 +47,272 @@ namespace triangulate {
 
 typedef ConstraintDelaunayTriangulation::Vertex_handle Vertex_handle ;
 
+namespace {
+
+///
+/// append the faces (Triangle, Polygon or TriangulatedSurface) of g, in the order
+/// of the sequential triangulation
+///
+void collectFaces( const Geometry& g, std::vector< const Geometry* >& faces )
+{
+    if ( g.isEmpty() ) {
+        return;
+    }
+
+    switch ( g.geometryTypeId() ) {
+    case TYPE_TRIANGLE:
+    case TYPE_POLYGON:
+    case TYPE_TRIANGULATEDSURFACE:
+        faces.push_back( &g );
+        return ;
+
+    case TYPE_POLYHEDRALSURFACE: {
+        const PolyhedralSurface& surface = g.as< PolyhedralSurface >();
+
+        for ( size_t i = 0; i < surface.numPolygons(); i++ ) {
+            faces.push_back( &surface.polygonN( i ) );
+        }
+
+        return ;
+    }
+
+    case TYPE_SOLID: {
+        const Solid& solid = g.as< Solid >();
+
+        for ( size_t i = 0; i < solid.numShells(); i++ ) {
+            collectFaces( solid.shellN( i ), faces );
+        }
+
+        return ;
+    }
+
+    case TYPE_MULTIPOLYGON:
+    case TYPE_MULTISOLID:
+    case TYPE_GEOMETRYCOLLECTION: {
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            collectFaces( g.geometryN( i ), faces ) ;
+        }
+
+        return ;
+    }
+
+    default:
+        BOOST_THROW_EXCEPTION(
+            InappropriateGeometryException(
+                ( boost::format( "can't triangulate 3d polygons for type '%1%'" ) % g.geometryType() ).str()
+            )
+        );
+    }
+}
+
+///
+/// triangulate a face returned by collectFaces
+///
+void triangulateFace( const Geometry& face, TriangulatedSurface& triangulatedSurface, TriangulationQuality quality )
+{
+    switch ( face.geometryTypeId() ) {
+    case TYPE_TRIANGLE:
+        return triangulatePolygon3D( face.as< Triangle >(), triangulatedSurface );
+
+    case TYPE_POLYGON:
+        return triangulatePolygon3D( face.as< Polygon >(), triangulatedSurface, quality );
+
+    default:
+        return triangulatePolygon3D( face.as< TriangulatedSurface >(), triangulatedSurface );
+    }
+}
+
+///
+/// maximum number of vertices of a non convex ring triangulated by ear clipping
+///
+const size_t EAR_CLIPPING_MAX_VERTICES = 32 ;
+
+///
+/// true if the k-th remaining vertex is an ear : a convex vertex such that the triangle
+/// it forms with its neighbours contains no other remaining vertex (even on its boundary)
+///
+bool isEar(
+    const std::vector< Kernel::Point_2 >& points,
+    const std::vector< size_t >& remaining,
+    const size_t& k,
+    const CGAL::Orientation& orientation
+)
+{
+    const size_t m = remaining.size() ;
+    const size_t a = remaining[ ( k + m - 1 ) % m ] ;
+    const size_t b = remaining[ k ] ;
+    const size_t c = remaining[ ( k + 1 ) % m ] ;
+
+    if ( CGAL::orientation( points[a], points[b], points[c] ) != orientation ) {
+        return false ;
+    }
+
+    const CGAL::Orientation outside = ( orientation == CGAL::LEFT_TURN ) ? CGAL::RIGHT_TURN : CGAL::LEFT_TURN ;
+
+    for ( size_t i = 0; i < m; i++ ) {
+        const size_t j = remaining[i] ;
+
+        if ( j == a || j == b || j == c ) {
+            continue ;
+        }
+
+        if ( CGAL::orientation( points[a], points[b], points[j] ) != outside
+                && CGAL::orientation( points[b], points[c], points[j] ) != outside
+                && CGAL::orientation( points[c], points[a], points[j] ) != outside ) {
+            return false ;
+        }
+    }
+
+    return true ;
+}
+
+///
+/// Triangulate a polygon without holes by a fan if its exterior ring is convex, by
+/// ear clipping if it is small. Triangles have the orientation of the ring.
+///
+/// @return false (and nothing is added) if the polygon has to be triangulated by
+/// a constrained Delaunay triangulation
+///
+bool triangulateSimplePolygon( const Polygon& polygon, TriangulatedSurface& triangulatedSurface )
+{
+    const LineString& ring = polygon.exteriorRing() ;
+
+    if ( polygon.hasInteriorRings() || ring.numPoints() < 4 ) {
+        return false ;
+    }
+
+    const size_t n = ring.numPoints() - 1 ;
+
+    /*
+     * project the ring on the plane orthogonal to the dominant axis of its normal
+     */
+    const Kernel::Vector_3 normal = algorithm::normal3D< Kernel >( polygon, false );
+    const double nx = std::abs( CGAL::to_double( normal.x() ) ) ;
+    const double ny = std::abs( CGAL::to_double( normal.y() ) ) ;
+    const double nz = std::abs( CGAL::to_double( normal.z() ) ) ;
+
+    std::vector< Kernel::Point_2 > points ;
+    points.reserve( n );
+
+    for ( size_t i = 0; i < n; i++ ) {
+        const Point& p = ring.pointN( i ) ;
+
+        if ( nz >= nx && nz >= ny ) {
+            points.push_back( Kernel::Point_2( p.x(), p.y() ) );
+        }
+        else if ( nx >= ny ) {
+            points.push_back( Kernel::Point_2( p.y(), p.z() ) );
+        }
+        else {
+            points.push_back( Kernel::Point_2( p.z(), p.x() ) );
+        }
+    }
+
+    const CGAL::Orientation orientation = CGAL::orientation_2( points.begin(), points.end(), Kernel() );
+
+    if ( orientation == CGAL::COLLINEAR ) {
+        return false ;
+    }
+
+    /*
+     * convex if every vertex turns the same way and the xy order changes only twice
+     * along the ring, flat vertices and double points are left to the triangulation
+     */
+    bool convex = true ;
+    size_t orderChanges = 0 ;
+
+    for ( size_t i = 0; i < n; i++ ) {
+        const Kernel::Point_2& a = points[ ( i + n - 1 ) % n ] ;
+        const Kernel::Point_2& b = points[ i ] ;
+        const Kernel::Point_2& c = points[ ( i + 1 ) % n ] ;
+
+        const CGAL::Orientation turn = CGAL::orientation( a, b, c ) ;
+
+        if ( turn == CGAL::COLLINEAR ) {
+            return false ;
+        }
+
+        if ( turn != orientation ) {
+            convex = false ;
+        }
+
+        if ( CGAL::compare_xy( a, b ) != CGAL::compare_xy( b, c ) ) {
+            orderChanges++ ;
+        }
+    }
+
+    // indices of the triangles vertices
+    std::vector< size_t > triangles ;
+    triangles.reserve( 3 * ( n - 2 ) );
+
+    if ( convex && orderChanges == 2 ) {
+        for ( size_t i = 1; i + 1 < n; i++ ) {
+            triangles.push_back( 0 );
+            triangles.push_back( i );
+            triangles.push_back( i + 1 );
+        }
+    }
+    else {
+        if ( convex || n > EAR_CLIPPING_MAX_VERTICES ) {
+            return false ;
+        }
+
+        std::vector< size_t > remaining( n );
+
+        for ( size_t i = 0; i < n; i++ ) {
+            remaining[i] = i ;
+        }
+
+        while ( remaining.size() > 3 ) {
+            const size_t m = remaining.size() ;
+            size_t k = 0 ;
+
+            while ( k < m && ! isEar( points, remaining, k, orientation ) ) {
+                k++ ;
+            }
+
+            if ( k == m ) {
+                return false ;
+            }
+
+            triangles.push_back( remaining[ ( k + m - 1 ) % m ] );
+            triangles.push_back( remaining[ k ] );
+            triangles.push_back( remaining[ ( k + 1 ) % m ] );
+            remaining.erase( remaining.begin() + k );
+        }
+
+        if ( CGAL::orientation( points[ remaining[0] ], points[ remaining[1] ], points[ remaining[2] ] ) != orientation ) {
+            return false ;
+        }
+
+        triangles.insert( triangles.end(), remaining.begin(), remaining.end() );
+    }
+
+    /*
+     * same vertices as the constrained Delaunay triangulation (coordinates without m)
+     */
+    triangulatedSurface.reserve( triangulatedSurface.numTriangles() + triangles.size() / 3 );
+
+    for ( size_t i = 0; i < triangles.size(); i += 3 ) {
+        triangulatedSurface.addTriangle( new Triangle(
+                                             Point( ring.pointN( triangles[i] ).coordinate() ),
+                                             Point( ring.pointN( triangles[i + 1] ).coordinate() ),
+                                             Point( ring.pointN( triangles[i + 2] ).coordinate() )
+                                         ) );
+    }
+
+    return true ;
+}
+
+} // namespace
+
 ///
 ///
 ///
 void triangulatePolygon3D(
     const Geometry& g,
-    TriangulatedSurface& triangulatedSurface
+    TriangulatedSurface& triangulatedSurface,
+    TriangulationQuality quality
 )
 {
     if ( g.isEmpty() ) {
@@ -58,22 +326,22 @@ void triangulatePolygon3D(
         return triangulatePolygon3D( g.as< Triangle >(), triangulatedSurface );
 
     case TYPE_POLYGON:
-        return triangulatePolygon3D( g.as< Polygon >(), triangulatedSurface );
+        return triangulatePolygon3D( g.as< Polygon >(), triangulatedSurface, quality );
 
     case TYPE_TRIANGULATEDSURFACE:
         return triangulatePolygon3D( g.as< TriangulatedSurface >(), triangulatedSurface );
 
     case TYPE_POLYHEDRALSURFACE:
-        return triangulatePolygon3D( g.as< PolyhedralSurface >(), triangulatedSurface );
+        return triangulatePolygon3D( g.as< PolyhedralSurface >(), triangulatedSurface, quality );
 
     case TYPE_SOLID:
-        return triangulatePolygon3D( g.as< Solid >(), triangulatedSurface );
+        return triangulatePolygon3D( g.as< Solid >(), triangulatedSurface, quality );
 
     case TYPE_MULTIPOLYGON:
     case TYPE_MULTISOLID:
     case TYPE_GEOMETRYCOLLECTION: {
         for ( size_t i = 0; i < g.numGeometries(); i++ ) {
-            triangulatePolygon3D( g.geometryN( i ), triangulatedSurface ) ;
+            triangulatePolygon3D( g.geometryN( i ), triangulatedSurface, quality ) ;
         }
 
         return ;
@@ -88,6 +356,115 @@ void triangulatePolygon3D(
     }
 }
 
+///
+///
+///
+void triangulatePolygon3D(
+    const Geometry& g,
+    TriangulatedSurface& triangulatedSurface,
+    size_t numThreads,
+    TriangulationQuality quality
+)
+{
+    triangulatePolygon3D( std::vector< const Geometry* >( 1, &g ), std::vector< TriangulatedSurface* >( 1, &triangulatedSurface ), numThreads, quality );
+}
+
+///
+///
+///
+void triangulatePolygon3D(
+    const std::vector< const Geometry* >& geometries,
+    const std::vector< TriangulatedSurface* >& triangulatedSurfaces,
+    size_t numThreads,
+    TriangulationQuality quality
+)
+{
+    BOOST_ASSERT( geometries.size() == triangulatedSurfaces.size() );
+
+    // faces and index of their geometry
+    std::vector< const Geometry* > faces ;
+    std::vector< size_t > targets ;
+
+    for ( size_t i = 0; i < geometries.size(); i++ ) {
+        if ( geometries[i]->isEmpty() ) {
+            continue;
+        }
+
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY( *geometries[i] );
+
+        collectFaces( *geometries[i], faces );
+        targets.resize( faces.size(), i );
+    }
+
+    if ( faces.empty() ) {
+        return ;
+    }
+
+    std::unique_ptr< tools::ThreadPool > pool ;
+
+    if ( numThreads != 1 ) {
+        pool.reset( new tools::ThreadPool( numThreads ) );
+    }
+
+    // faces may share lazy exact numbers (walls and roofs of an extruded geometry),
+    // the threads triangulate copies in which every face has its own numbers
+    std::vector< std::unique_ptr< Geometry > > detachedFaces ;
+
+    if ( pool.get() && pool->size() > 1 ) {
+        detachedFaces.reserve( faces.size() );
+
+        for ( size_t i = 0; i < faces.size(); i++ ) {
+            detachedFaces.push_back( detail::detachedCopy( *faces[i] ) );
+            faces[i] = detachedFaces.back().get();
+        }
+    }
+
+    // a few chunks per thread, so that the work is balanced
+    const size_t numChunks = pool.get() ? std::min( faces.size(), pool->size() * 4 ) : 1 ;
+
+    // triangles of a chunk, one buffer per geometry
+    typedef std::vector< std::pair< size_t, std::unique_ptr< TriangulatedSurface > > > ChunkBuffers ;
+    std::vector< ChunkBuffers > buffers( numChunks );
+    std::vector< std::exception_ptr > errors( numChunks );
+
+    std::function< void( size_t ) > triangulateChunk = [&]( size_t chunk ) {
+        try {
+            const size_t end = ( chunk + 1 ) * faces.size() / numChunks ;
+
+            for ( size_t i = chunk * faces.size() / numChunks; i < end; i++ ) {
+                if ( buffers[chunk].empty() || buffers[chunk].back().first != targets[i] ) {
+                    buffers[chunk].push_back( std::make_pair( targets[i], std::unique_ptr< TriangulatedSurface >( new TriangulatedSurface() ) ) );
+                }
+
+                triangulateFace( *faces[i], *buffers[chunk].back().second, quality );
+            }
+        }
+        catch ( ... ) {
+            errors[chunk] = std::current_exception();
+        }
+    };
+
+    if ( pool.get() ) {
+        pool->parallelFor( numChunks, triangulateChunk );
+    }
+    else {
+        triangulateChunk( 0 );
+    }
+
+    // the error of the first face in input order
+    for ( size_t chunk = 0; chunk < numChunks; chunk++ ) {
+        if ( errors[chunk] ) {
+            std::rethrow_exception( errors[chunk] );
+        }
+    }
+
+    for ( size_t chunk = 0; chunk < numChunks; chunk++ ) {
+        for ( size_t i = 0; i < buffers[chunk].size(); i++ ) {
+            triangulatedSurfaces[ buffers[chunk][i].first ]->transferTriangles( *buffers[chunk][i].second );
+        }
+    }
+}
+
 ///
 ///
 ///
@@ -135,7 +512,8 @@ void triangulatePolygon3D(
 ///
 void triangulatePolygon3D(
     const Polygon& polygon,
-    TriangulatedSurface& triangulatedSurface
+    TriangulatedSurface& triangulatedSurface,
+    TriangulationQuality quality
 )
 {
     /*
@@ -155,6 +533,13 @@ void triangulatePolygon3D(
                                ) );
     }
 
+    /*
+     * fast path for convex or small polygons without holes
+     */
+    if ( quality == TRIANGULATION_FAST && triangulateSimplePolygon( polygon, triangulatedSurface ) ) {
+        return ;
+    }
+
     /*
      * Prepare a Constraint Delaunay Triangulation
      */
@@ -168,8 +553,11 @@ void triangulatePolygon3D(
     cdt.setProjectionPlane( polygonPlane );
 
     /*
-     * insert each ring in the triangulation
+     * insert the vertices of every ring at once, then the constraints of the rings
      */
+    std::vector< Coordinate > positions ;
+    std::vector< std::pair< size_t, size_t > > constraints ;
+
     for ( size_t i = 0; i < polygon.numRings(); i++ ) {
         const LineString& ring  = polygon.ringN( i );
 
@@ -180,18 +568,20 @@ void triangulatePolygon3D(
             continue;
         }
 
-        Vertex_handle v_prev = cdt.addVertex( ring.pointN( 0 ).coordinate() );
-        Vertex_handle v_0 = v_prev;
+        const size_t first = positions.size() ;
+        positions.push_back( ring.pointN( 0 ).coordinate() );
 
         for ( size_t j = 1; j < ring.numPoints()-1; j++ ) {
-            Vertex_handle vh = cdt.addVertex( ring.pointN( j ).coordinate() );
-            cdt.addConstraint( v_prev, vh );
-            v_prev = vh;
+            positions.push_back( ring.pointN( j ).coordinate() );
+            constraints.push_back( std::make_pair( positions.size() - 2, positions.size() - 1 ) );
         }
 
-        cdt.addConstraint( v_prev, v_0 );
+        constraints.push_back( std::make_pair( positions.size() - 1, first ) );
     }
 
+    std::vector< Vertex_handle > vertices = cdt.addVertices( positions );
+    cdt.addConstraints( vertices, constraints );
+
     /*
      * Mark facets that are inside the domain bounded by the polygon
      */
@@ -204,11 +594,12 @@ void triangulatePolygon3D(
 ///
 void triangulatePolygon3D(
     const PolyhedralSurface& g,
-    TriangulatedSurface& triangulatedSurface
+    TriangulatedSurface& triangulatedSurface,
+    TriangulationQuality quality
 )
 {
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
-        triangulatePolygon3D( g.polygonN( i ), triangulatedSurface );
+        triangulatePolygon3D( g.polygonN( i ), triangulatedSurface, quality );
     }
 }
 
@@ -218,11 +609,12 @@ void triangulatePolygon3D(
 ///
 void triangulatePolygon3D(
     const Solid& g,
-    TriangulatedSurface& triangulatedSurface
+    TriangulatedSurface& triangulatedSurface,
+    TriangulationQuality quality
 )
 {
     for ( size_t i = 0; i < g.numShells(); i++ ) {
-        triangulatePolygon3D( g.shellN( i ), triangulatedSurface );
+        triangulatePolygon3D( g.shellN( i ), triangulatedSurface, quality );
     }
 }
 
@@ -23,32 +23,91 @@
 
 #include <SFCGAL/config.h>
 
+#include <vector>
+
 #include <SFCGAL/Geometry.h>
 
 namespace SFCGAL {
 namespace triangulate {
 
+/**
+ * @brief Triangulation strategy for polygons
+ */
+enum TriangulationQuality {
+    /**
+     * constrained Delaunay triangulation of every polygon
+     */
+    TRIANGULATION_DELAUNAY,
+    /**
+     * fan for convex rings and ear clipping for small simple rings without holes,
+     * constrained Delaunay triangulation otherwise
+     */
+    TRIANGULATION_FAST
+};
+
 /**
  * @brief Triangulate 3D polygons in a Geometry.
  *
  * @param g input geometry
  * @param triangulatedSurface resulting TriangulatedSurface
  * @param usePolygonPlanes use polygon plane or Triangulate in OXY plane
+ * @param quality triangulation strategy for polygons
  * @todo unittest
  * @ingroup detail
  */
 SFCGAL_API void triangulatePolygon3D(
     const Geometry& g,
-    TriangulatedSurface& triangulatedSurface
+    TriangulatedSurface& triangulatedSurface,
+    TriangulationQuality quality = TRIANGULATION_DELAUNAY
+);
+/**
+ * @brief Triangulate 3D polygons in a Geometry with several threads. The triangles
+ * are the same, in the same order, as with the sequential version.
+ *
+ * @param numThreads number of threads (0 for the number of cores)
+ * @param quality triangulation strategy for polygons
+ * @ingroup detail
+ */
+SFCGAL_API void triangulatePolygon3D(
+    const Geometry& g,
+    TriangulatedSurface& triangulatedSurface,
+    size_t numThreads,
+    TriangulationQuality quality = TRIANGULATION_DELAUNAY
+);
+/**
+ * @brief Triangulate 3D polygons in several Geometries with several threads.
+ *
+ * Polygons are split in contiguous chunks triangulated concurrently into their own
+ * TriangulatedSurface buffers, which are then moved in input order to the results.
+ * With several threads, the chunks hold copies of the polygons in which no lazy exact
+ * number is shared (see detail::detachedCopy).
+ *
+ * @param geometries input geometries
+ * @param triangulatedSurfaces triangles of geometries[i] are appended to triangulatedSurfaces[i]
+ * @param numThreads number of threads (0 for the number of cores)
+ * @param quality triangulation strategy for polygons
+ * @ingroup detail
+ */
+SFCGAL_API void triangulatePolygon3D(
+    const std::vector< const Geometry* >& geometries,
+    const std::vector< TriangulatedSurface* >& triangulatedSurfaces,
+    size_t numThreads,
+    TriangulationQuality quality = TRIANGULATION_DELAUNAY
 );
 /**
  * @brief Triangulate a 3D Polygon
+ *
+ * With TRIANGULATION_FAST, the triangles of a polygon without holes are computed
+ * without a constrained Delaunay triangulation if its exterior ring is convex or small.
+ * Triangles have the orientation of the polygon in both cases.
+ *
  * @todo unittest
  * @ingroup detail
  */
 SFCGAL_API void triangulatePolygon3D(
     const Polygon& g,
-    TriangulatedSurface& triangulatedSurface
+    TriangulatedSurface& triangulatedSurface,
+    TriangulationQuality quality = TRIANGULATION_DELAUNAY
 );
 /**
  * @brief Triangulate a 3D Triangle (copy triangle)
@@ -86,7 +145,8 @@ SFCGAL_API void opentriangulatePolygon3D(
  */
 SFCGAL_API void triangulatePolygon3D(
     const PolyhedralSurface& polyhedralSurface,
-    TriangulatedSurface& triangulatedSurface
+    TriangulatedSurface& triangulatedSurface,
+    TriangulationQuality quality = TRIANGULATION_DELAUNAY
 );
 /**
  * @brief Triangulate a Solid
@@ -96,7 +156,8 @@ SFCGAL_API void triangulatePolygon3D(
  */
 SFCGAL_API void triangulatePolygon3D(
     const Solid& g,
-    TriangulatedSurface& triangulatedSurface
+    TriangulatedSurface& triangulatedSurface,
+    TriangulationQuality quality = TRIANGULATION_DELAUNAY
 );
 
 }//algorithm
@@ -19,6 +19,68 @@
  */
 #include "Bench.h"
 
+#include <SFCGAL/version.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+
+namespace {
+std::atomic< size_t > allocationCounter( 0 );
+
+// JSON string literal
+std::string quoted( const std::string& str )
+{
+    std::string result( "\"" );
+
+    for ( size_t i = 0; i < str.size(); ++i ) {
+        if ( str[i] == '"' || str[i] == '\\' ) {
+            result += '\\';
+        }
+
+        result += str[i];
+    }
+
+    return result + "\"";
+}
+}
+
+//
+// Count allocations to report them with timings
+void* operator new( size_t size )
+{
+    ++allocationCounter;
+    void* p = std::malloc( size ? size : 1 );
+
+    if ( ! p ) {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+void* operator new[]( size_t size )
+{
+    return operator new( size );
+}
+void operator delete( void* p ) noexcept
+{
+    std::free( p );
+}
+void operator delete[]( void* p ) noexcept
+{
+    std::free( p );
+}
+void operator delete( void* p, size_t ) noexcept
+{
+    std::free( p );
+}
+void operator delete[]( void* p, size_t ) noexcept
+{
+    std::free( p );
+}
 
 namespace SFCGAL {
 
@@ -36,6 +98,7 @@ Bench::~Bench()
 void Bench::start( const std::string& description )
 {
     _timers.push( std::make_pair( description, timer_t() ) );
+    _allocations.push( allocationCount() );
     _timers.top().second.start();
 }
 
@@ -54,8 +117,133 @@ void Bench::stop()
 {
     BOOST_ASSERT( ! _timers.empty() ) ;
     _timers.top().second.stop();
-    s() << _timers.top().first << "\t" << ( _timers.top().second.elapsed().wall * 1.0e-9 ) << std::endl ;
+    s() << _timers.top().first << "\t" << ( _timers.top().second.elapsed().wall * 1.0e-9 )
+        << "\t" << ( allocationCount() - _allocations.top() ) << " allocations" << std::endl ;
     _timers.pop() ;
+    _allocations.pop() ;
+}
+
+///
+///
+///
+void Bench::measure( const std::string& name, const size_t& size, const size_t& iterations, const std::function< void() >& f )
+{
+    BOOST_ASSERT( iterations > 0 );
+    const size_t n = repetitions();
+    std::vector< double > times;
+    const size_t allocations = allocationCount();
+
+    for ( size_t r = 0; r < n; ++r ) {
+        timer_t timer;
+        timer.start();
+
+        for ( size_t i = 0; i < iterations; ++i ) {
+            f();
+        }
+
+        timer.stop();
+        times.push_back( timer.elapsed().wall * 1.0e-9 / iterations );
+    }
+
+    BenchResult result;
+    result.name        = name;
+    result.size        = size;
+    result.repetitions = n;
+    result.iterations  = iterations;
+    result.allocations = double( allocationCount() - allocations ) / ( n * iterations );
+
+    double sum = 0.0;
+
+    for ( size_t r = 0; r < n; ++r ) {
+        sum += times[r];
+    }
+
+    result.meanTime = sum / n;
+    double squares = 0.0;
+
+    for ( size_t r = 0; r < n; ++r ) {
+        squares += ( times[r] - result.meanTime ) * ( times[r] - result.meanTime );
+    }
+
+    result.stddevTime = n > 1 ? std::sqrt( squares / ( n - 1 ) ) : 0.0;
+
+    std::sort( times.begin(), times.end() );
+    result.minTime    = times.front();
+    result.medianTime = n % 2 ? times[n / 2] : ( times[n / 2 - 1] + times[n / 2] ) / 2;
+
+    s() << name << "/" << size << "\t" << result.medianTime << "\t(min " << result.minTime
+        << ", stddev " << result.stddevTime << ")\t" << result.allocations << " allocations" << std::endl ;
+    _results.push_back( result );
+}
+
+///
+///
+///
+void Bench::measure( const std::string& name, const size_t& size, const std::function< void() >& f )
+{
+    measure( name, size, 1, f );
+}
+
+///
+///
+///
+size_t Bench::repetitions() const
+{
+    const char* value = std::getenv( "SFCGAL_BENCH_REPETITIONS" );
+    const int n = value ? std::atoi( value ) : 0;
+    return n > 0 ? size_t( n ) : 5;
+}
+
+///
+///
+///
+size_t Bench::scaled( const size_t& n ) const
+{
+    const char* value = std::getenv( "SFCGAL_BENCH_SCALE" );
+    const double scale = value ? std::atof( value ) : 0.0;
+
+    if ( !( scale > 0.0 ) ) {
+        return n;
+    }
+
+    return std::max( size_t( 1 ), size_t( n * scale ) );
+}
+
+///
+///
+///
+void Bench::writeJson( std::ostream& out ) const
+{
+    char date[32] = "";
+    const std::time_t now = std::time( NULL );
+    std::strftime( date, sizeof( date ), "%Y-%m-%dT%H:%M:%S", std::localtime( &now ) );
+
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": " << quoted( date ) << ",\n"
+        << "    \"library_version\": " << quoted( Version() ) << ",\n"
+        << "    \"repetitions\": " << repetitions() << ",\n"
+        << "    \"time_unit\": \"s\"\n"
+        << "  },\n  \"benchmarks\": [";
+
+    out.precision( 9 );
+
+    for ( size_t i = 0; i < _results.size(); ++i ) {
+        const BenchResult& r = _results[i];
+        out << ( i ? "," : "" ) << "\n    {\n"
+            << "      \"name\": " << quoted( r.name + "/" + std::to_string( r.size ) ) << ",\n"
+            << "      \"family\": " << quoted( r.name ) << ",\n"
+            << "      \"size\": " << r.size << ",\n"
+            << "      \"repetitions\": " << r.repetitions << ",\n"
+            << "      \"iterations\": " << r.iterations << ",\n"
+            << "      \"min_time\": " << r.minTime << ",\n"
+            << "      \"median_time\": " << r.medianTime << ",\n"
+            << "      \"mean_time\": " << r.meanTime << ",\n"
+            << "      \"stddev_time\": " << r.stddevTime << ",\n"
+            << "      \"allocations\": " << r.allocations << "\n"
+            << "    }";
+    }
+
+    out << "\n  ]\n}\n";
 }
 
 ///
@@ -67,6 +255,14 @@ Bench& Bench::instance()
     return bench ;
 }
 
+///
+///
+///
+size_t Bench::allocationCount()
+{
+    return allocationCounter.load();
+}
+
 ///
 ///
 ///
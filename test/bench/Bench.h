@@ -20,8 +20,12 @@
 #ifndef _SFCGAL_BENCH_H_
 #define _SFCGAL_BENCH_H_
 
+#include <cstddef>
+#include <functional>
 #include <iostream>
 #include <stack>
+#include <string>
+#include <vector>
 
 #include <boost/timer/timer.hpp>
 
@@ -29,8 +33,33 @@
 
 namespace SFCGAL {
 
+/**
+ * @brief statistics of a measure (times in seconds, for one iteration)
+ */
+struct BenchResult {
+    std::string name ;
+    size_t      size ;
+    size_t      repetitions ;
+    size_t      iterations ;
+    double      minTime ;
+    double      medianTime ;
+    double      meanTime ;
+    double      stddevTime ;
+    /**
+     * allocations per iteration
+     */
+    double      allocations ;
+};
+
 /**
  * @brief helper class to write formated benchs
+ *
+ * measure() repeats a bench and keeps its statistics, which are written as JSON
+ * at the end of the run if SFCGAL_BENCH_JSON is set (see script/bench-compare.py).
+ * Environment variables :
+ * - SFCGAL_BENCH_JSON : output file
+ * - SFCGAL_BENCH_REPETITIONS : number of repetitions of a measure (default 5)
+ * - SFCGAL_BENCH_SCALE : factor applied to the sizes of the inputs (default 1)
  */
 class Bench {
 public:
@@ -54,11 +83,46 @@ public:
      */
     void stop() ;
 
+    /**
+     * run f iterations times per repetition and record the statistics as "name/size"
+     */
+    void measure( const std::string& name, const size_t& size, const size_t& iterations, const std::function< void() >& f ) ;
+    /**
+     * run f once per repetition and record the statistics as "name/size"
+     */
+    void measure( const std::string& name, const size_t& size, const std::function< void() >& f ) ;
+
+    /**
+     * number of repetitions of a measure
+     */
+    size_t repetitions() const ;
+    /**
+     * input size n multiplied by SFCGAL_BENCH_SCALE (at least 1)
+     */
+    size_t scaled( const size_t& n ) const ;
+
+    /**
+     * results of the measures
+     */
+    inline const std::vector< BenchResult >& results() const {
+        return _results ;
+    }
+
+    /**
+     * write the results as JSON
+     */
+    void writeJson( std::ostream& s ) const ;
+
     /**
      * get bench instance
      */
     static Bench& instance() ;
 
+    /**
+     * Number of calls to operator new since the program started
+     */
+    static size_t allocationCount() ;
+
     /**
      * Get output stream
      */
@@ -81,6 +145,14 @@ private:
      * timer stack with description
      */
     std::stack< std::pair< std::string, timer_t > > _timers ;
+    /**
+     * allocation count when benchs were started
+     */
+    std::stack< size_t > _allocations ;
+    /**
+     * results of measure()
+     */
+    std::vector< BenchResult > _results ;
 };
 
 /**
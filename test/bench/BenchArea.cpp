@@ -35,18 +35,63 @@
 
 #include "../test_config.h"
 #include "Bench.h"
+#include "BenchData.h"
 
 #include <boost/test/unit_test.hpp>
 
 #include <SFCGAL/detail/generator/sierpinski.h>
+#include <SFCGAL/detail/generator/hoch.h>
 
 #include <SFCGAL/algorithm/area.h>
+#include <SFCGAL/algorithm/length.h>
 
 using namespace boost::unit_test ;
 using namespace SFCGAL ;
 
 BOOST_AUTO_TEST_SUITE( SFCGAL_BenchArea )
 
+namespace {
+
+/**
+ * exact evaluation of the area of the polygons of g, to compare with the
+ * double evaluation of algorithm::area
+ */
+double exactArea( const Geometry& g )
+{
+    Kernel::FT result = 0 ;
+
+    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+        const Polygon& polygon = g.geometryN( i ).as< Polygon >() ;
+
+        for ( size_t j = 0; j < polygon.numRings(); j++ ) {
+            const Kernel::FT ringArea = CGAL::abs( algorithm::signedArea( polygon.ringN( j ) ) ) ;
+            result += ( j == 0 ) ? ringArea : - ringArea ;
+        }
+    }
+
+    return CGAL::to_double( result ) ;
+}
+
+/**
+ * length of the rings of the polygons of g
+ */
+double ringsLength( const Geometry& g )
+{
+    double result = 0.0 ;
+
+    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+        const Polygon& polygon = g.geometryN( i ).as< Polygon >() ;
+
+        for ( size_t j = 0; j < polygon.numRings(); j++ ) {
+            result += algorithm::length( polygon.ringN( j ) ) ;
+        }
+    }
+
+    return result ;
+}
+
+} // namespace
+
 
 BOOST_AUTO_TEST_CASE( testAreaSierpinski )
 {
@@ -74,6 +119,55 @@ BOOST_AUTO_TEST_CASE( testAreaSierpinski3D )
     bench().stop() ;
 }
 
+BOOST_AUTO_TEST_CASE( testAreaCountries )
+{
+    std::vector< std::unique_ptr< Geometry > > countries( readBenchWkt( "countries.wkt" ) );
+    const size_t n = countries.size() ;
+
+    bench().measure( "area/countries", n, [&] {
+        for ( size_t i = 0; i < countries.size(); ++i ) {
+            algorithm::area( *countries[i] );
+        }
+    } );
+    bench().measure( "area/countries/exact", n, [&] {
+        for ( size_t i = 0; i < countries.size(); ++i ) {
+            exactArea( *countries[i] );
+        }
+    } );
+    bench().measure( "area3D/countries", n, [&] {
+        for ( size_t i = 0; i < countries.size(); ++i ) {
+            algorithm::area3D( *countries[i] );
+        }
+    } );
+    bench().measure( "length/countries", n, [&] {
+        for ( size_t i = 0; i < countries.size(); ++i ) {
+            ringsLength( *countries[i] );
+        }
+    } );
+}
+
+BOOST_AUTO_TEST_CASE( testAreaFractals )
+{
+    for ( unsigned int order = 3; order <= 6; ++order ) {
+        std::unique_ptr< Polygon > snowflake( generator::hoch( order ) );
+        const size_t n = snowflake->exteriorRing().numPoints() ;
+
+        bench().measure( "area/hoch", n, [&] { algorithm::area( *snowflake ); } );
+        bench().measure( "area/hoch/exact", n, [&] { exactArea( *snowflake ); } );
+        bench().measure( "area3D/hoch", n, [&] { algorithm::area3D( *snowflake ); } );
+        bench().measure( "length/hoch", n, [&] { ringsLength( *snowflake ); } );
+    }
+
+    for ( unsigned int order = 5; order <= 8; ++order ) {
+        std::unique_ptr< MultiPolygon > fractal( generator::sierpinski( order ) ) ;
+        const size_t n = fractal->numGeometries() ;
+
+        bench().measure( "area/sierpinski", n, [&] { algorithm::area( *fractal ); } );
+        bench().measure( "area/sierpinski/exact", n, [&] { exactArea( *fractal ); } );
+        bench().measure( "area3D/sierpinski", n, [&] { algorithm::area3D( *fractal ); } );
+    }
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,85 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/Point.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/algorithm/connection.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/generator/building.h>
+#include <SFCGAL/detail/generator/disc.h>
+
+#include "Bench.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchConnection )
+
+namespace {
+
+// n x n buildings generated from octagonal footprints
+std::unique_ptr< Geometry > city( const size_t& n )
+{
+    MultiPolygon footprints ;
+
+    for ( size_t i = 0; i < n; i++ ) {
+        for ( size_t j = 0; j < n; j++ ) {
+            footprints.addGeometry( generator::disc( Point( 10.0 * i, 10.0 * j ), 4.0, 2 ).release() );
+        }
+    }
+
+    return generator::building( footprints, 10.0, 0.5 );
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( testSurfaceGraphBuildings )
+{
+    const size_t sizes[] = { 4, 16, 32 };
+
+    for ( size_t k = 0; k < sizeof( sizes ) / sizeof( sizes[0] ); k++ ) {
+        std::unique_ptr< Geometry > buildings( city( bench().scaled( sizes[k] ) ) );
+        const MultiSolid& solids = buildings->as< MultiSolid >() ;
+
+        size_t numFaces = 0 ;
+
+        for ( size_t i = 0; i < solids.numGeometries(); i++ ) {
+            numFaces += solids.solidN( i ).exteriorShell().numPolygons() ;
+        }
+
+        bench().measure( "surfaceGraph/building", numFaces, [&] {
+            for ( size_t i = 0; i < solids.numGeometries(); i++ ) {
+                const algorithm::SurfaceGraph graph( solids.solidN( i ).exteriorShell() );
+                algorithm::isConnected( graph );
+                algorithm::isClosed( graph );
+            }
+        } );
+
+        bench().measure( "isValid/building", numFaces, [&] { algorithm::isValid( solids ); } );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
@@ -30,6 +30,12 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/area.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/detail/CoordinateBuffer.h>
+#include <SFCGAL/numeric.h>
+
+#include <cmath>
 
 #include "../test_config.h"
 
@@ -172,6 +178,111 @@ BOOST_AUTO_TEST_CASE( testPtrVectorOfPoint )
 
 #endif
 
+//
+// LineString with one Point object per vertex vs compact LineString
+namespace {
+const int N_RING = 100000 ;
+const double PI = 3.14159265358979323846 ;
+
+//
+// a closed ring with N_RING points
+LineString* createRing( bool compact )
+{
+    LineString* ring = NULL;
+
+    if ( compact ) {
+        detail::CoordinateBuffer coordinates ;
+        coordinates.reserve( N_RING + 1 ) ;
+
+        for ( int i = 0; i < N_RING; i++ ) {
+            const double angle = 2.0 * PI * i / N_RING ;
+            coordinates.push_back( cos( angle ), sin( angle ) ) ;
+        }
+
+        coordinates.push_back( coordinates.x( 0 ), coordinates.y( 0 ) ) ;
+        ring = new LineString( coordinates ) ;
+    }
+    else {
+        ring = new LineString() ;
+        ring->reserve( N_RING + 1 ) ;
+
+        for ( int i = 0; i < N_RING; i++ ) {
+            const double angle = 2.0 * PI * i / N_RING ;
+            ring->addPoint( Point( cos( angle ), sin( angle ) ) ) ;
+        }
+
+        ring->addPoint( ring->startPoint() ) ;
+    }
+
+    return ring ;
+}
+
+void benchRing( bool compact )
+{
+    const std::string storage = compact ? "compact LineString" : "LineString" ;
+
+    bench().start( boost::format( "%s create" ) % storage ) ;
+    std::unique_ptr< LineString > ring( createRing( compact ) ) ;
+    // non const accessors would turn the ring back to Point storage
+    const LineString& constRing = *ring ;
+    bench().stop() ;
+
+    // traversal without Point objects for compact LineStrings
+    bench().start( boost::format( "%s traversal" ) % storage ) ;
+    double x = 0.0, y = 0.0 ;
+
+    if ( const detail::CoordinateBuffer* coordinates = ring->coordinates() ) {
+        for ( size_t i = 0; i < coordinates->size(); i++ ) {
+            x += coordinates->x( i ) ;
+            y += coordinates->y( i ) ;
+        }
+    }
+    else {
+        for ( size_t i = 0; i < ring->numPoints(); i++ ) {
+            x += CGAL::to_double( constRing.pointN( i ).x() ) ;
+            y += CGAL::to_double( constRing.pointN( i ).y() ) ;
+        }
+    }
+
+    bench().stop() ;
+    BOOST_CHECK( ! isNaN( x + y ) );
+
+    Polygon polygon( *ring ) ;
+    bench().start( boost::format( "%s area" ) % storage ) ;
+    algorithm::area( polygon ) ;
+    bench().stop() ;
+
+    bench().start( boost::format( "%s distance" ) % storage ) ;
+    Point outside( 2.0, 0.0 ) ;
+    algorithm::distance( outside, *ring ) ;
+    bench().stop() ;
+
+    // Point views are built on first access
+    bench().start( boost::format( "%s pointN" ) % storage ) ;
+    x = 0.0 ;
+
+    for ( size_t i = 0; i < constRing.numPoints(); i++ ) {
+        x += CGAL::to_double( constRing.pointN( i ).x() ) ;
+    }
+
+    bench().stop() ;
+
+    bench().start( boost::format( "%s destroy" ) % storage ) ;
+    ring.reset() ;
+    bench().stop() ;
+}
+}
+
+BOOST_AUTO_TEST_CASE( testLineStringStorage )
+{
+    benchRing( false ) ;
+}
+
+BOOST_AUTO_TEST_CASE( testCompactLineStringStorage )
+{
+    benchRing( true ) ;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -0,0 +1,121 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include "BenchData.h"
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+
+#include "../test_config.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace SFCGAL {
+
+///
+///
+///
+std::string benchDataFile( const std::string& name )
+{
+    return std::string( SFCGAL_TEST_DIRECTORY ) + "/data/" + name;
+}
+
+///
+///
+///
+std::vector< std::unique_ptr< Geometry > > readBenchWkt( const std::string& name )
+{
+    std::ifstream ifs( benchDataFile( name ).c_str() );
+
+    if ( ! ifs.good() ) {
+        BOOST_THROW_EXCEPTION( Exception( "can't open " + benchDataFile( name ) ) );
+    }
+
+    std::vector< std::unique_ptr< Geometry > > geometries;
+    std::string line;
+
+    while ( std::getline( ifs, line ) ) {
+        if ( ! line.empty() ) {
+            geometries.push_back( io::readWkt( line ) );
+        }
+    }
+
+    return geometries;
+}
+
+///
+///
+///
+std::unique_ptr< PolyhedralSurface > readBenchObj( const std::string& name )
+{
+    std::ifstream ifs( benchDataFile( name ).c_str() );
+
+    if ( ! ifs.good() ) {
+        BOOST_THROW_EXCEPTION( Exception( "can't open " + benchDataFile( name ) ) );
+    }
+
+    std::vector< Point > vertices;
+    std::unique_ptr< PolyhedralSurface > surface( new PolyhedralSurface() );
+    std::string line;
+
+    while ( std::getline( ifs, line ) ) {
+        std::istringstream iss( line );
+        std::string tag;
+        iss >> tag;
+
+        if ( tag == "v" ) {
+            double x, y, z;
+            iss >> x >> y >> z;
+            vertices.push_back( Point( x, y, z ) );
+        }
+        else if ( tag == "f" ) {
+            // "f v1 v2 v3...", each vertex may be followed by /vt/vn
+            std::unique_ptr< LineString > ring( new LineString() );
+            std::string vertex;
+
+            while ( iss >> vertex ) {
+                int index = std::atoi( vertex.c_str() );
+                index = index < 0 ? int( vertices.size() ) + index : index - 1;
+
+                if ( index < 0 || index >= int( vertices.size() ) ) {
+                    BOOST_THROW_EXCEPTION( Exception( "invalid face in " + name ) );
+                }
+
+                ring->addPoint( vertices[index] );
+            }
+
+            if ( ring->numPoints() < 3 ) {
+                continue;
+            }
+
+            ring->addPoint( Point( ring->startPoint() ) );
+            surface->addPolygon( new Polygon( ring.release() ) );
+        }
+    }
+
+    return surface;
+}
+
+} // namespace SFCGAL
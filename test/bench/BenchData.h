@@ -0,0 +1,48 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_BENCH_DATA_H_
+#define _SFCGAL_BENCH_DATA_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SFCGAL {
+class Geometry ;
+class PolyhedralSurface ;
+
+/**
+ * path of a file in test/data
+ */
+std::string benchDataFile( const std::string& name ) ;
+
+/**
+ * read a file of test/data with one WKT geometry per line (countries.wkt...)
+ */
+std::vector< std::unique_ptr< Geometry > > readBenchWkt( const std::string& name ) ;
+
+/**
+ * read the faces of a Wavefront OBJ file of test/data (teapot.obj...)
+ */
+std::unique_ptr< PolyhedralSurface > readBenchObj( const std::string& name ) ;
+
+} // namespace SFCGAL
+
+#endif
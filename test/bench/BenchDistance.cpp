@@ -0,0 +1,103 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+
+#include "../test_config.h"
+#include "Bench.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/distance3d.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchDistance )
+
+namespace {
+// sinusoid with n points along x, shifted by dy
+LineString sinusoid( size_t n, const double& dy, const double& z = 0.0 )
+{
+    LineString ls;
+
+    for ( size_t i = 0; i < n; i++ ) {
+        ls.addPoint( Point( double( i ), dy + std::sin( i * 0.1 ), z ) );
+    }
+
+    return ls;
+}
+}
+
+BOOST_AUTO_TEST_CASE( testDistanceLineStringLineString )
+{
+    LineString a( sinusoid( 20000, 0.0 ) );
+    LineString b( sinusoid( 20000, 3.0 ) );
+
+    bench().start( "distance LineString/LineString 20000x20000" ) ;
+
+    for ( int i = 0; i < 10; i++ ) {
+        algorithm::distance( a, b ) ;
+    }
+
+    bench().stop();
+
+    bench().start( "distance LineString/LineString 20000x20000 maxDistance" ) ;
+
+    for ( int i = 0; i < 10; i++ ) {
+        algorithm::distance( a, b, 0.5 ) ;
+    }
+
+    bench().stop();
+
+    bench().start( "distance3D LineString/LineString 20000x20000" ) ;
+
+    for ( int i = 0; i < 10; i++ ) {
+        algorithm::distance3D( a, b ) ;
+    }
+
+    bench().stop();
+}
+
+BOOST_AUTO_TEST_CASE( testDistanceLineStringPolygon )
+{
+    LineString ring( sinusoid( 20000, 0.0 ) );
+    ring.addPoint( Point( 19999.0, -10.0, 0.0 ) );
+    ring.addPoint( Point( 0.0, -10.0, 0.0 ) );
+    ring.addPoint( Point( ring.startPoint() ) );
+    Polygon polygon( ring );
+
+    LineString ls( sinusoid( 20000, 3.0 ) );
+
+    bench().start( "distance LineString/Polygon 20000x20000" ) ;
+
+    for ( int i = 0; i < 10; i++ ) {
+        algorithm::distance( ls, polygon ) ;
+    }
+
+    bench().stop();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
@@ -0,0 +1,97 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/MultiLineString.h>
+#include <SFCGAL/detail/graph/GeometryGraph.h>
+#include <SFCGAL/detail/graph/GeometryGraphBuilder.h>
+#include <SFCGAL/detail/graph/CompactGeometryGraph.h>
+#include <SFCGAL/detail/graph/CompactGeometryGraphBuilder.h>
+
+#include "Bench.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+//
+// GeometryGraph (boost::adjacency_list) and CompactGeometryGraph (vectors)
+// built from the same MultiLineString. Allocations are reported with timings.
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchGraph )
+
+namespace {
+
+// n horizontal and n vertical LineStrings of n points on a grid
+MultiLineString grid( const size_t& n )
+{
+    MultiLineString lines ;
+
+    for ( size_t i = 0; i < n; i++ ) {
+        LineString horizontal, vertical ;
+
+        for ( size_t j = 0; j < n; j++ ) {
+            horizontal.addPoint( Point( double( j ), double( i ) ) );
+            vertical.addPoint( Point( double( i ), double( j ) ) );
+        }
+
+        lines.addGeometry( horizontal );
+        lines.addGeometry( vertical );
+    }
+
+    return lines ;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( testBuildGraph )
+{
+    const size_t sizes[] = { 32, 128, 512 };
+
+    for ( size_t k = 0; k < sizeof( sizes ) / sizeof( sizes[0] ); k++ ) {
+        const MultiLineString lines = grid( bench().scaled( sizes[k] ) );
+        const size_t numPoints = lines.numGeometries() * lines.lineStringN( 0 ).numPoints() ;
+
+        bench().measure( "graph/adjacency_list", numPoints, [&] {
+            graph::GeometryGraph        g ;
+            graph::GeometryGraphBuilder builder( g ) ;
+
+            for ( size_t i = 0; i < lines.numGeometries(); i++ ) {
+                builder.addLineString( lines.lineStringN( i ) );
+            }
+        } );
+
+        bench().measure( "graph/compact", numPoints, [&] {
+            graph::CompactGeometryGraph        g ;
+            graph::CompactGeometryGraphBuilder builder( g, numPoints ) ;
+
+            for ( size_t i = 0; i < lines.numGeometries(); i++ ) {
+                builder.addLineString( lines.lineStringN( i ) );
+            }
+
+            g.buildAdjacency();
+        } );
+
+        bench().measure( "boundary/multilinestring", numPoints, [&] { lines.boundary(); } );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
@@ -0,0 +1,109 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/Point.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/algorithm/ConsistentOrientationBuilder.h>
+#include <SFCGAL/triangulate/triangulatePolygon.h>
+
+#include "Bench.h"
+#include "BenchData.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchOrientation )
+
+namespace {
+
+// n x n squares split in two triangles, one triangle out of two is reversed
+TriangulatedSurface grid( const size_t& n )
+{
+    TriangulatedSurface tin ;
+    tin.reserve( 2 * n * n );
+
+    for ( size_t i = 0; i < n; i++ ) {
+        for ( size_t j = 0; j < n; j++ ) {
+            const double x = double( i ), y = double( j );
+            tin.addTriangle( Triangle( Point( x, y, 0.0 ), Point( x + 1.0, y, 0.0 ), Point( x + 1.0, y + 1.0, 0.0 ) ) );
+            tin.addTriangle( Triangle( Point( x, y, 0.0 ), Point( x, y + 1.0, 0.0 ), Point( x + 1.0, y + 1.0, 0.0 ) ) );
+        }
+    }
+
+    return tin ;
+}
+
+// triangulated faces of an OBJ file with one triangle out of two reversed
+TriangulatedSurface mesh( const std::string& name )
+{
+    std::unique_ptr< PolyhedralSurface > surface( readBenchObj( name ) );
+    TriangulatedSurface tin ;
+    triangulate::triangulatePolygon3D( *surface, tin );
+
+    for ( size_t i = 0; i < tin.numTriangles(); i += 2 ) {
+        tin.triangleN( i ).reverse();
+    }
+
+    return tin ;
+}
+
+void benchOrientation( const std::string& name, const TriangulatedSurface& tin )
+{
+    // some meshes have non manifold edges
+    try {
+        algorithm::ConsistentOrientationBuilder builder ;
+        builder.addTriangulatedSurface( tin );
+        builder.buildTriangulatedSurface();
+    }
+    catch ( Exception& e ) {
+        BOOST_TEST_MESSAGE( name << " can't be oriented : " << e.what() );
+        return ;
+    }
+
+    bench().measure( "consistentOrientation/" + name, tin.numTriangles(), [&] {
+        algorithm::ConsistentOrientationBuilder builder ;
+        builder.addTriangulatedSurface( tin );
+        builder.buildTriangulatedSurface();
+    } );
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( testConsistentOrientationGrid )
+{
+    const size_t sizes[] = { 16, 64, 256 };
+
+    for ( size_t i = 0; i < sizeof( sizes ) / sizeof( sizes[0] ); i++ ) {
+        benchOrientation( "grid", grid( bench().scaled( sizes[i] ) ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testConsistentOrientationMesh )
+{
+    benchOrientation( "teapot", mesh( "teapot.obj" ) );
+    benchOrientation( "teddy", mesh( "teddy.obj" ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
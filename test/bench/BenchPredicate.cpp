@@ -25,6 +25,12 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/detail/generator/sierpinski.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
+#include <SFCGAL/detail/generator/disc.h>
+#include <SFCGAL/detail/SolidLocator.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/algorithm/extrude.h>
+#include <SFCGAL/algorithm/covers.h>
 
 using namespace boost::unit_test ;
 using namespace SFCGAL ;
@@ -66,6 +72,42 @@ BOOST_AUTO_TEST_CASE( testPointCompare )
     bench().stop();
 }
 
+//
+// points in an extruded disc : one covers3D test per point against a locator built once
+BOOST_AUTO_TEST_CASE( testSolidLocator )
+{
+    std::unique_ptr< Polygon > disc( generator::disc( Point( 0.0, 0.0 ), 1.0, 16U ) );
+    std::unique_ptr< Geometry > solid( algorithm::extrude( *disc, 0.0, 0.0, 1.0 ) );
+
+    std::vector< Point > points;
+
+    for ( size_t i = 0; i < 100000; i++ ) {
+        points.push_back( Point( 2.0 * randf() - 1.0, 2.0 * randf() - 1.0, randf() ) );
+    }
+
+    const size_t numCovers = 100;
+    bench().measure( "covers3D/discSolid", numCovers, [&] {
+        for ( size_t i = 0; i < numCovers; i++ ) {
+            algorithm::covers3D( *solid, points[i] );
+        }
+    } );
+
+    bench().measure( "solidLocator/build/discSolid", 1, [&] {
+        detail::SolidLocator locator( *solid );
+    } );
+
+    detail::SolidLocator locator( *solid );
+    std::vector< CGAL::Bounded_side > sides( points.size() );
+
+    const size_t threads[] = { 1, 4, 0 };
+
+    for ( size_t t = 0; t < 3; t++ ) {
+        bench().measure( ( boost::format( "solidLocator/locate/discSolid/threads=%s" ) % threads[t] ).str(), points.size(), [&] {
+            locator.locate( points.begin(), points.end(), sides.begin(), threads[t] );
+        } );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
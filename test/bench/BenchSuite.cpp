@@ -0,0 +1,203 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <sstream>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/detail/io/Serialization.h>
+#include <SFCGAL/detail/io/FlatGeometry.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/union.h>
+#include <SFCGAL/algorithm/difference.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/area.h>
+#include <SFCGAL/algorithm/straightSkeleton.h>
+#include <SFCGAL/algorithm/minkowskiSum.h>
+#include <SFCGAL/algorithm/offset.h>
+#include <SFCGAL/triangulate/triangulatePolygon.h>
+#include <SFCGAL/detail/generator/disc.h>
+#include <SFCGAL/detail/generator/hoch.h>
+#include <SFCGAL/detail/generator/sierpinski.h>
+
+#include "Bench.h"
+#include "BenchData.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+//
+// Repeated measures of the public algorithms on generated inputs of growing
+// size and on the datasets of test/data. Results are written as JSON with
+// SFCGAL_BENCH_JSON=file and compared with script/bench-compare.py
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchSuite )
+
+namespace {
+
+// number of points of the generated discs
+const size_t DISC_SIZES[] = { 64, 512, 4096 };
+const size_t NUM_DISC_SIZES = sizeof( DISC_SIZES ) / sizeof( DISC_SIZES[0] );
+
+// disc with about n points
+std::unique_ptr< Polygon > disc( const double& x, const size_t& n )
+{
+    return generator::disc( Point( x, 0.0 ), 1.0, unsigned( std::max( size_t( 1 ), n / 4 ) ) );
+}
+
+// enough iterations for fast measures to be meaningful
+size_t iterations( const size_t& n )
+{
+    return std::max( size_t( 1 ), size_t( 4096 ) / n );
+}
+
+// n unit squares on a line
+std::unique_ptr< GeometryCollection > squares( const size_t& n )
+{
+    std::unique_ptr< GeometryCollection > result( new GeometryCollection() );
+
+    for ( size_t i = 0; i < n; ++i ) {
+        std::ostringstream wkt;
+        wkt << "POLYGON((" << i << " 0," << i + 1 << " 0," << i + 1 << " 1," << i << " 1," << i << " 0))";
+        result->addGeometry( io::readWkt( wkt.str() ).release() );
+    }
+
+    return result;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( testPredicates )
+{
+    for ( size_t i = 0; i < NUM_DISC_SIZES; ++i ) {
+        const size_t n = bench().scaled( DISC_SIZES[i] );
+        std::unique_ptr< Polygon > a( disc( 0.0, n ) ), b( disc( 0.5, n ) ), far( disc( 3.0, n ) );
+
+        bench().measure( "intersects/disc_disc", n, iterations( n ), [&] { algorithm::intersects( *a, *b ); } );
+        bench().measure( "distance/disc_disc", n, iterations( n ), [&] { algorithm::distance( *a, *far ); } );
+    }
+
+    std::vector< std::unique_ptr< Geometry > > countries( readBenchWkt( "countries.wkt" ) );
+    BOOST_REQUIRE( countries.size() >= 2 );
+
+    bench().measure( "intersects/countries", 2, [&] { algorithm::intersects( *countries[0], *countries[1] ); } );
+    bench().measure( "distance/countries", 2, [&] { algorithm::distance( *countries[0], *countries[1] ); } );
+}
+
+BOOST_AUTO_TEST_CASE( testOverlay )
+{
+    for ( size_t i = 0; i < NUM_DISC_SIZES; ++i ) {
+        const size_t n = bench().scaled( DISC_SIZES[i] );
+        std::unique_ptr< Polygon > a( disc( 0.0, n ) ), b( disc( 0.5, n ) );
+
+        bench().measure( "intersection/disc_disc", n, [&] { algorithm::intersection( *a, *b ); } );
+        bench().measure( "union/disc_disc", n, [&] { algorithm::union_( *a, *b ); } );
+        bench().measure( "difference/disc_disc", n, [&] { algorithm::difference( *a, *b ); } );
+    }
+
+    const size_t numSquares[] = { 16, 64, 256 };
+
+    for ( size_t i = 0; i < 3; ++i ) {
+        const size_t n = bench().scaled( numSquares[i] );
+        std::unique_ptr< GeometryCollection > collection( squares( n ) );
+        bench().measure( "unionAll/squares", n, [&] { algorithm::unionAll( *collection ); } );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testMeasures )
+{
+    for ( unsigned int order = 3; order <= 6; ++order ) {
+        std::unique_ptr< MultiPolygon > triangles( generator::sierpinski( order ) );
+        bench().measure( "area/sierpinski", triangles->numGeometries(), [&] { algorithm::area( *triangles ); } );
+    }
+
+    std::vector< std::unique_ptr< Geometry > > countries( readBenchWkt( "countries.wkt" ) );
+    bench().measure( "area/countries", countries.size(), [&] {
+        for ( size_t i = 0; i < countries.size(); ++i ) {
+            algorithm::area( *countries[i] );
+        }
+    } );
+
+    std::unique_ptr< PolyhedralSurface > teapot( readBenchObj( "teapot.obj" ) );
+    // the faces of the teapot are not checked to form a valid PolyhedralSurface
+    bench().measure( "area3D/teapot", teapot->numPolygons(), [&] { algorithm::area3D( *teapot, algorithm::NoValidityCheck() ); } );
+}
+
+BOOST_AUTO_TEST_CASE( testConstructions )
+{
+    for ( unsigned int order = 2; order <= 4; ++order ) {
+        std::unique_ptr< Polygon > snowflake( generator::hoch( order ) );
+        const size_t n = snowflake->exteriorRing().numPoints();
+
+        bench().measure( "triangulate/hoch", n, [&] {
+            TriangulatedSurface tin;
+            triangulate::triangulatePolygon3D( *snowflake, tin );
+        } );
+        bench().measure( "straightSkeleton/hoch", n, [&] { algorithm::straightSkeleton( *snowflake ); } );
+
+        std::unique_ptr< Polygon > brush( generator::disc( Point( 0.0, 0.0 ), 0.05, 2 ) );
+        bench().measure( "minkowskiSum/hoch", n, [&] { algorithm::minkowskiSum( *snowflake, *brush ); } );
+        bench().measure( "offset/hoch", n, [&] { algorithm::offset( *snowflake, 0.05 ); } );
+    }
+
+    std::unique_ptr< PolyhedralSurface > teapot( readBenchObj( "teapot.obj" ) );
+    bench().measure( "triangulate/teapot", teapot->numPolygons(), [&] {
+        TriangulatedSurface tin;
+        triangulate::triangulatePolygon3D( *teapot, tin );
+    } );
+}
+
+BOOST_AUTO_TEST_CASE( testIO )
+{
+    std::vector< std::unique_ptr< Geometry > > countries( readBenchWkt( "countries.wkt" ) );
+    std::unique_ptr< PolyhedralSurface > teapot( readBenchObj( "teapot.obj" ) );
+
+    const Geometry* datasets[] = { countries[0].get(), teapot.get() };
+    const char* names[] = { "countries", "teapot" };
+
+    for ( size_t i = 0; i < 2; ++i ) {
+        const Geometry& g = *datasets[i];
+        const std::string family( names[i] );
+        const size_t size = g.numGeometries();
+
+        const std::string wkt = g.asText();
+        bench().measure( "writeWkt/" + family, size, [&] { g.asText(); } );
+        bench().measure( "readWkt/" + family, size, [&] { io::readWkt( wkt ); } );
+
+        const std::string binary = io::writeBinaryGeometry( g );
+        bench().measure( "writeBinary/" + family, size, [&] { io::writeBinaryGeometry( g ); } );
+        bench().measure( "readBinary/" + family, size, [&] { io::readBinaryGeometry( binary ); } );
+
+        const std::string flat = io::writeFlatGeometry( g );
+        bench().measure( "writeFlat/" + family, size, [&] { io::writeFlatGeometry( g ); } );
+        bench().measure( "readFlat/" + family, size, [&] { io::readFlatGeometry( flat.data(), flat.size() ); } );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
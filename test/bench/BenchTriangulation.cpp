@@ -36,6 +36,8 @@
 #include <SFCGAL/detail/generator/disc.h>
 #include <SFCGAL/triangulate/triangulate2DZ.h>
 #include <SFCGAL/triangulate/triangulatePolygon.h>
+#include <SFCGAL/algorithm/tesselate.h>
+#include <SFCGAL/algorithm/extrude.h>
 
 #include "../test_config.h"
 #include "Bench.h"
@@ -185,6 +187,93 @@ BOOST_AUTO_TEST_CASE( testPolygonTriangulationDisc2D_roundingSixDecimal )
 }
 
 
+//
+// TIN of the rgc-france-ign.xyz points, one insertion per point or bulk insertion
+BOOST_AUTO_TEST_CASE( testTriangulateRGC )
+{
+    std::ifstream ifs( ( std::string( SFCGAL_TEST_DIRECTORY ) + "/data/rgc-france-ign.xyz" ).c_str() );
+    BOOST_REQUIRE( ifs.good() );
+
+    std::vector< Coordinate > positions ;
+    double x, y, z ;
+
+    while ( ifs >> x >> y >> z ) {
+        positions.push_back( Coordinate( x, y, z ) );
+    }
+
+    bench().measure( "cdt/addVertex/rgc", positions.size(), [&] {
+        ConstraintDelaunayTriangulation triangulation ;
+
+        for ( size_t i = 0; i < positions.size(); i++ ) {
+            triangulation.addVertex( positions[i] );
+        }
+    } );
+
+    bench().measure( "cdt/addVertices/rgc", positions.size(), [&] {
+        ConstraintDelaunayTriangulation triangulation ;
+        triangulation.addVertices( positions );
+    } );
+
+    MultiPoint multiPoint ;
+
+    for ( size_t i = 0; i < positions.size(); i++ ) {
+        multiPoint.addGeometry( new Point( positions[i] ) );
+    }
+
+    bench().measure( "triangulate2DZ/rgc", positions.size(), [&] {
+        triangulate2DZ( multiPoint );
+    } );
+}
+
+//
+// tesselate of many discs, sequential and with 2, 4 and all the cores
+BOOST_AUTO_TEST_CASE( testTesselateParallel )
+{
+    const int N = 10000 ;
+
+    MultiPolygon multiPolygon ;
+
+    for ( int i = 0; i < N; i++ ) {
+        multiPolygon.addGeometry( generator::disc( Point( 3.0 * ( i % 100 ), 3.0 * ( i / 100 ) ), 1.0, 8U ).release() );
+    }
+
+    bench().measure( "tesselate/discs", N, [&] {
+        algorithm::tesselate( multiPolygon );
+    } );
+
+    const size_t threads[] = { 1, 2, 4, 0 };
+
+    for ( size_t i = 0; i < 4; i++ ) {
+        bench().measure( ( boost::format( "tesselate/discs/threads=%s" ) % threads[i] ).str(), N, [&] {
+            algorithm::tesselate( multiPolygon, threads[i] );
+        } );
+    }
+}
+
+//
+// triangulation of extruded discs (convex caps and quads), with and without the fast path
+BOOST_AUTO_TEST_CASE( testTriangulationQuality )
+{
+    const int N = 1000 ;
+
+    GeometryCollection solids ;
+
+    for ( int i = 0; i < N; i++ ) {
+        std::unique_ptr< Polygon > disc( generator::disc( Point( 3.0 * ( i % 100 ), 3.0 * ( i / 100 ) ), 1.0, 8U ) );
+        solids.addGeometry( algorithm::extrude( *disc, 0.0, 0.0, 10.0 ).release() );
+    }
+
+    bench().measure( "triangulatePolygon3D/extrudedDiscs/delaunay", N, [&] {
+        TriangulatedSurface tin ;
+        triangulatePolygon3D( solids, tin, TRIANGULATION_DELAUNAY );
+    } );
+
+    bench().measure( "triangulatePolygon3D/extrudedDiscs/fast", N, [&] {
+        TriangulatedSurface tin ;
+        triangulatePolygon3D( solids, tin, TRIANGULATION_FAST );
+    } );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -0,0 +1,195 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <thread>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/area.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/detail/GeometrySet.h>
+
+#include "Bench.h"
+#include "BenchData.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchValidity )
+
+namespace {
+
+// rings of the polygons of a geometry
+void collectRings( const Geometry& g, std::vector< const LineString* >& rings )
+{
+    if ( g.is< Polygon >() ) {
+        const Polygon& polygon = g.as< Polygon >() ;
+
+        for ( size_t i = 0; i < polygon.numRings(); i++ ) {
+            rings.push_back( &polygon.ringN( i ) );
+        }
+    }
+    else {
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            if ( &g.geometryN( i ) != &g ) {
+                collectRings( g.geometryN( i ), rings );
+            }
+        }
+    }
+}
+
+// boxes of the segments of a ring
+std::vector< detail::IndexedBox<2> > segmentBoxes( const LineString& ring )
+{
+    std::vector< detail::IndexedBox<2> > boxes ;
+
+    for ( size_t i = 0; i + 1 < ring.numPoints(); i++ ) {
+        const double ax = CGAL::to_double( ring.pointN( i ).x() ), ay = CGAL::to_double( ring.pointN( i ).y() );
+        const double bx = CGAL::to_double( ring.pointN( i + 1 ).x() ), by = CGAL::to_double( ring.pointN( i + 1 ).y() );
+        boxes.push_back( detail::IndexedBox<2>( CGAL::Bbox_2( std::min( ax, bx ), std::min( ay, by ), std::max( ax, bx ), std::max( ay, by ) ), i ) );
+    }
+
+    return boxes ;
+}
+
+// counts candidate pairs
+struct count_cb {
+    count_cb( size_t& count ) : _count( count ) {}
+
+    bool operator()( const detail::IndexedBox<2>&, const detail::IndexedBox<2>& ) const {
+        ++_count ;
+        return false ;
+    }
+
+    size_t& _count ;
+};
+
+}
+
+BOOST_AUTO_TEST_CASE( testValidityCountries )
+{
+    std::vector< std::unique_ptr< Geometry > > countries( readBenchWkt( "countries.wkt" ) );
+    std::vector< const LineString* > rings ;
+    size_t numPoints = 0 ;
+
+    for ( size_t i = 0; i < countries.size(); i++ ) {
+        collectRings( *countries[i], rings );
+    }
+
+    for ( size_t i = 0; i < rings.size(); i++ ) {
+        numPoints += rings[i]->numPoints() ;
+    }
+
+    bench().measure( "isValid/countries", numPoints, [&] {
+        for ( size_t i = 0; i < countries.size(); i++ ) {
+            algorithm::isValid( *countries[i] );
+        }
+    } );
+
+    bench().measure( "selfIntersects/countries", numPoints, [&] {
+        for ( size_t i = 0; i < rings.size(); i++ ) {
+            algorithm::selfIntersects( *rings[i] );
+        }
+    } );
+
+    // sweeps on the segment boxes, without segment tests
+    std::vector< std::vector< detail::IndexedBox<2> > > boxes ;
+
+    for ( size_t i = 0; i < rings.size(); i++ ) {
+        boxes.push_back( segmentBoxes( *rings[i] ) );
+    }
+
+    size_t sweepPairs = 0, indexedPairs = 0 ;
+
+    bench().measure( "boxSweep/countries", numPoints, [&] {
+        sweepPairs = 0 ;
+
+        for ( size_t i = 0; i < boxes.size(); i++ ) {
+            detail::box_self_intersection_until( boxes[i].begin(), boxes[i].end(), count_cb( sweepPairs ) );
+        }
+    } );
+
+    bench().measure( "indexedBoxSweep/countries", numPoints, [&] {
+        indexedPairs = 0 ;
+
+        for ( size_t i = 0; i < boxes.size(); i++ ) {
+            detail::box_self_intersection_indexed_until( boxes[i].begin(), boxes[i].end(), count_cb( indexedPairs ) );
+        }
+    } );
+
+    BOOST_CHECK_EQUAL( sweepPairs, indexedPairs );
+}
+
+BOOST_AUTO_TEST_CASE( testParallelValidityCountries )
+{
+    std::vector< std::unique_ptr< Geometry > > countries( readBenchWkt( "countries.wkt" ) );
+    GeometryCollection collection ;
+
+    for ( size_t i = 0; i < countries.size(); i++ ) {
+        collection.addGeometry( *countries[i] );
+    }
+
+    const size_t numThreads = std::max( 1U, std::thread::hardware_concurrency() );
+
+    bench().measure( "isValid/countries/1 thread", collection.numGeometries(), [&] {
+        algorithm::isValid( collection, 1e-9, 1 );
+    } );
+
+    bench().measure( ( boost::format( "isValid/countries/%d threads" ) % numThreads ).str(), collection.numGeometries(), [&] {
+        algorithm::isValid( collection, 1e-9, numThreads );
+    } );
+}
+
+BOOST_AUTO_TEST_CASE( testValidityCacheCountries )
+{
+    std::vector< std::unique_ptr< Geometry > > all( readBenchWkt( "countries.wkt" ) );
+    std::vector< std::unique_ptr< Geometry > > countries;
+
+    for ( size_t i = 0; i < all.size(); i++ ) {
+        if ( algorithm::isValid( *all[i] ) ) {
+            countries.push_back( std::move( all[i] ) );
+        }
+    }
+
+    // every function checks its inputs, the first check of each country is cached
+    algorithm::resetValidityCacheStats();
+
+    bench().measure( "intersects+area+distance/countries", countries.size(), [&] {
+        for ( size_t i = 0; i + 1 < countries.size(); i++ ) {
+            algorithm::intersects( *countries[i], *countries[i + 1] );
+            algorithm::area( *countries[i] );
+            algorithm::distance( *countries[i], *countries[i + 1] );
+        }
+    } );
+
+    const algorithm::ValidityCacheStats stats = algorithm::validityCacheStats();
+    BOOST_TEST_MESSAGE( "validity cache : " << stats.hits << " hits, " << stats.misses << " misses" );
+    BOOST_CHECK( stats.misses <= countries.size() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
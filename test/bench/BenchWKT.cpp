@@ -18,6 +18,7 @@
  *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
  */
 #include <fstream>
+#include <sstream>
 
 #include <SFCGAL/Point.h>
 #include <SFCGAL/LineString.h>
@@ -32,9 +33,11 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/io/wkt.h>
+#include <SFCGAL/io/WktStreamReader.h>
 
 #include "../test_config.h"
 #include "Bench.h"
+#include "BenchData.h"
 
 #include <boost/test/unit_test.hpp>
 #include <boost/format.hpp>
@@ -121,7 +124,115 @@ BOOST_AUTO_TEST_CASE( testReadSolid )
 }
 
 
+//
+// countries dump, read line by line from memory
+BOOST_AUTO_TEST_CASE( testReadCountries )
+{
+    std::ifstream ifs( benchDataFile( "countries.wkt" ).c_str() );
+    BOOST_REQUIRE( ifs.good() );
+
+    std::vector< std::string > lines;
+    std::string line;
+    size_t numChars = 0;
+
+    while ( std::getline( ifs, line ) ) {
+        if ( ! line.empty() ) {
+            numChars += line.size();
+            lines.push_back( line );
+        }
+    }
+
+    bench().measure( "readWkt/countries", numChars, [&] {
+        for ( size_t i = 0; i < lines.size(); i++ ) {
+            io::readWkt( lines[i] );
+        }
+    } );
+
+    bench().measure( "readWkt/countries/char*", numChars, [&] {
+        for ( size_t i = 0; i < lines.size(); i++ ) {
+            io::readWkt( lines[i].data(), lines[i].size() );
+        }
+    } );
+}
+
+//
+// numbers which are not doubles (exact decimal path)
+BOOST_AUTO_TEST_CASE( testReadLongDecimals )
+{
+    const int N = 10000 ;
+
+    std::ostringstream oss;
+    oss << "LINESTRING(";
+
+    for ( int i = 0; i < N; i++ ) {
+        oss << ( i ? "," : "" ) << "0." << i << "123456789012345678 " << i << ".1";
+    }
 
+    oss << ")";
+    const std::string wkt( oss.str() );
+
+    bench().measure( "readWkt/longDecimals", N, [&] { io::readWkt( wkt ); } );
+}
+
+
+
+//
+// write the countries dump
+BOOST_AUTO_TEST_CASE( testWriteCountries )
+{
+    std::vector< std::unique_ptr< Geometry > > countries( readBenchWkt( "countries.wkt" ) );
+    std::string buffer;
+
+    bench().measure( "asText/countries", countries.size(), [&] {
+        for ( size_t i = 0; i < countries.size(); i++ ) {
+            countries[i]->asText( 6 );
+        }
+    } );
+
+    bench().measure( "writeWkt/countries/reused", countries.size(), [&] {
+        for ( size_t i = 0; i < countries.size(); i++ ) {
+            buffer.clear();
+            io::writeWkt( *countries[i], buffer, 6 );
+        }
+    } );
+
+    bench().measure( "writeWkt/countries/exact", countries.size(), [&] {
+        for ( size_t i = 0; i < countries.size(); i++ ) {
+            buffer.clear();
+            io::writeWkt( *countries[i], buffer );
+        }
+    } );
+
+    bench().measure( "writeWkt/countries/shortest", countries.size(), [&] {
+        for ( size_t i = 0; i < countries.size(); i++ ) {
+            buffer.clear();
+            io::writeWkt( *countries[i], buffer, -2 );
+        }
+    } );
+}
+
+//
+// countries dump, read from a stream by WktStreamReader
+BOOST_AUTO_TEST_CASE( testStreamReadCountries )
+{
+    std::ifstream ifs( benchDataFile( "countries.wkt" ).c_str() );
+    BOOST_REQUIRE( ifs.good() );
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+    const std::string text( oss.str() );
+
+    const size_t numThreads[] = { 1, 2, 4, 0 };
+
+    for ( size_t i = 0; i < sizeof( numThreads ) / sizeof( numThreads[0] ); i++ ) {
+        bench().measure( ( boost::format( "WktStreamReader/countries/%1%threads" ) % numThreads[i] ).str(), text.size(), [&] {
+            std::istringstream iss( text );
+            io::WktStreamReader reader( iss, false, numThreads[i], 64 );
+
+            while ( reader.next() ) {
+            }
+        } );
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -27,3 +27,23 @@ using namespace boost::unit_test ;
 
 
 
+
+#include <cstdlib>
+#include <fstream>
+
+#include "Bench.h"
+
+//
+// Write the results of the measures at the end of the run
+struct BenchJsonOutput {
+    ~BenchJsonOutput() {
+        const char* filename = std::getenv( "SFCGAL_BENCH_JSON" );
+
+        if ( filename ) {
+            std::ofstream ofs( filename );
+            SFCGAL::bench().writeJson( ofs );
+        }
+    }
+};
+
+BOOST_GLOBAL_FIXTURE( BenchJsonOutput );
@@ -79,6 +79,63 @@ BOOST_AUTO_TEST_SUITE( SFCGAL_GeometryTest )
 //TODO
 //template <class Archive> void serialize( Archive& ar, const unsigned int version )
 
+BOOST_AUTO_TEST_CASE( testGeneration )
+{
+    LineString ls( Point( 0.0, 0.0 ), Point( 1.0, 1.0 ) );
+    boost::uint64_t generation = ls.generation();
+
+    // const accessors
+    const LineString& cls = ls;
+    cls.pointN( 0 );
+    cls.startPoint();
+    BOOST_CHECK_EQUAL( ls.generation(), generation );
+
+    ls.addPoint( Point( 2.0, 0.0 ) );
+    BOOST_CHECK( ls.generation() != generation );
+    generation = ls.generation();
+
+    // a non const accessor may be used to modify the LineString
+    ls.pointN( 0 );
+    BOOST_CHECK( ls.generation() != generation );
+
+    Polygon polygon;
+    generation = polygon.generation();
+    polygon.exteriorRing();
+    BOOST_CHECK( polygon.generation() != generation );
+
+    // modification through a reference to a part
+    LineString& ring = polygon.exteriorRing();
+    generation = polygon.deepGeneration();
+    ring.addPoint( Point( 0.0, 0.0 ) );
+    BOOST_CHECK_EQUAL( polygon.deepGeneration(), ring.generation() );
+    BOOST_CHECK( polygon.deepGeneration() > generation );
+}
+
+BOOST_AUTO_TEST_CASE( testValidityCache )
+{
+    LineString ls( Point( 0.0, 0.0 ), Point( 1.0, 1.0 ) );
+    BOOST_CHECK( ! ls.hasCachedValidity( Geometry::VALIDITY_CHECK_DEFAULT ) );
+
+    ls.cacheValidity( Geometry::VALIDITY_CHECK_DEFAULT );
+    ls.cacheValidity( Geometry::VALIDITY_CHECK_3D );
+    BOOST_CHECK( ls.hasCachedValidity( Geometry::VALIDITY_CHECK_DEFAULT ) );
+    BOOST_CHECK( ls.hasCachedValidity( Geometry::VALIDITY_CHECK_3D ) );
+    BOOST_CHECK( ! ls.hasCachedValidity( Geometry::VALIDITY_CHECK_2D ) );
+
+    // copies are checked again
+    LineString copy( ls );
+    BOOST_CHECK( ! copy.hasCachedValidity( Geometry::VALIDITY_CHECK_DEFAULT ) );
+
+    ls.reverse();
+    BOOST_CHECK( ! ls.hasCachedValidity( Geometry::VALIDITY_CHECK_DEFAULT ) );
+    BOOST_CHECK( ! ls.hasCachedValidity( Geometry::VALIDITY_CHECK_3D ) );
+
+    ls.cacheValidity( Geometry::VALIDITY_CHECK_2D );
+    BOOST_CHECK( ls.hasCachedValidity( Geometry::VALIDITY_CHECK_2D ) );
+    ls.touch();
+    BOOST_CHECK( ! ls.hasCachedValidity( Geometry::VALIDITY_CHECK_2D ) );
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -25,6 +25,9 @@
 #include <SFCGAL/Envelope.h>
 #include <SFCGAL/MultiPoint.h>
 #include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/transform/ForceOrderPoints.h>
 
 using namespace SFCGAL ;
 using namespace boost::unit_test ;
@@ -395,6 +398,66 @@ BOOST_AUTO_TEST_CASE( isLineString )
 //template < typename Derived > inline const Derived &  Geometry::as() const
 //template < typename Derived > inline Derived &        Geometry::as()
 
+//bool compact() ;
+BOOST_AUTO_TEST_CASE( testCompact )
+{
+    LineString g( Point( 0.0,0.0,1.0 ), Point( 1.0,2.0,3.0 ) );
+    BOOST_REQUIRE( g.compact() );
+    BOOST_CHECK( g.isCompact() );
+    BOOST_CHECK( g.is3D() );
+    BOOST_REQUIRE_EQUAL( g.numPoints(), 2U );
+    BOOST_CHECK_EQUAL( g.coordinates()->y( 1 ), 2.0 );
+
+    // Point views (read through a const reference, the non const
+    // accessors go back to Point storage)
+    const LineString& view = g ;
+    BOOST_CHECK_EQUAL( view.pointN( 1 ).z(), 3.0 );
+    BOOST_CHECK_EQUAL( view.startPoint().z(), 1.0 );
+    BOOST_CHECK( g.isCompact() );
+
+    // copy and append keep the compact storage
+    LineString copy( g );
+    copy.addPoint( Point( 0.0,0.0,1.0 ) );
+    BOOST_CHECK( copy.isCompact() );
+    BOOST_CHECK( copy.isClosed() );
+    BOOST_CHECK_EQUAL( copy.asText( 0 ), "LINESTRING(0 0 1,1 2 3,0 0 1)" );
+
+    // modifications go back to Point objects
+    copy.pointN( 0 ).setM( 4.0 );
+    BOOST_CHECK( ! copy.isCompact() );
+    BOOST_CHECK_EQUAL( copy.pointN( 0 ).m(), 4.0 );
+}
+BOOST_AUTO_TEST_CASE( testCompactKeptByReadOnlyVisitors )
+{
+    LineString ring;
+    ring.addPoint( Point( 0.0,0.0 ) );
+    ring.addPoint( Point( 0.0,1.0 ) );
+    ring.addPoint( Point( 1.0,1.0 ) );
+    ring.addPoint( Point( 0.0,0.0 ) );
+    BOOST_REQUIRE( ring.compact() );
+
+    Polygon polygon( ring );
+    BOOST_REQUIRE( polygon.exteriorRing().isCompact() );
+
+    algorithm::propagateValidityFlag( polygon, true );
+    BOOST_CHECK( polygon.exteriorRing().isCompact() );
+    BOOST_CHECK( polygon.hasValidityFlag() );
+
+    // the ring is reversed in its compact storage
+    transform::ForceOrderPoints force( true );
+    polygon.accept( force );
+    BOOST_CHECK( polygon.exteriorRing().isCompact() );
+    BOOST_CHECK_EQUAL( polygon.asText( 0 ), "POLYGON((0 0,1 1,0 1,0 0))" );
+}
+
+BOOST_AUTO_TEST_CASE( testCompactNotDouble )
+{
+    LineString g( Point( 0.0,0.0 ), Point( Kernel::FT( 1 ) / 3, Kernel::FT( 1 ) ) );
+    BOOST_CHECK( ! g.compact() );
+    BOOST_CHECK( ! g.isCompact() );
+    BOOST_CHECK_EQUAL( g.numPoints(), 2U );
+}
+
 
 
 BOOST_AUTO_TEST_SUITE_END()
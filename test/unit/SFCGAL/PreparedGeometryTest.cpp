@@ -0,0 +1,105 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/distance3d.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/detail/SolidLocator.h>
+
+using namespace SFCGAL ;
+
+// always after CGAL
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_PreparedGeometryTest )
+
+BOOST_AUTO_TEST_CASE( testSameResultAsGeometry )
+{
+    const char* wkts[] = {
+        "POINT(0.5 0.5)",
+        "POINT(2 2)",
+        "POINT(3.5 0.5)",
+        "MULTIPOINT(0.5 0.5,1.5 1.5)",
+        "LINESTRING(-1 0.5,2 0.5)",
+        "LINESTRING(5 0,5 5)",
+        "LINESTRING(1.5 1.5,2.5 2.5)",
+        "POLYGON((0 0,1 0,1 1,0 1,0 0))",
+        "POLYGON((-2 -2,4 -2,4 4,-2 4,-2 -2),(1 1,3 1,3 3,1 3,1 1))",
+        "TRIANGLE((0 0 1,1 0 1,0 1 1,0 0 1))",
+        "GEOMETRYCOLLECTION(POINT(10 10),LINESTRING(0 3,3 0))"
+    };
+    const size_t n = sizeof( wkts ) / sizeof( wkts[0] );
+
+    for ( size_t i = 0; i < n; ++i ) {
+        PreparedGeometry pa( io::readWkt( wkts[i] ) );
+
+        for ( size_t j = 0; j < n; ++j ) {
+            std::unique_ptr< Geometry > gb( io::readWkt( wkts[j] ) );
+            BOOST_TEST_MESSAGE( pa.geometry().asText() << " / " << gb->asText() );
+
+            BOOST_CHECK_EQUAL( algorithm::intersects( pa, *gb ), algorithm::intersects( pa.geometry(), *gb ) );
+            BOOST_CHECK_EQUAL( algorithm::intersects3D( pa, *gb ), algorithm::intersects3D( pa.geometry(), *gb ) );
+            BOOST_CHECK_EQUAL( algorithm::covers( pa, *gb ), algorithm::covers( pa.geometry(), *gb ) );
+            BOOST_CHECK_CLOSE( algorithm::distance( pa, *gb ), algorithm::distance( pa.geometry(), *gb ), 1e-9 );
+            BOOST_CHECK_CLOSE( algorithm::distance3D( pa, *gb ), algorithm::distance3D( pa.geometry(), *gb ), 1e-9 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testSolid )
+{
+    PreparedGeometry pa( io::readWkt( "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" ) );
+
+    std::unique_ptr< Geometry > inside( io::readWkt( "POINT(0.5 0.5 0.5)" ) );
+    std::unique_ptr< Geometry > insideLine( io::readWkt( "LINESTRING(0.2 0.2 0.2,0.8 0.8 0.8)" ) );
+    std::unique_ptr< Geometry > outside( io::readWkt( "POINT(0.5 0.5 3)" ) );
+
+    BOOST_CHECK( algorithm::intersects3D( pa, *inside ) );
+    BOOST_CHECK( algorithm::intersects3D( pa, *insideLine ) );
+    BOOST_CHECK( ! algorithm::intersects3D( pa, *outside ) );
+    BOOST_CHECK_EQUAL( algorithm::distance3D( pa, *inside ), 0.0 );
+    BOOST_CHECK_CLOSE( algorithm::distance3D( pa, *outside ), 2.0, 1e-9 );
+
+    const detail::SolidLocator& locator = pa.solidLocator();
+    BOOST_CHECK_EQUAL( &locator, &pa.solidLocator() );
+    BOOST_CHECK_EQUAL( locator.locate( inside->as< Point >() ), CGAL::ON_BOUNDED_SIDE );
+    BOOST_CHECK_EQUAL( locator.locate( outside->as< Point >() ), CGAL::ON_UNBOUNDED_SIDE );
+}
+
+BOOST_AUTO_TEST_CASE( testInvalidateCache )
+{
+    PreparedGeometry pa( io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0))" ) );
+    std::unique_ptr< Geometry > p( io::readWkt( "POINT(5 5)" ) );
+    BOOST_CHECK( ! algorithm::intersects( pa, *p ) );
+
+    pa.resetGeometry( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0))" ).release() );
+    BOOST_CHECK( algorithm::intersects( pa, *p ) );
+    BOOST_CHECK_EQUAL( algorithm::distance( pa, *p ), 0.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
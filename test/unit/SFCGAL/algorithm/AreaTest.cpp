@@ -192,6 +192,25 @@ BOOST_AUTO_TEST_CASE( testArea3D_Square4X4WithHole )
     BOOST_CHECK_CLOSE( algorithm::area3D( *g ), 15.0, 1e-10 );
 }
 
+BOOST_AUTO_TEST_CASE( testArea_DecimalCoordinates )
+{
+    // coordinates are not doubles, the double evaluation is within MEASURE_RELATIVE_ERROR
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON((0.1 0.1,0.7 0.1,0.7 0.7,0.1 0.7,0.1 0.1),(0.2 0.2,0.2 0.3,0.3 0.3,0.2 0.2))" ) );
+    const Polygon& polygon = g->as< Polygon >() ;
+    const double exact = CGAL::to_double( CGAL::abs( algorithm::signedArea( polygon.exteriorRing() ) ) - CGAL::abs( algorithm::signedArea( polygon.interiorRingN( 0 ) ) ) ) ;
+    BOOST_CHECK_CLOSE( algorithm::area( *g ), exact, 1e-10 );
+    BOOST_CHECK_CLOSE( algorithm::area3D( *g ), exact, 1e-10 );
+}
+
+BOOST_AUTO_TEST_CASE( testArea_ExactFallback )
+{
+    // the rounding of the coordinates far from the origin prevents to
+    // guarantee the double evaluation, the exact area is returned
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON((1000000000.1 0,1000000000.2 0,1000000000.2 0.1,1000000000.1 0.1,1000000000.1 0))" ) );
+    BOOST_CHECK_EQUAL( algorithm::area( *g ), 0.01 );
+    BOOST_CHECK_CLOSE( algorithm::area3D( *g ), 0.01, 1e-10 );
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -85,4 +85,25 @@ BOOST_AUTO_TEST_CASE( notClosed )
 
 }
 
+BOOST_AUTO_TEST_CASE( exactCoordinates )
+{
+    // shared vertex computed in two different ways
+    const Kernel::FT third = Kernel::FT( 1 ) / 3 ;
+    const Kernel::FT otherThird = Kernel::FT( 2 ) / 6 ;
+
+    TriangulatedSurface tin ;
+    tin.addTriangle( Triangle( Point( 0.0, 0.0, 0.0 ), Point( 1.0, 0.0, 0.0 ), Point( third, third, Kernel::FT( 0 ) ) ) );
+    tin.addTriangle( Triangle( Point( 1.0, 0.0, 0.0 ), Point( 1.0, 1.0, 0.0 ), Point( otherThird, otherThird, Kernel::FT( 0 ) ) ) );
+
+    SurfaceGraph graph( tin );
+    BOOST_CHECK_MESSAGE( isConnected( graph ) , "not connected" );
+    BOOST_CHECK_MESSAGE( !isClosed( graph ) , "closed" );
+    BOOST_CHECK( graph.isValid() );
+
+    // same orientation on the shared edge
+    tin.addTriangle( Triangle( Point( 1.0, 0.0, 0.0 ), Point( third, third, Kernel::FT( 0 ) ), Point( 1.0, -1.0, 0.0 ) ) );
+    SurfaceGraph inconsistent( tin );
+    BOOST_CHECK( ! inconsistent.isValid() );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
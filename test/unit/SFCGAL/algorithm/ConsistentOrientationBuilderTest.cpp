@@ -20,6 +20,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <SFCGAL/Kernel.h>
+#include <SFCGAL/Exception.h>
 #include <SFCGAL/Point.h>
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/Polygon.h>
@@ -100,6 +101,50 @@ BOOST_AUTO_TEST_CASE( testFourTriangle )
     BOOST_CHECK( algorithm::hasConsistentOrientation3D( triangulatedSurface ) );
 }
 
+BOOST_AUTO_TEST_CASE( testReversedStrip )
+{
+    // strip of squares split in two triangles, the second triangle of each square is reversed
+    algorithm::ConsistentOrientationBuilder builder ;
+
+    for ( double i = 0.0; i < 100.0; i += 1.0 ) {
+        builder.addTriangle(
+            Triangle(
+                Point( i, 0.0, 0.0 ),
+                Point( i + 1, 0.0, 0.0 ),
+                Point( i + 1, 1.0, 0.0 )
+            )
+        );
+        builder.addTriangle(
+            Triangle(
+                Point( i, 0.0, 0.0 ),
+                Point( i, 1.0, 0.0 ),
+                Point( i + 1, 1.0, 0.0 )
+            )
+        );
+    }
+
+    TriangulatedSurface triangulatedSurface = builder.buildTriangulatedSurface();
+    BOOST_CHECK_EQUAL( triangulatedSurface.numGeometries(), 200U );
+    BOOST_CHECK( algorithm::hasConsistentOrientation3D( triangulatedSurface ) );
+    // the first triangle is the reference
+    BOOST_CHECK( triangulatedSurface.triangleN( 0 ).vertex( 1 ) == Point( 1.0, 0.0, 0.0 ) );
+
+    std::vector< size_t > expected;
+    expected.push_back( 1 );
+    expected.push_back( 3 );
+    const std::vector< size_t > neighbors = builder.neighbors( 0 );
+    BOOST_CHECK_EQUAL_COLLECTIONS( neighbors.begin(), neighbors.end(), expected.begin(), expected.end() );
+}
+
+BOOST_AUTO_TEST_CASE( testNonManifoldEdge )
+{
+    // three triangles sharing the same edge
+    algorithm::ConsistentOrientationBuilder builder ;
+    builder.addTriangle( Triangle( Point( 0.0, 0.0, 0.0 ), Point( 1.0, 0.0, 0.0 ), Point( 0.0, 1.0, 0.0 ) ) );
+    builder.addTriangle( Triangle( Point( 0.0, 0.0, 0.0 ), Point( 1.0, 0.0, 0.0 ), Point( 0.0, -1.0, 0.0 ) ) );
+    builder.addTriangle( Triangle( Point( 0.0, 0.0, 0.0 ), Point( 1.0, 0.0, 0.0 ), Point( 0.0, 0.0, 1.0 ) ) );
+    BOOST_CHECK_THROW( builder.buildTriangulatedSurface(), Exception );
+}
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,119 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/dWithin.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/distance3d.h>
+
+using namespace SFCGAL ;
+
+// always after CGAL
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_DWithinTest )
+
+BOOST_AUTO_TEST_CASE( testSameResultAsDistance )
+{
+    const char* wkts[] = {
+        "POINT(0.5 0.5)",
+        "POINT(3 3 1)",
+        "LINESTRING(-1 0.5,2 0.5)",
+        "LINESTRING(5 0,5 5)",
+        "LINESTRING(5.1 0 1,5.1 5 2)",
+        "POLYGON((0 0,1 0,1 1,0 1,0 0))",
+        "POLYGON((-2 -2,3 -2,3 3,-2 3,-2 -2),(-1 -1,2 -1,2 2,-1 2,-1 -1))",
+        "TRIANGLE((0 0 1,1 0 1,0 1 1,0 0 1))",
+        "MULTIPOINT((7 7),(0.1 0.2))",
+        "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))"
+    };
+    const size_t n = sizeof( wkts ) / sizeof( wkts[0] );
+    const double thresholds[] = { 0.0, 0.1, 0.5, 1.0, 2.0, 10.0 };
+
+    for ( size_t i = 0; i < n; ++i ) {
+        std::unique_ptr< Geometry > ga( io::readWkt( wkts[i] ) );
+
+        for ( size_t j = 0; j < n; ++j ) {
+            std::unique_ptr< Geometry > gb( io::readWkt( wkts[j] ) );
+            BOOST_TEST_MESSAGE( ga->asText() << " / " << gb->asText() );
+
+            const bool hasSolid = ga->geometryTypeId() == TYPE_SOLID || gb->geometryTypeId() == TYPE_SOLID;
+            const double d3 = algorithm::distance3D( *ga, *gb );
+            const double d2 = hasSolid ? 0.0 : algorithm::distance( *ga, *gb );
+
+            for ( size_t k = 0; k < sizeof( thresholds ) / sizeof( thresholds[0] ); ++k ) {
+                BOOST_CHECK_EQUAL( algorithm::dWithin3D( *ga, *gb, thresholds[k] ), d3 <= thresholds[k] );
+
+                if ( ! hasSolid ) {
+                    BOOST_CHECK_EQUAL( algorithm::dWithin( *ga, *gb, thresholds[k] ), d2 <= thresholds[k] );
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testExactCoordinates )
+{
+    // coordinates which are not doubles
+    const Kernel::FT third = Kernel::FT( 1 ) / 3;
+    LineString a( Point( Kernel::FT( 0 ), Kernel::FT( 0 ) ), Point( third, Kernel::FT( 0 ) ) );
+    LineString b( Point( Kernel::FT( 0 ), third ), Point( third, third ) );
+
+    BOOST_CHECK( algorithm::dWithin( a, b, 0.5 ) );
+    BOOST_CHECK( ! algorithm::dWithin( a, b, 0.25 ) );
+    BOOST_CHECK( algorithm::dWithin3D( a, b, 0.5 ) );
+    BOOST_CHECK( ! algorithm::dWithin3D( a, b, 0.25 ) );
+
+    // crossing
+    LineString c( Point( Kernel::FT( 0 ), -third ), Point( third, third ) );
+    BOOST_CHECK( algorithm::dWithin( a, c, 0.0 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testIrrationalDistanceBoundary )
+{
+    // the distance is the square root of a rational which is not a double, rounding
+    // it gives the opposite answer for these thresholds
+    const Point origin( 0.0, 0.0 );
+
+    const Point a( 1.3436424411240122, 8.474337369372327 );
+    BOOST_CHECK( ! algorithm::dWithin( origin, a, 8.58019631823946 ) );
+    BOOST_CHECK( ! algorithm::dWithin3D( origin, a, 8.58019631823946 ) );
+
+    const Point b( 7.6377461897661405, 2.550690257394217 );
+    BOOST_CHECK( algorithm::dWithin( origin, b, 8.052402600991392 ) );
+    BOOST_CHECK( algorithm::dWithin3D( origin, b, 8.052402600991392 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testEmptyOrNegative )
+{
+    std::unique_ptr< Geometry > point( io::readWkt( "POINT(0 0)" ) );
+    std::unique_ptr< Geometry > empty( io::readWkt( "LINESTRING EMPTY" ) );
+
+    BOOST_CHECK( ! algorithm::dWithin( *point, *empty, 1.0 ) );
+    BOOST_CHECK( ! algorithm::dWithin3D( *empty, *point, 1.0 ) );
+    BOOST_CHECK( ! algorithm::dWithin( *point, *point, -1.0 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
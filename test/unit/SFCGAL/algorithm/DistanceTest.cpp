@@ -33,6 +33,7 @@
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/io/wkt.h>
 #include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/distance3d.h>
 
 #include <SFCGAL/detail/tools/Registry.h>
 #include <SFCGAL/detail/tools/Log.h>
@@ -243,5 +244,105 @@ BOOST_AUTO_TEST_CASE( testDistancePolygonSolid )
 }
 
 
+// LineString / LineString with many segments (box hierarchy)
+
+namespace {
+// zigzag between y and y + h, with a step of h
+LineString zigzag( const Kernel::FT& y, const Kernel::FT& h, const Kernel::FT& z = 0, size_t n = 200 )
+{
+    LineString ls;
+
+    for ( size_t i = 0; i < n; i++ ) {
+        ls.addPoint( Point( h * int( i ), y + h * int( i % 2 ), z ) );
+    }
+
+    return ls;
+}
+}
+
+BOOST_AUTO_TEST_CASE( testDistanceLineStringLineString_large )
+{
+    // double coordinates
+    LineString a( zigzag( 0, 1 ) );
+    LineString b( zigzag( 3, 1 ) );
+    BOOST_CHECK_EQUAL( algorithm::distance( a, b ), 2.0 );
+    BOOST_CHECK_EQUAL( algorithm::distanceLineStringLineString( a, b ), 2.0 );
+    BOOST_CHECK_EQUAL( algorithm::distanceLineStringLineString3D( a, b ), 2.0 );
+
+    // rational coordinates
+    const Kernel::FT third = Kernel::FT( 1 ) / 3;
+    LineString c( zigzag( 0, third ) );
+    LineString d( zigzag( 1, third ) );
+    BOOST_CHECK_CLOSE( algorithm::distance( c, d ), 2.0 / 3.0, 1e-9 );
+    BOOST_CHECK_CLOSE( algorithm::distance3D( c, d ), 2.0 / 3.0, 1e-9 );
+
+    // crossing
+    LineString e( Point( third * 10, Kernel::FT( -1 ) ), Point( third * 10, Kernel::FT( 1 ) ) );
+    BOOST_CHECK_EQUAL( algorithm::distance( c, e ), 0.0 );
+    BOOST_CHECK_EQUAL( algorithm::distance3D( c, e ), 0.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testDistanceLineStringPolygon_large )
+{
+    const Kernel::FT third = Kernel::FT( 1 ) / 3;
+
+    // square ring with 4 x 50 segments of 1/3 around [0,50/3]x[0,50/3]
+    LineString ring;
+
+    for ( int i = 0; i < 50; i++ ) {
+        ring.addPoint( Point( third * i, Kernel::FT( 0 ) ) );
+    }
+
+    for ( int i = 0; i < 50; i++ ) {
+        ring.addPoint( Point( third * 50, third * i ) );
+    }
+
+    for ( int i = 50; i > 0; i-- ) {
+        ring.addPoint( Point( third * i, third * 50 ) );
+    }
+
+    for ( int i = 50; i >= 0; i-- ) {
+        ring.addPoint( Point( Kernel::FT( 0 ), third * i ) );
+    }
+
+    Polygon polygon( ring );
+
+    // below the polygon
+    LineString below( zigzag( -2, third ) );
+    BOOST_CHECK_CLOSE( algorithm::distance( below, polygon ), 2.0 - 1.0 / 3.0, 1e-9 );
+    BOOST_CHECK_CLOSE( algorithm::distance3D( below, polygon ), 2.0 - 1.0 / 3.0, 1e-9 );
+
+    // inside the polygon
+    LineString inside( zigzag( 1, third, 0, 40 ) );
+    BOOST_CHECK_EQUAL( algorithm::distance( inside, polygon ), 0.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testDistanceMaxDistance )
+{
+    LineString a( zigzag( 0, 1 ) );
+    LineString b( zigzag( 3, 1 ) );
+
+    // exact distance below the cutoff
+    BOOST_CHECK_EQUAL( algorithm::distance( a, b, 10.0 ), 2.0 );
+    BOOST_CHECK_EQUAL( algorithm::distance( a, b, 2.0 ), 2.0 );
+    BOOST_CHECK_EQUAL( algorithm::distance3D( a, b, 2.0 ), 2.0 );
+    // greater than the cutoff otherwise
+    BOOST_CHECK( algorithm::distance( a, b, 1.5 ) > 1.5 );
+    BOOST_CHECK( algorithm::distance3D( a, b, 0.0 ) > 0.0 );
+
+    // rational coordinates
+    const Kernel::FT third = Kernel::FT( 1 ) / 3;
+    LineString c( zigzag( 0, third, 1 ) );
+    LineString d( zigzag( 1, third, 1 ) );
+    BOOST_CHECK_CLOSE( algorithm::distance( c, d, 1.0 ), 2.0 / 3.0, 1e-9 );
+    BOOST_CHECK( algorithm::distance( c, d, 0.5 ) > 0.5 );
+    BOOST_CHECK( algorithm::distance3D( c, d, 0.5 ) > 0.5 );
+
+    // intersecting or empty geometries
+    BOOST_CHECK_EQUAL( algorithm::distance( c, c, 0.0 ), 0.0 );
+    BOOST_CHECK_EQUAL( algorithm::distance( a, LineString(), 1.0 ), std::numeric_limits< double >::infinity() );
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
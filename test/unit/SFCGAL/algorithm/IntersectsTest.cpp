@@ -111,5 +111,86 @@ BOOST_AUTO_TEST_CASE( testFileIntersectsTest )
     }
 }
 
+BOOST_AUTO_TEST_CASE( testSelfIntersectsLongLineString )
+{
+    // zigzag long enough to use the indexed sweep
+    LineString ring ;
+
+    for ( int i = 0; i < 100; i++ ) {
+        ring.addPoint( Point( double( i ), double( i % 2 ) ) );
+    }
+
+    ring.addPoint( Point( 99.0, -5.0 ) );
+    ring.addPoint( Point( 0.0, -5.0 ) );
+    ring.addPoint( Point( 0.0, 0.0 ) );
+    BOOST_CHECK( ! algorithm::selfIntersects( ring ) );
+
+    // back through the zigzag
+    ring.pointN( 100 ) = Point( 50.0, 5.0 );
+    BOOST_CHECK( algorithm::selfIntersects( ring ) );
+
+    // same with rational coordinates
+    LineString exactRing ;
+
+    for ( int i = 0; i < 100; i++ ) {
+        exactRing.addPoint( Point( Kernel::FT( i ) / 3, Kernel::FT( i % 2 ) / 3 ) );
+    }
+
+    exactRing.addPoint( Point( Kernel::FT( 99 ) / 3, Kernel::FT( -5 ) / 3 ) );
+    exactRing.addPoint( Point( Kernel::FT( 0 ), Kernel::FT( -5 ) / 3 ) );
+    exactRing.addPoint( Point( Kernel::FT( 0 ), Kernel::FT( 0 ) ) );
+    BOOST_CHECK( ! algorithm::selfIntersects( exactRing ) );
+
+    // crossing in the xy plane, above the zigzag
+    LineString line ;
+
+    for ( int i = 0; i < 100; i++ ) {
+        line.addPoint( Point( double( i ), double( i % 2 ), 0.0 ) );
+    }
+
+    line.addPoint( Point( 99.0, -5.0, 10.0 ) );
+    line.addPoint( Point( 50.0, 5.0, 10.0 ) );
+    BOOST_CHECK( algorithm::selfIntersects( line ) );
+    BOOST_CHECK( ! algorithm::selfIntersects3D( line ) );
+
+    // through the zigzag vertex ( 50 0 0 )
+    line.addPoint( Point( 50.0, -5.0, -10.0 ) );
+    BOOST_CHECK( algorithm::selfIntersects3D( line ) );
+}
+
+BOOST_AUTO_TEST_CASE( testRingContact )
+{
+    std::unique_ptr< Geometry > square( io::readWkt( "LINESTRING(0 0,0 2,2 2,2 0,0 0)" ) );
+    const LineString& a = square->as< LineString >() ;
+
+    const char* wkts[] = {
+        "LINESTRING(3 3,3 4,4 4,4 3,3 3)",          // disjoint
+        "LINESTRING(2 2,2 3,3 3,3 2,2 2)",          // corner
+        "LINESTRING(1 2,1 3,3 3,1 2)",              // vertex inside a segment
+        "LINESTRING(1 2,1 3,3 3,3 2,1 2)",          // common segment
+        "LINESTRING(1 1,1 3,3 3,3 1,1 1)",          // crossing
+        "LINESTRING(2 2,2 3,4 3,4 0,2 0,3 1,2 2)"   // two common points
+    };
+    const algorithm::RingContact expected[] = {
+        algorithm::RING_CONTACT_NONE,
+        algorithm::RING_CONTACT_POINT,
+        algorithm::RING_CONTACT_POINT,
+        algorithm::RING_CONTACT_OVERLAP,
+        algorithm::RING_CONTACT_OVERLAP,
+        algorithm::RING_CONTACT_OVERLAP
+    };
+
+    for ( size_t i = 0; i < sizeof( wkts ) / sizeof( wkts[0] ); i++ ) {
+        std::unique_ptr< Geometry > ring( io::readWkt( wkts[i] ) );
+        BOOST_CHECK_EQUAL( algorithm::ringContact( a, ring->as< LineString >() ), expected[i] );
+        BOOST_CHECK_EQUAL( algorithm::ringContact( ring->as< LineString >(), a ), expected[i] );
+    }
+
+    // same in 3D, in the plane z=1
+    std::unique_ptr< Geometry > square3D( io::readWkt( "LINESTRING(0 0 1,0 2 1,2 2 1,2 0 1,0 0 1)" ) );
+    std::unique_ptr< Geometry > corner3D( io::readWkt( "LINESTRING(2 2 1,2 3 1,3 3 1,3 2 1,2 2 1)" ) );
+    BOOST_CHECK_EQUAL( algorithm::ringContact3D( square3D->as< LineString >(), corner3D->as< LineString >() ), algorithm::RING_CONTACT_POINT );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -31,8 +31,11 @@
 #include <SFCGAL/MultiLineString.h>
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/Exception.h>
 #include <SFCGAL/io/wkt.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/extrude.h>
+#include <SFCGAL/algorithm/translate.h>
 #include <SFCGAL/detail/TestGeometry.h>
 
 using namespace boost::unit_test ;
@@ -81,4 +84,133 @@ BOOST_AUTO_TEST_CASE( disconnectedTIN )
     Validity v = algorithm::isValid( *g );
     BOOST_CHECK( !v );
 }
+BOOST_AUTO_TEST_CASE( polygonWithManyHoles )
+{
+    std::unique_ptr< Geometry > exterior( io::readWkt( "POLYGON((0 0,40 0,40 40,0 40,0 0))" ) );
+    Polygon polygon( exterior->as< Polygon >() );
+
+    for ( int i = 0; i < 10; i++ ) {
+        for ( int j = 0; j < 10; j++ ) {
+            const double x = 1.0 + 3.0 * i, y = 1.0 + 3.0 * j;
+            std::vector< Point > points;
+            points.push_back( Point( x, y ) );
+            points.push_back( Point( x, y + 2.0 ) );
+            points.push_back( Point( x + 2.0, y + 2.0 ) );
+            points.push_back( Point( x + 2.0, y ) );
+            points.push_back( Point( x, y ) );
+            polygon.addRing( LineString( points ) );
+        }
+    }
+
+    BOOST_CHECK( algorithm::isValid( polygon ) );
+
+    // hole touching two other holes at one point
+    {
+        std::unique_ptr< Geometry > ring( io::readWkt( "LINESTRING(3 3,3.5 3.5,4 4,3.5 2.5,3 3)" ) );
+        Polygon touching( polygon );
+        touching.addRing( ring->as< LineString >() );
+        BOOST_CHECK( algorithm::isValid( touching ) );
+    }
+
+    // hole overlapping another hole
+    {
+        std::unique_ptr< Geometry > ring( io::readWkt( "LINESTRING(2 2,2 5,5 5,5 2,2 2)" ) );
+        Polygon overlapping( polygon );
+        overlapping.addRing( ring->as< LineString >() );
+        BOOST_CHECK( ! algorithm::isValid( overlapping ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( parallelIsValid )
+{
+    const std::vector< TestGeometry > testGeometry( createTestGeometries() );
+
+    for ( std::size_t t=0; t<testGeometry.size(); t++ ) {
+        std::unique_ptr< Geometry > g;
+
+        try {
+            g = io::readWkt( testGeometry[t].wkt );
+        }
+        catch ( WktParseException& ) {
+            continue;
+        }
+
+        // same answer and reason whatever the number of threads
+        const Validity sequential = algorithm::isValid( *g );
+        const Validity parallel = algorithm::isValid( *g, 1e-9, 4 );
+        BOOST_CHECK_EQUAL( bool( parallel ), bool( sequential ) );
+        BOOST_CHECK_EQUAL( parallel.reason(), sequential.reason() );
+    }
+
+    std::unique_ptr< Geometry > mls( io::readWkt( "MULTILINESTRING((0 0,1 1),(0 0,0 0),(1 1,2 2),(3 3,3 3))" ) );
+    BOOST_CHECK_EQUAL( algorithm::isValid( *mls, 1e-9, 3 ).reason(), "LineString 1 is invalid: no length" );
+    BOOST_CHECK_EQUAL( algorithm::isValid( *mls, 1e-9, 3, algorithm::VALIDITY_REPORT_ALL ).reason(),
+                       "LineString 1 is invalid: no length; LineString 3 is invalid: no length" );
+    BOOST_CHECK_EQUAL( algorithm::isValid( *mls, 1e-9, 1, algorithm::VALIDITY_REPORT_ALL ).reason(),
+                       "LineString 1 is invalid: no length; LineString 3 is invalid: no length" );
+
+    // the faces of an extruded solid share their lazy exact numbers
+    std::unique_ptr< Geometry > square( io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0))" ) );
+    MultiSolid prisms;
+
+    for ( int i = 0; i < 8; i++ ) {
+        std::unique_ptr< Geometry > prism = algorithm::extrude( *square, 0, 0, 1 );
+        algorithm::translate( *prism, 2 * i, 0, 0 );
+        prisms.addGeometry( prism.release() );
+    }
+
+    BOOST_CHECK( algorithm::isValid( prisms, 1e-9, 4 ) );
+    BOOST_CHECK( algorithm::isValid( prisms.geometryN( 0 ), 1e-9, 4 ) );
+}
+BOOST_AUTO_TEST_CASE( validityCache )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0))" ) );
+    Polygon& polygon = g->as< Polygon >();
+
+    algorithm::resetValidityCacheStats();
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY( polygon );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY( polygon );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( polygon );
+    BOOST_CHECK_EQUAL( algorithm::validityCacheStats().hits, 2U );
+    BOOST_CHECK_EQUAL( algorithm::validityCacheStats().misses, 1U );
+
+    // the 3D check of a 2D geometry is cached apart
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( polygon );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( polygon );
+    BOOST_CHECK_EQUAL( algorithm::validityCacheStats().hits, 3U );
+    BOOST_CHECK_EQUAL( algorithm::validityCacheStats().misses, 2U );
+
+    // the exterior ring is made invalid, the polygon has to be checked again
+    polygon.exteriorRing().pointN( 2 ) = Point( 0.0, 0.0 );
+    polygon.exteriorRing().pointN( 3 ) = Point( 0.0, 0.0 );
+    BOOST_CHECK_THROW( SFCGAL_ASSERT_GEOMETRY_VALIDITY( polygon ), GeometryInvalidityException );
+    BOOST_CHECK_EQUAL( algorithm::validityCacheStats().misses, 3U );
+
+    // failures are not cached
+    BOOST_CHECK_THROW( SFCGAL_ASSERT_GEOMETRY_VALIDITY( polygon ), GeometryInvalidityException );
+    BOOST_CHECK_EQUAL( algorithm::validityCacheStats().misses, 4U );
+}
+
+BOOST_AUTO_TEST_CASE( validityCacheChildReferences )
+{
+    // parts modified through references obtained before the check
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0))" ) );
+    LineString& ring = g->as< Polygon >().exteriorRing();
+    Point& p2 = ring.pointN( 2 );
+    Point& p3 = ring.pointN( 3 );
+
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY( *g );
+    p2 = Point( 0.0, 0.0 );
+    p3 = Point( 0.0, 0.0 );
+    BOOST_CHECK_THROW( SFCGAL_ASSERT_GEOMETRY_VALIDITY( *g ), GeometryInvalidityException );
+
+    std::unique_ptr< Geometry > collection( io::readWkt( "GEOMETRYCOLLECTION(LINESTRING(0 0,1 1))" ) );
+    LineString& member = collection->geometryN( 0 ).as< LineString >();
+
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY( *collection );
+    // no length
+    member.pointN( 1 ) = Point( 0.0, 0.0 );
+    BOOST_CHECK_THROW( SFCGAL_ASSERT_GEOMETRY_VALIDITY( *collection ), GeometryInvalidityException );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -33,6 +33,8 @@
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/io/wkt.h>
 #include <SFCGAL/algorithm/tesselate.h>
+#include <SFCGAL/algorithm/extrude.h>
+#include <SFCGAL/detail/generator/building.h>
 
 #include <SFCGAL/detail/tools/Registry.h>
 
@@ -108,6 +110,48 @@ BOOST_AUTO_TEST_CASE( testMultiPolygon )
     BOOST_CHECK_EQUAL( result->asText( 1 ), wktOut );
 }
 
+/*
+ * parallel tesselate gives the same result as the sequential one
+ */
+BOOST_AUTO_TEST_CASE( testParallel )
+{
+    const char* wkts[] = {
+        "POLYGON((0.0 0.0,1.0 0.0,1.0 1.0,0.0 1.0,0.0 0.0))",
+        "MULTIPOLYGON(((0.0 0.0,1.0 0.0,1.0 1.0,0.0 1.0,0.0 0.0)),((2.0 0.0,3.0 0.0,3.0 1.0,2.0 1.0,2.0 0.0),(2.2 0.2,2.8 0.2,2.8 0.8,2.2 0.2)))",
+        "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))",
+        "GEOMETRYCOLLECTION(POINT(1 2),POLYGON((0 0,1 0,1 1,0 1,0 0)),TRIANGLE((0 0,1 0,0 1,0 0)),POLYGON EMPTY,MULTIPOLYGON(((2 0,3 0,3 1,2 1,2 0))))"
+    };
+
+    for ( size_t i = 0; i < sizeof( wkts ) / sizeof( wkts[0] ); i++ ) {
+        std::unique_ptr< Geometry > g( io::readWkt( wkts[i] ) );
+        const std::string expected = algorithm::tesselate( *g )->asText( 1 );
+
+        const size_t threads[] = { 1, 2, 4, 0 };
+
+        for ( size_t j = 0; j < 4; j++ ) {
+            BOOST_TEST_MESSAGE( boost::format( "tesselate(%s,%s)" ) % wkts[i] % threads[j] );
+            BOOST_CHECK_EQUAL( algorithm::tesselate( *g, threads[j] )->asText( 1 ), expected );
+        }
+    }
+}
+
+/*
+ * faces of an extruded polygon or of a building share their lazy exact numbers
+ */
+BOOST_AUTO_TEST_CASE( testParallelSharedNumbers )
+{
+    std::unique_ptr< Geometry > footprint( io::readWkt( "POLYGON((0 0,10 0,10 5,6 5,6 9,0 9,0 0),(1 1,2 1,2 2,1 2,1 1))" ) );
+    std::vector< std::unique_ptr< Geometry > > geometries ;
+    geometries.push_back( algorithm::extrude( *footprint, 0, 0, 3 ) );
+    geometries.push_back( generator::building( *io::readWkt( "POLYGON((0 0,10 0,10 5,6 5,6 9,0 9,0 0))" ), 3, 1 ) );
+
+    for ( size_t i = 0; i < geometries.size(); i++ ) {
+        const std::string expected = algorithm::tesselate( *geometries[i] )->asText( 3 );
+        BOOST_CHECK_EQUAL( algorithm::tesselate( *geometries[i], 4 )->asText( 3 ), expected );
+        BOOST_CHECK_EQUAL( algorithm::tesselate( *geometries[i], 4, triangulate::TRIANGULATION_FAST )->asText( 3 ),
+                           algorithm::tesselate( *geometries[i], 1, triangulate::TRIANGULATION_FAST )->asText( 3 ) );
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END()
 
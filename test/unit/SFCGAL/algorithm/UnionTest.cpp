@@ -18,6 +18,8 @@
  *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
  */
 #include <SFCGAL/Exception.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Polygon.h>
 #include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/algorithm/union.h>
 #include <SFCGAL/algorithm/volume.h>
@@ -32,6 +34,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <sstream>
+
 namespace SFCGAL {
 namespace algorithm {
 void handleLeakTest();
@@ -397,5 +401,115 @@ BOOST_AUTO_TEST_CASE( VolumeVolume )
     }
 }
 
+namespace {
+
+// n x n grid of adjacent unit squares
+std::unique_ptr<GeometryCollection> squareGrid( int n )
+{
+    std::unique_ptr<GeometryCollection> grid( new GeometryCollection() );
+
+    for ( int i = 0; i < n; ++i ) {
+        for ( int j = 0; j < n; ++j ) {
+            std::ostringstream wkt;
+            wkt << "POLYGON((" << i << " " << j << "," << i + 1 << " " << j << ","
+                << i + 1 << " " << j + 1 << "," << i << " " << j + 1 << "," << i << " " << j << "))";
+            grid->addGeometry( io::readWkt( wkt.str() ).release() );
+        }
+    }
+
+    return grid;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE( UnionAll )
+{
+    std::unique_ptr<GeometryCollection> grid( squareGrid( 7 ) );
+
+    std::unique_ptr<Geometry> u = algorithm::unionAll( *grid );
+    BOOST_CHECK( u->geometryTypeId() == TYPE_POLYGON );
+    BOOST_CHECK( algorithm::area( *u ) == 49 );
+
+    // same result with several threads
+    std::unique_ptr<Geometry> parallel = algorithm::unionAll( *grid, 4 );
+    BOOST_CHECK( parallel->geometryTypeId() == TYPE_POLYGON );
+    BOOST_CHECK( algorithm::area( *parallel ) == 49 );
+
+    // overlapping and disjoint members
+    std::unique_ptr<Geometry> mixed = io::readWkt( "GEOMETRYCOLLECTION(POLYGON((0 0,2 0,2 2,0 2,0 0)),POINT(10 10),POLYGON((1 1,3 1,3 3,1 3,1 1)),POINT(1 1),POLYGON EMPTY)" );
+    u = algorithm::unionAll( *mixed );
+    BOOST_CHECK( u->geometryTypeId() == TYPE_GEOMETRYCOLLECTION );
+    BOOST_CHECK_EQUAL( u->numGeometries(), 2U );
+    BOOST_CHECK( algorithm::area( *u ) == 7 );
+}
+
+BOOST_AUTO_TEST_CASE( UnionAllAdjacentMultiPolygon )
+{
+    // the MultiPolygon is not valid (its members share edges), its members are
+    std::unique_ptr<Geometry> squares = io::readWkt( "MULTIPOLYGON(((0 0,1 0,1 1,0 1,0 0)),((1 0,2 0,2 1,1 1,1 0)),((0 1,1 1,1 2,0 2,0 1)))" );
+
+    std::unique_ptr<Geometry> u = algorithm::unionAll( *squares );
+    BOOST_CHECK( u->geometryTypeId() == TYPE_POLYGON );
+    BOOST_CHECK( algorithm::area( *u ) == 3 );
+
+    // same result with several threads
+    u = algorithm::unionAll( *squares, 2 );
+    BOOST_CHECK( u->geometryTypeId() == TYPE_POLYGON );
+    BOOST_CHECK( algorithm::area( *u ) == 3 );
+}
+
+BOOST_AUTO_TEST_CASE( UnionAllSharedNumbers )
+{
+    // translated copies of a square share its lazy exact numbers
+    std::unique_ptr<Geometry> square = io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0))" );
+    GeometryCollection squares;
+
+    for ( int i = 0; i < 16; ++i ) {
+        Polygon p = square->as<Polygon>();
+        algorithm::translate( p, i % 4, i / 4, 0 );
+        squares.addGeometry( p );
+    }
+
+    std::unique_ptr<Geometry> u = algorithm::unionAll( squares, 4 );
+    BOOST_CHECK( u->geometryTypeId() == TYPE_POLYGON );
+    BOOST_CHECK( algorithm::area( *u ) == 16 );
+    BOOST_CHECK_EQUAL( square->asText( 0 ), "POLYGON((0 0,1 0,1 1,0 1,0 0))" );
+}
+
+BOOST_AUTO_TEST_CASE( UnionAllEmpty )
+{
+    std::unique_ptr<Geometry> u = algorithm::unionAll( GeometryCollection() );
+    BOOST_CHECK( u->isEmpty() );
+
+    u = algorithm::unionAll( *io::readWkt( "GEOMETRYCOLLECTION(POINT EMPTY,POLYGON EMPTY)" ) );
+    BOOST_CHECK( u->isEmpty() );
+
+    // a single member
+    u = algorithm::unionAll( *io::readWkt( "MULTIPOINT(0 1,0 1)" ) );
+    BOOST_CHECK( *u == *io::readWkt( "POINT(0 1)" ) );
+}
+
+BOOST_AUTO_TEST_CASE( UnionAll3D )
+{
+    std::unique_ptr<Geometry> cube = io::readWkt(
+                                         "SOLID((((0 0 0, 0 1 0, 1 1 0, 1 0 0, 0 0 0)),\
+             ((0 0 0, 0 0 1, 0 1 1, 0 1 0, 0 0 0)),\
+             ((0 0 0, 1 0 0, 1 0 1, 0 0 1, 0 0 0)),\
+             ((1 1 1, 0 1 1, 0 0 1, 1 0 1, 1 1 1)),\
+             ((1 1 1, 1 0 1, 1 0 0, 1 1 0, 1 1 1)),\
+             ((1 1 1, 1 1 0, 0 1 0, 0 1 1, 1 1 1))))" );
+    GeometryCollection cubes;
+
+    for ( int i = 0; i < 4; ++i ) {
+        Solid s = cube->as<Solid>();
+        algorithm::translate( s, i, 0, 0 );
+        cubes.addGeometry( s );
+    }
+
+    std::unique_ptr<Geometry> u = algorithm::unionAll3D( cubes, 2 );
+    BOOST_CHECK( u->geometryTypeId() == TYPE_SOLID );
+    BOOST_CHECK( algorithm::volume( *u ) == 4 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -18,6 +18,10 @@
  *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
  */
 #include <SFCGAL/capi/sfcgal_c.h>
+
+#include <cstdlib>
+#include <vector>
+
 #include <SFCGAL/Point.h>
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/Polygon.h>
@@ -122,6 +126,277 @@ BOOST_AUTO_TEST_CASE( testApproximateMedialAxis )
     sfcgal_geometry_delete(sk);
 }
 
+BOOST_AUTO_TEST_CASE( testPreparedGeometryPredicates )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    sfcgal_prepared_geometry_t* prepared = sfcgal_prepared_geometry_create_from_geometry(
+            io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0),(2 2,8 2,8 8,2 8,2 2))" ).release(), 0 );
+    std::unique_ptr<Geometry> inHole( io::readWkt( "POINT(5 4)" ) );
+    std::unique_ptr<Geometry> inside( io::readWkt( "LINESTRING(1 1,1 9)" ) );
+
+    hasError = false;
+    BOOST_CHECK_EQUAL( 0, sfcgal_prepared_geometry_intersects( prepared, inHole.get() ) );
+    BOOST_CHECK_EQUAL( 1, sfcgal_prepared_geometry_intersects( prepared, inside.get() ) );
+    BOOST_CHECK_EQUAL( 0, sfcgal_prepared_geometry_intersects_3d( prepared, inHole.get() ) );
+    BOOST_CHECK_EQUAL( 2.0, sfcgal_prepared_geometry_distance( prepared, inHole.get() ) );
+    BOOST_CHECK_EQUAL( 2.0, sfcgal_prepared_geometry_distance_3d( prepared, inHole.get() ) );
+    BOOST_CHECK_EQUAL( 0, sfcgal_prepared_geometry_covers( prepared, inHole.get() ) );
+    BOOST_CHECK_EQUAL( 1, sfcgal_prepared_geometry_covers( prepared, inside.get() ) );
+    BOOST_CHECK( hasError == false );
+
+    sfcgal_prepared_geometry_delete( prepared );
+}
+
+BOOST_AUTO_TEST_CASE( testDWithin )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    std::unique_ptr<Geometry> polygon( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0),(2 2,8 2,8 8,2 8,2 2))" ) );
+    std::unique_ptr<Geometry> inHole( io::readWkt( "POINT(5 4 3)" ) );
+
+    hasError = false;
+    BOOST_CHECK_EQUAL( 1, sfcgal_geometry_dwithin( polygon.get(), inHole.get(), 2.0 ) );
+    BOOST_CHECK_EQUAL( 0, sfcgal_geometry_dwithin( polygon.get(), inHole.get(), 1.5 ) );
+    BOOST_CHECK_EQUAL( 0, sfcgal_geometry_dwithin_3d( polygon.get(), inHole.get(), 2.0 ) );
+    BOOST_CHECK_EQUAL( 1, sfcgal_geometry_dwithin_3d( polygon.get(), inHole.get(), 4.0 ) );
+    BOOST_CHECK( hasError == false );
+}
+
+BOOST_AUTO_TEST_CASE( testBatch )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    // a clone shares the exact numbers of its source, far is used by two items
+    std::unique_ptr<Geometry> square( io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0))" ) );
+    std::unique_ptr<Geometry> square2( square->clone() );
+    std::unique_ptr<Geometry> far( io::readWkt( "POINT(4 1)" ) );
+    std::unique_ptr<Geometry> inside( io::readWkt( "POINT(0.5 0.5)" ) );
+    // self-intersecting, invalid
+    std::unique_ptr<Geometry> invalid( io::readWkt( "POLYGON((0 0,1 1,1 0,0 1,0 0))" ) );
+
+    const sfcgal_geometry_t* a[] = { square.get(), square2.get(), invalid.get() };
+    const sfcgal_geometry_t* b[] = { far.get(), inside.get(), far.get() };
+
+    sfcgal_batch_context_t* context = sfcgal_batch_context_create();
+
+    hasError = false;
+    int intersects[3];
+    BOOST_CHECK_EQUAL( 1U, sfcgal_geometry_intersects_batch( context, a, b, 3, intersects, 2 ) );
+    BOOST_CHECK_EQUAL( 0, intersects[0] );
+    BOOST_CHECK_EQUAL( 1, intersects[1] );
+    BOOST_CHECK_EQUAL( -1, intersects[2] );
+    BOOST_CHECK( sfcgal_batch_context_error( context, 0 ) == 0 );
+    BOOST_CHECK( sfcgal_batch_context_error( context, 2 ) != 0 );
+
+    double distances[3];
+    BOOST_CHECK_EQUAL( 1U, sfcgal_geometry_distance_batch( context, a, b, 3, distances, 0 ) );
+    BOOST_CHECK_EQUAL( 3.0, distances[0] );
+    BOOST_CHECK_EQUAL( 0.0, distances[1] );
+    BOOST_CHECK_EQUAL( -1.0, distances[2] );
+
+    // no validation on this context
+    sfcgal_batch_context_set_geometry_validation( context, 0 );
+    double areas[3];
+    BOOST_CHECK_EQUAL( 0U, sfcgal_geometry_area_batch( context, a, 3, areas, 2 ) );
+    BOOST_CHECK_EQUAL( 1.0, areas[0] );
+
+    sfcgal_geometry_t* unions[2];
+    BOOST_CHECK_EQUAL( 0U, sfcgal_geometry_union_batch( context, a, b, 2, unions, 2 ) );
+    BOOST_CHECK_EQUAL( reinterpret_cast< Geometry* >( unions[1] )->geometryTypeId(), TYPE_POLYGON );
+    sfcgal_geometry_delete( unions[0] );
+    sfcgal_geometry_delete( unions[1] );
+
+    // without context
+    sfcgal_geometry_t* intersections[2];
+    BOOST_CHECK_EQUAL( 0U, sfcgal_geometry_intersection_batch( 0, a, b, 2, intersections, 2 ) );
+    BOOST_CHECK( reinterpret_cast< Geometry* >( intersections[0] )->isEmpty() );
+    BOOST_CHECK_EQUAL( reinterpret_cast< Geometry* >( intersections[1] )->asText( 1 ), "POINT(0.5 0.5)" );
+    sfcgal_geometry_delete( intersections[0] );
+    sfcgal_geometry_delete( intersections[1] );
+
+    // the global error handler is never called
+    BOOST_CHECK( hasError == false );
+    sfcgal_batch_context_delete( context );
+}
+
+BOOST_AUTO_TEST_CASE( testBatchOneAgainstMany )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    // the same polygon in every item, with more items than threads
+    std::unique_ptr<Geometry> polygon( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0),(2 2,8 2,8 8,2 8,2 2))" ) );
+    std::vector< std::unique_ptr<Geometry> > points;
+    std::vector< const sfcgal_geometry_t* > a, b;
+
+    for ( size_t i = 0; i < 200; i++ ) {
+        points.push_back( std::unique_ptr<Geometry>( new Point( double( i % 12 ) + 0.5, 1.0 / 3.0 ) ) );
+        a.push_back( polygon.get() );
+        b.push_back( points.back().get() );
+    }
+
+    hasError = false;
+    std::vector< int > intersects( a.size() );
+    BOOST_CHECK_EQUAL( 0U, sfcgal_geometry_intersects_batch( 0, &a[0], &b[0], a.size(), &intersects[0], 4 ) );
+
+    std::vector< sfcgal_geometry_t* > intersections( a.size() );
+    BOOST_CHECK_EQUAL( 0U, sfcgal_geometry_intersection_batch( 0, &a[0], &b[0], a.size(), &intersections[0], 4 ) );
+
+    for ( size_t i = 0; i < a.size(); i++ ) {
+        BOOST_CHECK_EQUAL( intersects[i], i % 12 < 10 ? 1 : 0 );
+
+        Geometry* intersection = reinterpret_cast< Geometry* >( intersections[i] );
+        BOOST_CHECK_EQUAL( intersection->isEmpty(), i % 12 >= 10 );
+        sfcgal_geometry_delete( intersections[i] );
+    }
+
+    BOOST_CHECK_EQUAL( polygon->asText( 0 ), "POLYGON((0 0,10 0,10 10,0 10,0 0),(2 2,8 2,8 8,2 8,2 2))" );
+    BOOST_CHECK( hasError == false );
+}
+
+BOOST_AUTO_TEST_CASE( testUnionAll )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    std::unique_ptr<Geometry> parcels( io::readWkt( "GEOMETRYCOLLECTION(POLYGON((0 0,1 0,1 1,0 1,0 0)),POLYGON((1 0,2 0,2 1,1 1,1 0)),POLYGON((0 1,1 1,1 2,0 2,0 1)))" ) );
+
+    hasError = false;
+    sfcgal_geometry_t* u = sfcgal_geometry_union_all( parcels.get(), 2 );
+    BOOST_REQUIRE( u != 0 );
+    BOOST_CHECK_EQUAL( reinterpret_cast< Geometry* >( u )->geometryTypeId(), TYPE_POLYGON );
+    BOOST_CHECK_EQUAL( sfcgal_geometry_area( u ), 3.0 );
+    sfcgal_geometry_delete( u );
+
+    u = sfcgal_geometry_union_all_3d( parcels.get(), 0 );
+    BOOST_REQUIRE( u != 0 );
+    sfcgal_geometry_delete( u );
+    BOOST_CHECK( hasError == false );
+
+    // self-intersecting member
+    std::unique_ptr<Geometry> invalid( io::readWkt( "GEOMETRYCOLLECTION(POLYGON((0 0,1 1,1 0,0 1,0 0)))" ) );
+    BOOST_CHECK( sfcgal_geometry_union_all( invalid.get(), 1 ) == 0 );
+    BOOST_CHECK( hasError == true );
+}
+
+BOOST_AUTO_TEST_CASE( testIsValidParallel )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    std::unique_ptr<Geometry> mls( io::readWkt( "MULTILINESTRING((0 0,1 1),(0 0,0 0),(1 1,2 2),(3 3,3 3))" ) );
+    char* reason = 0;
+
+    hasError = false;
+    BOOST_CHECK( ! sfcgal_geometry_is_valid_parallel( mls.get(), 2, 1, &reason ) );
+    BOOST_REQUIRE( reason != 0 );
+    BOOST_CHECK_EQUAL( std::string( reason ), "LineString 1 is invalid: no length; LineString 3 is invalid: no length" );
+    free( reason );
+
+    std::unique_ptr<Geometry> valid( io::readWkt( "MULTIPOLYGON(((0 0,1 0,1 1,0 1,0 0)),((2 0,3 0,3 1,2 1,2 0)))" ) );
+    BOOST_CHECK( sfcgal_geometry_is_valid_parallel( valid.get(), 0, 0, &reason ) );
+    BOOST_CHECK( reason == 0 );
+    BOOST_CHECK( hasError == false );
+}
+
+BOOST_AUTO_TEST_CASE( testFlatGeometry )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    // takes ownership of the geometry
+    sfcgal_prepared_geometry_t* prepared = sfcgal_prepared_geometry_create_from_geometry(
+            io::readWkt( "POLYGON((0 0,1 0,1 1,1/3 1,0 0))" ).release(), 4326 );
+    const std::string wkt = reinterpret_cast< const Geometry* >( sfcgal_prepared_geometry_geometry( prepared ) )->asText();
+
+    hasError = false;
+    char* buffer;
+    size_t len;
+    sfcgal_io_write_flat_prepared( prepared, &buffer, &len );
+
+    // read by the generic binary reader
+    sfcgal_prepared_geometry_t* read = sfcgal_io_read_binary_prepared( buffer, len );
+    BOOST_REQUIRE( read != 0 );
+    BOOST_CHECK_EQUAL( sfcgal_prepared_geometry_srid( read ), 4326U );
+    BOOST_CHECK_EQUAL( reinterpret_cast< const Geometry* >( sfcgal_prepared_geometry_geometry( read ) )->asText(), wkt );
+    sfcgal_prepared_geometry_delete( read );
+
+    read = sfcgal_io_read_flat_prepared( buffer, len );
+    BOOST_REQUIRE( read != 0 );
+    BOOST_CHECK_EQUAL( sfcgal_prepared_geometry_srid( read ), 4326U );
+    sfcgal_prepared_geometry_delete( read );
+    free( buffer );
+
+    sfcgal_io_write_flat_geometry( sfcgal_prepared_geometry_geometry( prepared ), &buffer, &len );
+    sfcgal_geometry_t* g = sfcgal_io_read_flat_geometry( buffer, len );
+    BOOST_REQUIRE( g != 0 );
+    BOOST_CHECK_EQUAL( reinterpret_cast< Geometry* >( g )->asText(), wkt );
+    sfcgal_geometry_delete( g );
+    BOOST_CHECK( hasError == false );
+
+    // truncated
+    BOOST_CHECK( sfcgal_io_read_flat_geometry( buffer, len / 2 ) == 0 );
+    BOOST_CHECK( hasError == true );
+    free( buffer );
+    sfcgal_prepared_geometry_delete( prepared );
+}
+
+BOOST_AUTO_TEST_CASE( testAsTextInto )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    std::unique_ptr< Geometry > g( io::readWkt( "LINESTRING(0 1/3,0.5 2)" ) );
+    char buffer[64];
+    size_t len = 0;
+
+    hasError = false;
+    BOOST_CHECK_EQUAL( sfcgal_geometry_as_text_into( g.get(), buffer, sizeof( buffer ), &len ), 1 );
+    BOOST_CHECK_EQUAL( std::string( buffer ), g->asText() );
+    BOOST_CHECK_EQUAL( len, g->asText().size() );
+
+    BOOST_CHECK_EQUAL( sfcgal_geometry_as_text_decim_into( g.get(), 2, buffer, sizeof( buffer ), &len ), 1 );
+    BOOST_CHECK_EQUAL( std::string( buffer ), "LINESTRING(0.00 0.33,0.50 2.00)" );
+
+    // too small, the required length is returned
+    BOOST_CHECK_EQUAL( sfcgal_geometry_as_text_decim_into( g.get(), 2, buffer, 10, &len ), 0 );
+    BOOST_CHECK_EQUAL( len, 31U );
+    BOOST_CHECK( hasError == false );
+}
+
+BOOST_AUTO_TEST_CASE( testLocatePoints3D )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    sfcgal_prepared_geometry_t* prepared = sfcgal_prepared_geometry_create_from_geometry( io::readWkt( "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" ).release(), 0 );
+
+    const double coordinates[] = { 0.5, 0.5, 0.5, 0.5, 0.5, 1.0, 2.0, 0.5, 0.5 };
+    int sides[3] = { 2, 2, 2 };
+
+    hasError = false;
+    BOOST_CHECK_EQUAL( sfcgal_prepared_geometry_locate_points_3d( prepared, coordinates, 3, sides, 0 ), 1 );
+    BOOST_CHECK_EQUAL( sides[0], 1 );
+    BOOST_CHECK_EQUAL( sides[1], 0 );
+    BOOST_CHECK_EQUAL( sides[2], -1 );
+    BOOST_CHECK( hasError == false );
+
+    sfcgal_prepared_geometry_delete( prepared );
+}
+
+BOOST_AUTO_TEST_CASE( testTesselateParallel )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    std::unique_ptr< Geometry > g( io::readWkt( "MULTIPOLYGON(((0 0,1 0,1 1,0 1,0 0)),((2 0,3 0,3 1,2 1,2 0)))" ) );
+
+    hasError = false;
+    std::unique_ptr< Geometry > expected( ( Geometry* )sfcgal_geometry_tesselate( g.get() ) );
+    std::unique_ptr< Geometry > result( ( Geometry* )sfcgal_geometry_tesselate_parallel( g.get(), 2 ) );
+    BOOST_REQUIRE( result.get() != 0 );
+    BOOST_CHECK_EQUAL( result->asText(), expected->asText() );
+
+    result.reset( ( Geometry* )sfcgal_geometry_tesselate_parallel( g.get(), 0 ) );
+    BOOST_REQUIRE( result.get() != 0 );
+    BOOST_CHECK_EQUAL( result->asText(), expected->asText() );
+    BOOST_CHECK( hasError == false );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -0,0 +1,132 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/area.h>
+#include <SFCGAL/detail/ApproximateLineString.h>
+#include <SFCGAL/detail/CompensatedSum.h>
+
+using namespace SFCGAL ;
+using namespace SFCGAL::detail ;
+
+// always after CGAL
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_ApproximateLineStringTest )
+
+BOOST_AUTO_TEST_CASE( testCompensatedSum )
+{
+    CompensatedSum sum ;
+    BOOST_CHECK_EQUAL( sum.value(), 0.0 );
+    BOOST_CHECK_EQUAL( sum.errorBound(), 0.0 );
+
+    // 1 is lost by a naive sum
+    sum.add( 1.0e16 );
+    sum.add( 1.0 );
+    sum.add( -1.0e16 );
+    BOOST_CHECK_EQUAL( sum.value(), 1.0 );
+    BOOST_CHECK( sum.errorBound() < 1.0e-14 );
+
+    // (1+e)(1-e) - 1 = -e^2 is lost by a naive evaluation
+    const double e = std::ldexp( 1.0, -30 ) ;
+    CompensatedSum dot ;
+    dot.addProduct( 1.0 + e, 1.0 - e );
+    dot.add( -1.0 );
+    BOOST_CHECK_EQUAL( dot.value(), - e * e );
+    BOOST_CHECK( dot.errorBound() < 1.0e-30 );
+
+    // underflows are not handled
+    CompensatedSum tiny ;
+    tiny.addProduct( 1.0e-200, 1.0e-200 );
+    BOOST_CHECK( std::isinf( tiny.errorBound() ) );
+}
+
+BOOST_AUTO_TEST_CASE( testSignedArea )
+{
+    ApproximateLineString ring ;
+    double area, bound ;
+
+    // coordinates are doubles
+    std::unique_ptr< Geometry > square( io::readWkt( "LINESTRING(0 0,1 0,1 1,0 1,0 0)" ) );
+    BOOST_REQUIRE( ring.assign( square->as< LineString >(), 2 ) );
+    BOOST_REQUIRE( ring.signedArea( 0, 1, area, bound ) );
+    BOOST_CHECK_EQUAL( area, 1.0 );
+    BOOST_CHECK( bound <= MEASURE_RELATIVE_ERROR );
+
+    // 0.1 is rounded
+    std::unique_ptr< Geometry > decimal( io::readWkt( "LINESTRING(0.3 0.1,0.1 0.1,0.1 0.3,0.3 0.1)" ) );
+    const double exact = CGAL::to_double( algorithm::signedArea( decimal->as< LineString >() ) ) ;
+    BOOST_REQUIRE( ring.assign( decimal->as< LineString >(), 2 ) );
+    BOOST_REQUIRE( ring.signedArea( 0, 1, area, bound ) );
+    BOOST_CHECK( bound > 0.0 );
+    BOOST_CHECK( bound <= MEASURE_RELATIVE_ERROR * std::abs( area ) );
+    BOOST_CHECK( std::abs( area - exact ) <= bound );
+
+    // projections of a vertical triangle
+    std::unique_ptr< Geometry > triangle( io::readWkt( "TRIANGLE((0 0 0,2 0 0,0 0 3,0 0 0))" ) );
+    BOOST_REQUIRE( ring.assign( triangle->as< Triangle >(), 3 ) );
+    BOOST_REQUIRE( ring.signedArea( 2, 0, area, bound ) );
+    BOOST_CHECK_EQUAL( area, -3.0 );
+    BOOST_REQUIRE( ring.signedArea( 0, 1, area, bound ) );
+    BOOST_CHECK_EQUAL( area, 0.0 );
+    BOOST_CHECK_EQUAL( bound, 0.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testLength )
+{
+    ApproximateLineString ls ;
+    double length, bound ;
+
+    std::unique_ptr< Geometry > g( io::readWkt( "LINESTRING(0 0 0,3 4 0,3 4 2)" ) );
+    BOOST_REQUIRE( ls.assign( g->as< LineString >(), 2 ) );
+    BOOST_REQUIRE( ls.length( 2, length, bound ) );
+    BOOST_CHECK_EQUAL( length, 5.0 );
+    BOOST_REQUIRE( ls.assign( g->as< LineString >(), 3 ) );
+    BOOST_REQUIRE( ls.length( 3, length, bound ) );
+    BOOST_CHECK_EQUAL( length, 7.0 );
+    BOOST_CHECK( bound <= MEASURE_RELATIVE_ERROR * length );
+
+    BOOST_REQUIRE( ls.assign( LineString(), 2 ) );
+    BOOST_REQUIRE( ls.length( 2, length, bound ) );
+    BOOST_CHECK_EQUAL( length, 0.0 );
+    BOOST_CHECK_EQUAL( bound, 0.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testBoundNotMet )
+{
+    // a small square far from the origin, the rounding of the coordinates
+    // is too large compared to the area
+    std::unique_ptr< Geometry > g( io::readWkt( "LINESTRING(1000000000.1 0,1000000000.2 0,1000000000.2 0.1,1000000000.1 0.1,1000000000.1 0)" ) );
+    ApproximateLineString ring ;
+    double area, bound ;
+    BOOST_REQUIRE( ring.assign( g->as< LineString >(), 2 ) );
+    BOOST_REQUIRE( ring.signedArea( 0, 1, area, bound ) );
+    BOOST_CHECK( bound > MEASURE_RELATIVE_ERROR * std::abs( area ) );
+    BOOST_CHECK( std::abs( area - 0.01 ) <= bound );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <SFCGAL/detail/GeometrySet.h>
+
+using namespace SFCGAL ;
+using namespace SFCGAL::detail ;
+
+// always after CGAL
+using namespace boost::unit_test ;
+
+namespace {
+//
+// collects the reported pairs, stops after a given number of pairs
+struct collect_cb {
+    collect_cb( std::vector< std::pair<size_t, size_t> >& pairs, size_t stopAfter ) :
+        _pairs( pairs ),
+        _stopAfter( stopAfter ) {
+    }
+
+    bool operator()( const IndexedBox<2>& a, const IndexedBox<2>& b ) const {
+        _pairs.push_back( std::make_pair( a.index(), b.index() ) );
+        return _pairs.size() == _stopAfter;
+    }
+
+    std::vector< std::pair<size_t, size_t> >& _pairs;
+    size_t _stopAfter;
+};
+
+// a row of unit boxes, each one touching the next one
+std::vector< IndexedBox<2> > row( size_t n, double y )
+{
+    std::vector< IndexedBox<2> > boxes;
+
+    for ( size_t i = 0; i != n; ++i ) {
+        boxes.push_back( IndexedBox<2>( CGAL::Bbox_2( i, y, i + 1, y + 1 ), i ) );
+    }
+
+    return boxes;
+}
+}
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_BoxIntersectionTest )
+
+BOOST_AUTO_TEST_CASE( testBoxIntersectionUntil )
+{
+    std::vector< IndexedBox<2> > a = row( 4, 0.0 );
+    std::vector< IndexedBox<2> > b = row( 4, 1.0 ); // touching a along y
+    std::vector< IndexedBox<2> > c = row( 4, 3.0 ); // disjoint from a
+
+    std::vector< std::pair<size_t, size_t> > pairs;
+    BOOST_CHECK( ! box_intersection_until( a.begin(), a.end(), b.begin(), b.end(), collect_cb( pairs, 0 ) ) );
+    // closed boxes : each box touches 3 boxes, but at the ends of the row
+    BOOST_CHECK_EQUAL( pairs.size(), 10U );
+    BOOST_CHECK_EQUAL( std::set< std::pair<size_t, size_t> >( pairs.begin(), pairs.end() ).size(), pairs.size() );
+
+    pairs.clear();
+    BOOST_CHECK( box_intersection_until( a.begin(), a.end(), b.begin(), b.end(), collect_cb( pairs, 2 ) ) );
+    BOOST_CHECK_EQUAL( pairs.size(), 2U );
+
+    pairs.clear();
+    BOOST_CHECK( ! box_intersection_until( a.begin(), a.end(), c.begin(), c.end(), collect_cb( pairs, 0 ) ) );
+    BOOST_CHECK( pairs.empty() );
+}
+
+BOOST_AUTO_TEST_CASE( testBoxSelfIntersectionUntil )
+{
+    std::vector< IndexedBox<2> > a = row( 5, 0.0 );
+
+    std::vector< std::pair<size_t, size_t> > pairs;
+    BOOST_CHECK( ! box_self_intersection_until( a.begin(), a.end(), collect_cb( pairs, 0 ) ) );
+    BOOST_REQUIRE_EQUAL( pairs.size(), 4U );
+
+    for ( size_t i = 0; i != pairs.size(); ++i ) {
+        BOOST_CHECK_EQUAL( std::max( pairs[i].first, pairs[i].second ),
+                           std::min( pairs[i].first, pairs[i].second ) + 1 );
+    }
+
+    pairs.clear();
+    BOOST_CHECK( box_self_intersection_until( a.begin(), a.end(), collect_cb( pairs, 1 ) ) );
+    BOOST_CHECK_EQUAL( pairs.size(), 1U );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
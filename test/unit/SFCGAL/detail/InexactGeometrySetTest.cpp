@@ -0,0 +1,153 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/distance3d.h>
+#include <SFCGAL/algorithm/dWithin.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/InexactGeometrySet.h>
+
+using namespace SFCGAL ;
+using namespace SFCGAL::detail ;
+
+// always after CGAL
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_InexactGeometrySetTest )
+
+BOOST_AUTO_TEST_CASE( testToExactDouble )
+{
+    double d = 0.0;
+    BOOST_CHECK( toExactDouble( Kernel::FT( 0.5 ), d ) );
+    BOOST_CHECK_EQUAL( d, 0.5 );
+    BOOST_CHECK( ! toExactDouble( Kernel::FT( 1 ) / 3, d ) );
+}
+
+BOOST_AUTO_TEST_CASE( testBuild )
+{
+    InexactGeometrySet<2> gs2;
+    BOOST_CHECK( gs2.build( *io::readWkt( "GEOMETRYCOLLECTION(POINT(0 0),LINESTRING(0 0,1 1,1 1,2 0),POLYGON((0 0,1 0,1 1,0 0)))" ) ) );
+    BOOST_CHECK_EQUAL( gs2.points().size(), 1U );
+    BOOST_CHECK_EQUAL( gs2.segments().size(), 2U );
+    BOOST_CHECK_EQUAL( gs2.surfaces().size(), 1U );
+
+    // 0.1 is not a double
+    BOOST_CHECK( ! gs2.build( *io::readWkt( "LINESTRING(0 0,0.1 1)" ) ) );
+    BOOST_CHECK( gs2.isEmpty() );
+
+    // volumes are not handled
+    InexactGeometrySet<3> gs3;
+    BOOST_CHECK( ! gs3.build( *io::readWkt( "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" ) ) );
+}
+
+BOOST_AUTO_TEST_CASE( testSameResultAsExact )
+{
+    const char* wkts[] = {
+        "POINT(0.5 0.5)",
+        "POINT(3 3)",
+        "LINESTRING(-1 0.5,2 0.5)",
+        "LINESTRING(5 0,5 5)",
+        "POLYGON((0 0,1 0,1 1,0 1,0 0))",
+        "POLYGON((-2 -2,3 -2,3 3,-2 3,-2 -2),(-1 -1,2 -1,2 2,-1 2,-1 -1))",
+        "TRIANGLE((0 0 1,1 0 1,0 1 1,0 0 1))"
+    };
+    const size_t n = sizeof( wkts ) / sizeof( wkts[0] );
+
+    for ( size_t i = 0; i < n; ++i ) {
+        std::unique_ptr< Geometry > ga( io::readWkt( wkts[i] ) );
+
+        for ( size_t j = 0; j < n; ++j ) {
+            std::unique_ptr< Geometry > gb( io::readWkt( wkts[j] ) );
+            BOOST_TEST_MESSAGE( ga->asText() << " / " << gb->asText() );
+
+            BOOST_CHECK_EQUAL( algorithm::intersects( *ga, *gb ),
+                               algorithm::intersects( GeometrySet<2>( *ga ), GeometrySet<2>( *gb ) ) );
+            BOOST_CHECK_EQUAL( algorithm::intersects3D( *ga, *gb ),
+                               algorithm::intersects( GeometrySet<3>( *ga ), GeometrySet<3>( *gb ) ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testDistance )
+{
+    InexactGeometrySet<2> a, b;
+    BOOST_REQUIRE( a.build( *io::readWkt( "POLYGON((0 0,4 0,4 4,0 4,0 0),(1 1,3 1,3 3,1 3,1 1))" ) ) );
+
+    // inside the hole
+    BOOST_REQUIRE( b.build( *io::readWkt( "POINT(2 2.5)" ) ) );
+    BOOST_CHECK_EQUAL( algorithm::distance( a, b ), 0.5 );
+
+    // inside the polygon
+    BOOST_REQUIRE( b.build( *io::readWkt( "POINT(0.5 0.5)" ) ) );
+    BOOST_CHECK_EQUAL( algorithm::distance( a, b ), 0.0 );
+
+    // empty
+    BOOST_REQUIRE( b.build( *io::readWkt( "POINT EMPTY" ) ) );
+    BOOST_CHECK( std::isinf( algorithm::distance( a, b ) ) );
+
+    InexactGeometrySet<3> c, d;
+    BOOST_REQUIRE( c.build( *io::readWkt( "TRIANGLE((0 0 0,1 0 0,0 1 0,0 0 0))" ) ) );
+    BOOST_REQUIRE( d.build( *io::readWkt( "LINESTRING(0 0 2,0 0 3)" ) ) );
+    BOOST_CHECK_EQUAL( algorithm::distance( c, d ), 2.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testDWithin )
+{
+    InexactGeometrySet<2> a, b;
+    BOOST_REQUIRE( a.build( *io::readWkt( "POINT(0 0)" ) ) );
+    BOOST_REQUIRE( b.build( *io::readWkt( "POINT(3 4)" ) ) );
+
+    BOOST_CHECK( algorithm::dWithin( a, b, 6.0 ) == true );
+    BOOST_CHECK( algorithm::dWithin( a, b, 4.0 ) == false );
+
+    // too close to the threshold for doubles, decided with exact arithmetic
+    BOOST_CHECK( boost::indeterminate( algorithm::dWithin( a, b, 5.0 ) ) );
+    BOOST_CHECK( algorithm::dWithin( *io::readWkt( "POINT(0 0)" ), *io::readWkt( "POINT(3 4)" ), 5.0 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testSelfIntersectsFallback )
+{
+    // same rings with double and rational coordinates
+    std::unique_ptr< Geometry > inexact( io::readWkt( "LINESTRING(0 0,1 1,1 0,0 1,0 0)" ) );
+    std::unique_ptr< Geometry > exact( io::readWkt( "LINESTRING(0 0,1.1 1.1,1.1 0,0 1.1,0 0)" ) );
+    BOOST_CHECK( algorithm::selfIntersects( inexact->as< LineString >() ) );
+    BOOST_CHECK( algorithm::selfIntersects( exact->as< LineString >() ) );
+
+    std::unique_ptr< Geometry > closed( io::readWkt( "LINESTRING(0 0,1 0,1 1,0 1,0 0)" ) );
+    BOOST_CHECK( ! algorithm::selfIntersects( closed->as< LineString >() ) );
+    BOOST_CHECK( ! algorithm::selfIntersects3D( closed->as< LineString >() ) );
+
+    // consecutive collinear segments going back
+    std::unique_ptr< Geometry > back( io::readWkt( "LINESTRING(0 0,2 0,1 0)" ) );
+    BOOST_CHECK( algorithm::selfIntersects( back->as< LineString >() ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
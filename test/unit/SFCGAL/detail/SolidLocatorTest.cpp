@@ -0,0 +1,137 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/SolidLocator.h>
+
+using namespace SFCGAL ;
+using namespace SFCGAL::detail ;
+
+// always after CGAL
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_SolidLocatorTest )
+
+namespace {
+// cube [x,x+size]^3, with an optional interior cube [x+1,x+size-1]^3
+std::string cube( int x, int size, bool hole = false )
+{
+    std::ostringstream oss;
+    const int a = x, b = x + size;
+    oss << "(((" << a << " " << a << " " << a << "," << a << " " << b << " " << a << "," << b << " " << b << " " << a << "," << b << " " << a << " " << a << "," << a << " " << a << " " << a << ")),"
+        << "((" << a << " " << a << " " << a << "," << a << " " << a << " " << b << "," << a << " " << b << " " << b << "," << a << " " << b << " " << a << "," << a << " " << a << " " << a << ")),"
+        << "((" << a << " " << a << " " << a << "," << b << " " << a << " " << a << "," << b << " " << a << " " << b << "," << a << " " << a << " " << b << "," << a << " " << a << " " << a << ")),"
+        << "((" << b << " " << b << " " << b << "," << a << " " << b << " " << b << "," << a << " " << a << " " << b << "," << b << " " << a << " " << b << "," << b << " " << b << " " << b << ")),"
+        << "((" << b << " " << b << " " << b << "," << b << " " << a << " " << b << "," << b << " " << a << " " << a << "," << b << " " << b << " " << a << "," << b << " " << b << " " << b << ")),"
+        << "((" << b << " " << b << " " << b << "," << b << " " << b << " " << a << "," << a << " " << b << " " << a << "," << a << " " << b << " " << b << "," << b << " " << b << " " << b << ")))";
+
+    if ( hole ) {
+        oss << "," << cube( x + 1, size - 2 );
+    }
+
+    return oss.str();
+}
+}
+
+BOOST_AUTO_TEST_CASE( testLocate )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "SOLID(" + cube( 0, 1 ) + ")" ) );
+    SolidLocator locator( *g );
+    BOOST_CHECK( ! locator.isEmpty() );
+
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 0.5, 0.5, 0.5 ) ), CGAL::ON_BOUNDED_SIDE );
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 0.5, 0.5, 1.0 ) ), CGAL::ON_BOUNDARY );
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 1.0, 1.0, 1.0 ) ), CGAL::ON_BOUNDARY );
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 0.5, 0.5, 3.0 ) ), CGAL::ON_UNBOUNDED_SIDE );
+    BOOST_CHECK_EQUAL( locator.locate( Point( 0.25, 0.75, 0.5 ) ), CGAL::ON_BOUNDED_SIDE );
+}
+
+BOOST_AUTO_TEST_CASE( testInteriorShell )
+{
+    // interior shells are not handled by isValid
+    std::unique_ptr< Geometry > g( io::readWkt( "SOLID(" + cube( 0, 4, true ) + ")" ) );
+    SolidLocator locator( *g, algorithm::NoValidityCheck() );
+
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 0.5, 0.5, 0.5 ) ), CGAL::ON_BOUNDED_SIDE );
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 1.0, 2.0, 2.0 ) ), CGAL::ON_BOUNDARY );
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 2.0, 2.0, 2.0 ) ), CGAL::ON_UNBOUNDED_SIDE );
+}
+
+BOOST_AUTO_TEST_CASE( testMultiSolid )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "GEOMETRYCOLLECTION(POINT(10 10 10),MULTISOLID(" + cube( 0, 1 ) + "," + cube( 1, 1 ) + "),SOLID(" + cube( 5, 2 ) + "))" ) );
+    SolidLocator locator( *g );
+
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 10, 10, 10 ) ), CGAL::ON_UNBOUNDED_SIDE );
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 1.5, 1.5, 1.5 ) ), CGAL::ON_BOUNDED_SIDE );
+    // shared corner
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 1, 1, 1 ) ), CGAL::ON_BOUNDARY );
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 6, 6, 6 ) ), CGAL::ON_BOUNDED_SIDE );
+    BOOST_CHECK_EQUAL( locator.locate( Kernel::Point_3( 3, 3, 3 ) ), CGAL::ON_UNBOUNDED_SIDE );
+
+    std::unique_ptr< Geometry > empty( io::readWkt( "MULTIPOINT((0 0 0))" ) );
+    SolidLocator emptyLocator( *empty );
+    BOOST_CHECK( emptyLocator.isEmpty() );
+    BOOST_CHECK_EQUAL( emptyLocator.locate( Kernel::Point_3( 0, 0, 0 ) ), CGAL::ON_UNBOUNDED_SIDE );
+}
+
+BOOST_AUTO_TEST_CASE( testLocateRange )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "SOLID(" + cube( 0, 10 ) + ")" ) );
+    SolidLocator locator( *g );
+
+    std::vector< Kernel::Point_3 > points;
+
+    for ( int i = 0; i < 2000; i++ ) {
+        points.push_back( Kernel::Point_3( double( i % 13 ) - 1.0, double( i % 7 ) * 2.0, double( i % 11 ) + 0.5 ) );
+    }
+
+    std::vector< CGAL::Bounded_side > expected;
+
+    for ( size_t i = 0; i < points.size(); i++ ) {
+        expected.push_back( locator.locate( points[i] ) );
+    }
+
+    // the same number of threads twice reuses the pool and the copies of the shells
+    const size_t threads[] = { 1, 2, 2, 4, 0 };
+
+    for ( size_t t = 0; t < 5; t++ ) {
+        std::vector< CGAL::Bounded_side > sides;
+        locator.locate( points.begin(), points.end(), std::back_inserter( sides ), threads[t] );
+        BOOST_CHECK( sides == expected );
+    }
+
+    // the shells of the locator are left unchanged by the parallel queries
+    for ( size_t i = 0; i < points.size(); i++ ) {
+        BOOST_CHECK_EQUAL( locator.locate( points[i] ), expected[i] );
+    }
+
+    std::vector< Point > sfcgalPoints( 1, Point( 5.0, 5.0, 5.0 ) );
+    CGAL::Bounded_side side = CGAL::ON_UNBOUNDED_SIDE;
+    locator.locate( sfcgalPoints.begin(), sfcgalPoints.end(), &side );
+    BOOST_CHECK_EQUAL( side, CGAL::ON_BOUNDED_SIDE );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,90 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <SFCGAL/detail/tools/ThreadPool.h>
+
+using namespace SFCGAL ;
+
+// always after CGAL
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_tools_ThreadPoolTest )
+
+BOOST_AUTO_TEST_CASE( testParallelFor )
+{
+    tools::ThreadPool pool( 4 );
+    BOOST_CHECK_EQUAL( pool.size(), 4U );
+
+    // each index once, several times with the same pool
+    for ( size_t n = 0; n < 100; n += 7 ) {
+        std::vector< int > counts( n, 0 );
+        pool.parallelFor( n, [&]( size_t i ) {
+            ++counts[i];
+        } );
+
+        for ( size_t i = 0; i < n; ++i ) {
+            BOOST_CHECK_EQUAL( counts[i], 1 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testUnbalanced )
+{
+    tools::ThreadPool pool( 3 );
+
+    // the last indices are much longer, they are stolen by the other threads
+    std::atomic< size_t > sum( 0 );
+    pool.parallelFor( 300, [&]( size_t i ) {
+        size_t s = 0;
+
+        for ( size_t k = 0; k < ( i > 200 ? 100000 : 10 ); ++k ) {
+            s += k % 3;
+        }
+
+        sum += ( s > 0 ? i : 0 );
+    } );
+
+    BOOST_CHECK_EQUAL( sum, 299U * 300U / 2U );
+}
+
+BOOST_AUTO_TEST_CASE( testException )
+{
+    tools::ThreadPool pool( 2 );
+    std::atomic< size_t > done( 0 );
+
+    BOOST_CHECK_THROW( pool.parallelFor( 10, [&]( size_t i ) {
+        if ( i == 5 ) {
+            throw std::runtime_error( "item 5" );
+        }
+
+        ++done;
+    } ), std::runtime_error );
+
+    // other items are still processed
+    BOOST_CHECK_EQUAL( done, 9U );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
@@ -0,0 +1,108 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/detail/graph/CompactGeometryGraph.h>
+#include <SFCGAL/detail/graph/CompactGeometryGraphBuilder.h>
+
+using namespace boost::unit_test ;
+
+using namespace SFCGAL ;
+using namespace SFCGAL::graph ;
+
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_CompactGeometryGraphTest )
+
+BOOST_AUTO_TEST_CASE( addPoint )
+{
+    typedef CompactGeometryGraph::vertex_descriptor vertex_descriptor ;
+    CompactGeometryGraph        graph;
+    CompactGeometryGraphBuilder graphBuilder( graph, 4 );
+
+    vertex_descriptor a = graphBuilder.addPoint( Point( 0.0,0.0,0.0 ) );
+    vertex_descriptor b = graphBuilder.addPoint( Point( 1.0,1.0,1.0 ) );
+    vertex_descriptor c = graphBuilder.addPoint( Point( 2.0,2.0,2.0 ) );
+
+    //b duplicate, with another representation
+    vertex_descriptor d = graphBuilder.addPoint( Point( Kernel::FT( 1 ), Kernel::FT( 3 ) / 3, Kernel::FT( 1 ) ) );
+
+    BOOST_CHECK_EQUAL( graph.numVertices(), 3U );
+    BOOST_CHECK_EQUAL( graph.numEdges(), 0U );
+    BOOST_CHECK_EQUAL( b, d );
+
+    BOOST_CHECK( graph[ a ].coordinate == Coordinate( 0.0,0.0,0.0 ) );
+    BOOST_CHECK( graph[ b ].coordinate == Coordinate( 1.0,1.0,1.0 ) );
+    BOOST_CHECK( graph[ c ].coordinate == Coordinate( 2.0,2.0,2.0 ) );
+}
+
+BOOST_AUTO_TEST_CASE( adjacency )
+{
+    typedef CompactGeometryGraph::edge_descriptor edge_descriptor ;
+    CompactGeometryGraph        graph;
+    CompactGeometryGraphBuilder graphBuilder( graph );
+
+    std::vector< Point > points ;
+    points.push_back( Point( 0.0,0.0,0.0 ) );
+    points.push_back( Point( 1.0,0.0,0.0 ) );
+    points.push_back( Point( 1.0,1.0,0.0 ) );
+    points.push_back( Point( 0.0,1.0,0.0 ) );
+    points.push_back( Point( 0.0,0.0,0.0 ) );
+
+    edge_descriptor first = graphBuilder.addLineString( LineString( points ) );
+    BOOST_CHECK_EQUAL( first, 0U );
+    // shared with the square, reversed
+    first = graphBuilder.addLineSegment( Point( 1.0,0.0,0.0 ), Point( 0.0,0.0,0.0 ) );
+    BOOST_CHECK_EQUAL( first, 4U );
+
+    BOOST_CHECK_EQUAL( graph.numVertices(), 4U );
+    BOOST_CHECK_EQUAL( graph.numEdges(), 5U );
+    BOOST_CHECK( ! graph.hasAdjacency() );
+
+    graph.buildAdjacency();
+    BOOST_REQUIRE( graph.hasAdjacency() );
+
+    //check closed
+    for ( edge_descriptor i = 0; i < 4; i++ ) {
+        BOOST_CHECK_EQUAL( graph.target( i ), graph.source( ( i + 1 ) % 4 ) );
+    }
+
+    BOOST_CHECK_EQUAL( graph.degree( 0 ), 3U );
+    BOOST_CHECK_EQUAL( graph.degree( 2 ), 2U );
+
+    std::vector< CompactGeometryGraph::directed_edge_descriptor > edges = graph.edges( 0, 1 );
+    BOOST_REQUIRE_EQUAL( edges.size(), 2U );
+    BOOST_CHECK_EQUAL( edges[0].first, 0U );
+    BOOST_CHECK_EQUAL( edges[0].second, DIRECT );
+    BOOST_CHECK_EQUAL( edges[1].first, 4U );
+    BOOST_CHECK_EQUAL( edges[1].second, REVERSE );
+    BOOST_CHECK_EQUAL( graph.numEdges( 1, 0 ), 2U );
+    BOOST_CHECK_EQUAL( graph.numEdges( 0, 2 ), 0U );
+    BOOST_CHECK( graph.areOpposite( 0, 4 ) );
+
+    CompactGeometryGraph::adjacent_edge_iterator it, end ;
+    boost::tie( it, end ) = graph.outEdges( 1 );
+    BOOST_REQUIRE_EQUAL( end - it, 2 );
+    BOOST_CHECK_EQUAL( *it, 1U );
+    BOOST_CHECK_EQUAL( *( it + 1 ), 4U );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
@@ -0,0 +1,158 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <memory>
+#include <string>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/detail/io/FlatGeometry.h>
+#include <SFCGAL/io/wkt.h>
+
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test ;
+
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_io_FlatGeometryTest )
+
+BOOST_AUTO_TEST_CASE( roundTrip )
+{
+    const char* wkts[] = {
+        "POINT EMPTY",
+        "POINT(3.4 4.5 5.6)",
+        "POINT M(1 2 3)",
+        "LINESTRING EMPTY",
+        "LINESTRING(3.4 4.5 5.6,5 6 8)",
+        "LINESTRING ZM(0 0 1 2,1 1 2 3)",
+        "LINESTRING(1/3 2/3,-7/11 4)",
+        "TRIANGLE((0 0 0,3.4 5.6 6.7,2 3 4,0 0 0))",
+        "POLYGON EMPTY",
+        "POLYGON((0 0,4 0,4 4,0 4,0 0),(1 1,1 2,2 2,2 1,1 1))",
+        "TIN(((0 0 0,3.4 5.6 6.7,2 3 4,0 0 0)),((0 0 0,0 1 0,1 1 0,0 0 0)))",
+        "POLYHEDRALSURFACE(((0 0 0,3.4 5.6 6.7,2 3 4,0 0 0)),((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)))",
+        "SOLID((((0 0 0,3.4 5.6 6.7,2 3 4,0 0 0)),((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0))))",
+        "MULTIPOINT((3.4 4.5 5.6))",
+        "MULTILINESTRING((3.4 4.5 5.6,5 6 8))",
+        "MULTIPOLYGON(((0 0 0,1 1 1,3.4 5.6 6.7,2 3 4,0 0 0)))",
+        "MULTISOLID(((((0 0 0,3.4 5.6 6.7,2 3 4,0 0 0)),((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)))))",
+        "GEOMETRYCOLLECTION(POINT(1 2),GEOMETRYCOLLECTION(LINESTRING(0 0,1 1)),POLYGON((0 0,1 0,1 1,0 0)))",
+        "GEOMETRYCOLLECTION EMPTY"
+    };
+
+    for ( size_t i = 0; i < sizeof( wkts ) / sizeof( wkts[0] ); ++i ) {
+        std::unique_ptr< Geometry > g( io::readWkt( wkts[i] ) );
+        const std::string flat = io::writeFlatGeometry( *g );
+        std::unique_ptr< Geometry > r( io::readFlatGeometry( flat.data(), flat.size() ) );
+        BOOST_CHECK_EQUAL( r->asText(), g->asText() );
+        BOOST_CHECK_EQUAL( r->isEmpty(), g->isEmpty() );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( view )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "GEOMETRYCOLLECTION(POINT(1 2),POLYGON((0 0,4 0,4 4,0 4,0 0),(1/3 1,1 2,2 2,1/3 1)))" ) );
+    const std::string flat = io::writeFlatGeometry( *g, 2154 );
+
+    // the view does not require an aligned buffer
+    std::string shifted = " " + flat;
+    io::FlatGeometryView view( shifted.data() + 1, flat.size() );
+    BOOST_CHECK_EQUAL( view.SRID(), 2154U );
+    BOOST_CHECK_EQUAL( view.geometryTypeId(), TYPE_GEOMETRYCOLLECTION );
+    BOOST_CHECK_EQUAL( view.numChildren(), 2U );
+    BOOST_CHECK_EQUAL( view.numPoints(), 0U );
+
+    io::FlatGeometryView point = view.childN( 0 );
+    BOOST_CHECK_EQUAL( point.geometryTypeId(), TYPE_POINT );
+    BOOST_CHECK_EQUAL( point.numPoints(), 1U );
+    BOOST_CHECK_EQUAL( point.x( 0 ), 1.0 );
+    BOOST_CHECK_EQUAL( point.y( 0 ), 2.0 );
+    BOOST_CHECK( ! point.is3D() );
+
+    io::FlatGeometryView polygon = view.childN( 1 );
+    BOOST_CHECK_EQUAL( polygon.numChildren(), 2U );
+    BOOST_CHECK( ! polygon.childN( 0 ).hasExactCoordinates() );
+    BOOST_CHECK( polygon.childN( 1 ).hasExactCoordinates() );
+    BOOST_CHECK_EQUAL( polygon.childN( 1 ).numPoints(), 4U );
+
+    // lazy materialisation of a single child
+    std::unique_ptr< Geometry > hole( polygon.childN( 1 ).materialize() );
+    BOOST_CHECK_EQUAL( hole->asText(), g->as< GeometryCollection >().geometryN( 1 ).as< Polygon >().ringN( 1 ).asText() );
+
+    // double coordinates give a compact LineString
+    std::unique_ptr< Geometry > exterior( polygon.childN( 0 ).materialize() );
+    BOOST_CHECK( exterior->as< LineString >().isCompact() );
+
+    std::unique_ptr< PreparedGeometry > prepared( view.materializePrepared() );
+    BOOST_CHECK_EQUAL( prepared->SRID(), 2154U );
+    BOOST_CHECK_EQUAL( prepared->geometry().asText(), g->asText() );
+}
+
+BOOST_AUTO_TEST_CASE( invalidBuffer )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "POLYGON((0 0,4 0,4 4,0 4,0 0),(1/3 1,1 2,2 2,1/3 1))" ) );
+    const std::string flat = io::writeFlatGeometry( *g );
+
+    BOOST_CHECK( io::FlatGeometryView::isFlatGeometry( flat.data(), flat.size() ) );
+    BOOST_CHECK( ! io::FlatGeometryView::isFlatGeometry( "POINT(0 0)", 10 ) );
+
+    // truncated
+    BOOST_CHECK_THROW( io::readFlatGeometry( flat.data(), flat.size() - 8 ), Exception );
+    BOOST_CHECK_THROW( io::readFlatGeometry( flat.data(), 20 ), Exception );
+
+    // unsupported version
+    std::string other = flat;
+    other[4] = 2;
+    BOOST_CHECK_THROW( io::readFlatGeometry( other.data(), other.size() ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE( invalidMemberType )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "MULTILINESTRING((0 0,1 1))" ) );
+    std::string flat = io::writeFlatGeometry( *g );
+
+    // the root node (after the 48 bytes header) becomes a MultiPoint
+    flat[48] = char( TYPE_MULTIPOINT );
+    BOOST_CHECK_THROW( io::readFlatGeometry( flat.data(), flat.size() ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE( nestingLimit )
+{
+    std::unique_ptr< Geometry > g( new Point( 1, 2 ) );
+
+    for ( int depth = 1; depth <= 200; ++depth ) {
+        std::unique_ptr< GeometryCollection > collection( new GeometryCollection() );
+        collection->addGeometry( g.release() );
+        g.reset( collection.release() );
+
+        if ( depth == 128 ) {
+            const std::string flat = io::writeFlatGeometry( *g );
+            BOOST_CHECK( *io::readFlatGeometry( flat.data(), flat.size() ) == *g );
+        }
+    }
+
+    const std::string flat = io::writeFlatGeometry( *g );
+    BOOST_CHECK_THROW( io::readFlatGeometry( flat.data(), flat.size() ), Exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,7 @@
  *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
  */
 #include <memory>
+#include <sstream>
 #include <string>
 
 #include <SFCGAL/Point.h>
@@ -33,6 +34,7 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/io/wkt.h>
+#include <SFCGAL/io/ewkt.h>
 
 #include <boost/test/unit_test.hpp>
 using namespace boost::unit_test ;
@@ -258,6 +260,89 @@ BOOST_AUTO_TEST_CASE( wkt_exactTest )
     BOOST_CHECK_EQUAL( yd, 2 );
 }
 
+BOOST_AUTO_TEST_CASE( wkt_exactDecimals )
+{
+    std::unique_ptr< Geometry > g( readWkt( "LINESTRING(0.1 -0.25,1.5e3 2.5E-1,123456789012345678901234 -1e-30)" ) );
+    BOOST_REQUIRE( g->is< LineString >() );
+    const LineString& ls = g->as< LineString >();
+    BOOST_REQUIRE_EQUAL( ls.numPoints(), 3U );
+
+    // 0.1 is not rounded to the nearest double
+    BOOST_CHECK( CGAL::exact( ls.pointN( 0 ).x() ) == Kernel::Exact_kernel::FT( 1 ) / 10 );
+    BOOST_CHECK( CGAL::exact( ls.pointN( 0 ).y() ) == Kernel::Exact_kernel::FT( -0.25 ) );
+    BOOST_CHECK( CGAL::exact( ls.pointN( 1 ).x() ) == Kernel::Exact_kernel::FT( 1500 ) );
+    BOOST_CHECK( CGAL::exact( ls.pointN( 1 ).y() ) == Kernel::Exact_kernel::FT( 0.25 ) );
+    BOOST_CHECK( CGAL::exact( ls.pointN( 2 ).x() ) == Kernel::Exact_kernel::FT( "123456789012345678901234" ) );
+
+    Kernel::Exact_kernel::FT tenPow30( 1 );
+
+    for ( int i = 0; i < 30; i++ ) {
+        tenPow30 *= 10;
+    }
+
+    BOOST_CHECK( CGAL::exact( ls.pointN( 2 ).y() ) == Kernel::Exact_kernel::FT( -1 ) / tenPow30 );
+}
+
+BOOST_AUTO_TEST_CASE( wkt_badNumbers )
+{
+    BOOST_CHECK_THROW( readWkt( "POINT(1/0 2)" ), WktParseException );
+    BOOST_CHECK_THROW( readWkt( "POINT(- 2)" ), WktParseException );
+    BOOST_CHECK_THROW( readWkt( "POINT(1 2 3 4 5)" ), WktParseException );
+
+    // far beyond the range of doubles
+    BOOST_CHECK_THROW( readWkt( "POINT(1e99999999 0)" ), WktParseException );
+    BOOST_CHECK_THROW( readWkt( "POINT(0 -2.5e-99999999)" ), WktParseException );
+    BOOST_CHECK_THROW( readWkt( "POINT(1e400 0)" ), WktParseException );
+    BOOST_CHECK_EQUAL( readWkt( "POINT(0e99999999 1e300)" )->asText( 0 ), readWkt( "POINT(0 1e300)" )->asText( 0 ) );
+    BOOST_CHECK( readWkt( "POINT(1e-330 1)" )->as< Point >().x() > 0 );
+}
+
+BOOST_AUTO_TEST_CASE( ewktSrid )
+{
+    std::unique_ptr< PreparedGeometry > g( readEwkt( " SRID=4326; POINT( 1 2 )  " ) );
+    BOOST_CHECK_EQUAL( g->SRID(), 4326U );
+    BOOST_CHECK_EQUAL( g->geometry().asText( 0 ), "POINT(1 2)" );
+
+    BOOST_CHECK_THROW( readEwkt( "SRID=;POINT(1 2)" ), WktParseException );
+}
+
+BOOST_AUTO_TEST_CASE( streamRead )
+{
+    // the stream is left after the geometry
+    std::istringstream iss( "POINT(1 2) POINT(3 4)" );
+    std::unique_ptr< Geometry > g( readWkt( iss ) );
+    BOOST_CHECK_EQUAL( g->asText( 0 ), "POINT(1 2)" );
+    g = readWkt( iss );
+    BOOST_CHECK_EQUAL( g->asText( 0 ), "POINT(3 4)" );
+}
+
+namespace {
+// stream buffer which can't seek, like a pipe
+struct UnseekableBuffer : public std::streambuf {
+    UnseekableBuffer( const std::string& text ) : _text( text ) {
+        setg( &_text[0], &_text[0], &_text[0] + _text.size() );
+    }
+
+    std::string _text;
+};
+} // namespace
+
+BOOST_AUTO_TEST_CASE( unseekableStreamRead )
+{
+    UnseekableBuffer buffer( "SRID=4326;POINT EMPTY\nGEOMETRYCOLLECTION(POINT EMPTY,POINT(1 2))\nPOINT(3 4)" );
+    std::istream is( &buffer );
+
+    std::unique_ptr< PreparedGeometry > pg( readEwkt( is ) );
+    BOOST_CHECK_EQUAL( pg->SRID(), 4326U );
+    BOOST_CHECK( pg->geometry().is< Point >() );
+    BOOST_CHECK( pg->geometry().isEmpty() );
+
+    std::unique_ptr< Geometry > g( readWkt( is ) );
+    BOOST_CHECK_EQUAL( g->asText( 0 ), "GEOMETRYCOLLECTION(POINT EMPTY,POINT(1 2))" );
+    g = readWkt( is );
+    BOOST_CHECK_EQUAL( g->asText( 0 ), "POINT(3 4)" );
+}
+
 BOOST_AUTO_TEST_CASE( charArrayRead )
 {
     char str[] = "LINESTRING(0.0 0.0,1.0 1.0)";
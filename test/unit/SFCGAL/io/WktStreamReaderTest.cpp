@@ -0,0 +1,124 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/io/WktStreamReader.h>
+
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test ;
+
+using namespace SFCGAL ;
+using namespace SFCGAL::io ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_io_WktStreamReaderTest )
+
+namespace {
+std::vector< std::string > readAll( const std::string& text, bool expandCollections, size_t numThreads, size_t batchSize = 256 )
+{
+    std::istringstream iss( text );
+    WktStreamReader reader( iss, expandCollections, numThreads, batchSize );
+    std::vector< std::string > wkts;
+
+    while ( std::unique_ptr< Geometry > g = reader.next() ) {
+        wkts.push_back( g->asText( 0 ) );
+    }
+
+    return wkts;
+}
+}
+
+BOOST_AUTO_TEST_CASE( oneGeometryPerLine )
+{
+    std::vector< std::string > wkts = readAll( "POINT(1 2)\nLINESTRING(0 0,1 1)\n\nPOINT EMPTY\nPOINT EMPTY POLYGON\n((0 0,1 0,0 1,0 0))\n", false, 1 );
+    BOOST_REQUIRE_EQUAL( wkts.size(), 5U );
+    BOOST_CHECK_EQUAL( wkts[0], "POINT(1 2)" );
+    BOOST_CHECK_EQUAL( wkts[1], "LINESTRING(0 0,1 1)" );
+    BOOST_CHECK_EQUAL( wkts[2], "POINT EMPTY" );
+    BOOST_CHECK_EQUAL( wkts[3], "POINT EMPTY" );
+    BOOST_CHECK_EQUAL( wkts[4], "POLYGON((0 0,1 0,0 1,0 0))" );
+}
+
+BOOST_AUTO_TEST_CASE( collectionMembers )
+{
+    const std::string text( "SRID=4326;GEOMETRYCOLLECTION(POINT(1 2),GEOMETRYCOLLECTION(POINT(1 1)),POINT EMPTY) POINT(5 5) GEOMETRYCOLLECTION EMPTY" );
+
+    std::vector< std::string > wkts = readAll( text, false, 1 );
+    BOOST_REQUIRE_EQUAL( wkts.size(), 3U );
+    BOOST_CHECK_EQUAL( wkts[0], "GEOMETRYCOLLECTION(POINT(1 2),GEOMETRYCOLLECTION(POINT(1 1)),POINT EMPTY)" );
+
+    std::istringstream iss( text );
+    WktStreamReader reader( iss, true );
+    std::unique_ptr< Geometry > g = reader.next();
+    BOOST_REQUIRE( g.get() );
+    BOOST_CHECK_EQUAL( g->asText( 0 ), "POINT(1 2)" );
+    BOOST_CHECK_EQUAL( reader.srid(), 4326U );
+    g = reader.next();
+    BOOST_REQUIRE( g.get() );
+    BOOST_CHECK_EQUAL( g->asText( 0 ), "GEOMETRYCOLLECTION(POINT(1 1))" );
+    g = reader.next();
+    BOOST_REQUIRE( g.get() );
+    BOOST_CHECK( g->isEmpty() );
+    g = reader.next();
+    BOOST_REQUIRE( g.get() );
+    BOOST_CHECK_EQUAL( g->asText( 0 ), "POINT(5 5)" );
+    BOOST_CHECK_EQUAL( reader.srid(), 0U );
+    BOOST_CHECK( ! reader.next() );
+}
+
+BOOST_AUTO_TEST_CASE( parallelOrder )
+{
+    std::ostringstream lines, collection;
+    collection << "GEOMETRYCOLLECTION(";
+
+    for ( int i = 0; i < 1000; i++ ) {
+        lines << "LINESTRING(" << i << " 0," << i << " 1)\n";
+        collection << ( i ? "," : "" ) << "LINESTRING(" << i << " 0," << i << " 1)";
+    }
+
+    collection << ")";
+
+    const std::vector< std::string > expected = readAll( lines.str(), false, 1 );
+    BOOST_REQUIRE_EQUAL( expected.size(), 1000U );
+    BOOST_CHECK( readAll( lines.str(), false, 4, 7 ) == expected );
+    BOOST_CHECK( readAll( collection.str(), true, 4, 7 ) == expected );
+}
+
+BOOST_AUTO_TEST_CASE( parseErrors )
+{
+    // the geometries before the error are returned
+    std::istringstream iss( "POINT(1 2)\nPOINT(1)\nPOINT(3 4)" );
+    WktStreamReader reader( iss, false, 2, 16 );
+    BOOST_CHECK( reader.next().get() );
+    BOOST_CHECK_THROW( reader.next(), WktParseException );
+    BOOST_CHECK( reader.next().get() );
+    BOOST_CHECK( ! reader.next() );
+
+    BOOST_CHECK_THROW( readAll( "GEOMETRYCOLLECTION(POINT(1 2)", true, 1 ), WktParseException );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
@@ -0,0 +1,130 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <clocale>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/io/ewkt.h>
+#include <SFCGAL/detail/io/WktWriter.h>
+
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test ;
+
+using namespace SFCGAL ;
+using namespace SFCGAL::io ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_io_WktWriterTest )
+
+BOOST_AUTO_TEST_CASE( exactRationals )
+{
+    std::unique_ptr< Geometry > g( readWkt( "LINESTRING(-2/3 0.5,0 123456789012345678901234)" ) );
+    BOOST_CHECK_EQUAL( g->asText(), "LINESTRING(-2/3 1/2,0/1 123456789012345678901234/1)" );
+}
+
+BOOST_AUTO_TEST_CASE( fixedDecimals )
+{
+    std::unique_ptr< Geometry > g( readWkt( "POINT ZM(1/3 -2 1e20 4.25)" ) );
+    BOOST_CHECK_EQUAL( g->asText( 3 ), "POINT ZM(0.333 -2.000 100000000000000000000.000 4.250)" );
+    BOOST_CHECK_EQUAL( g->asText( 0 ), "POINT ZM(0 -2 100000000000000000000 4)" );
+}
+
+BOOST_AUTO_TEST_CASE( shortestDecimals )
+{
+    std::unique_ptr< Geometry > g( readWkt( "LINESTRING M(0.1 1/3 0.3,1e-7 2 1)" ) );
+    const std::string wkt = g->asText( -2 );
+    BOOST_CHECK_EQUAL( wkt, "LINESTRING M(0.1 0.3333333333333333 0.3,1e-07 2 1)" );
+
+    // reads back to the same doubles
+    std::unique_ptr< Geometry > h( readWkt( wkt ) );
+    BOOST_CHECK_EQUAL( CGAL::to_double( h->as< LineString >().pointN( 0 ).y() ), 1.0 / 3.0 );
+}
+
+BOOST_AUTO_TEST_CASE( compactLineString )
+{
+    std::unique_ptr< Geometry > g( readWkt( "LINESTRING Z(0 0.5 1,2.25 3 -4)" ) );
+    const std::string exact = g->asText();
+    const std::string fixed = g->asText( 2 );
+    BOOST_REQUIRE( g->as< LineString >().compact() );
+    BOOST_CHECK_EQUAL( g->asText(), exact );
+    BOOST_CHECK_EQUAL( g->asText( 2 ), fixed );
+}
+
+BOOST_AUTO_TEST_CASE( appendToBuffer )
+{
+    std::string buffer( "1:" );
+    writeWkt( *readWkt( "POINT(1 2)" ), buffer, 1 );
+    buffer += ";2:";
+    writeWkt( *readWkt( "POINT EMPTY" ), buffer );
+    BOOST_CHECK_EQUAL( buffer, "1:POINT(1.0 2.0);2:POINT EMPTY" );
+
+    std::unique_ptr< PreparedGeometry > pg( readEwkt( "SRID=4326;POINT(1 2)" ) );
+    buffer.clear();
+    writeEwkt( *pg, buffer, 0 );
+    BOOST_CHECK_EQUAL( buffer, "SRID=4326;POINT(1 2)" );
+    BOOST_CHECK_EQUAL( pg->asEWKT( 0 ), buffer );
+}
+
+BOOST_AUTO_TEST_CASE( streamFormat )
+{
+    // the stream precision is still used
+    std::ostringstream oss;
+    oss << std::fixed ;
+    oss.precision( 1 );
+    detail::io::WktWriter writer( oss );
+    writer.write( *readWkt( "POINT(1/3 2)" ) );
+    BOOST_CHECK_EQUAL( oss.str(), "POINT(0.3 2.0)" );
+}
+
+BOOST_AUTO_TEST_CASE( numericLocale )
+{
+    // decimal commas in the C locale do not change the WKT
+    const char* locales[] = { "de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR" };
+    const std::string previous = std::setlocale( LC_NUMERIC, NULL );
+    bool found = false;
+
+    for ( size_t i = 0; i < sizeof( locales ) / sizeof( locales[0] ) && ! found; i++ ) {
+        found = std::setlocale( LC_NUMERIC, locales[i] ) != NULL;
+    }
+
+    if ( ! found ) {
+        BOOST_TEST_MESSAGE( "no locale with a decimal comma, skipped" );
+        return;
+    }
+
+    std::unique_ptr< Geometry > g( readWkt( "LINESTRING(1.5 1/3,1e30 -0.25)" ) );
+    const std::string fixed = g->asText( 2 );
+    const std::string shortest = g->asText( -2 );
+    std::ostringstream general;
+    general.precision( 3 );
+    detail::io::WktWriter( general ).write( *g );
+    std::setlocale( LC_NUMERIC, previous.c_str() );
+
+    BOOST_CHECK_EQUAL( fixed, "LINESTRING(1.50 0.33,1000000000000000019884624838656.00 -0.25)" );
+    BOOST_CHECK_EQUAL( shortest, "LINESTRING(1.5 0.3333333333333333,1e+30 -0.25)" );
+    BOOST_CHECK_EQUAL( general.str(), "LINESTRING(1.5 0.333,1e+30 -0.25)" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
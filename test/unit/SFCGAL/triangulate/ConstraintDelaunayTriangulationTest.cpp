@@ -107,6 +107,87 @@ BOOST_AUTO_TEST_CASE( testProjectionPlane )
 
 
 
+BOOST_AUTO_TEST_CASE( testAddVertices )
+{
+    ConstraintDelaunayTriangulation triangulation ;
+    typedef ConstraintDelaunayTriangulation::Vertex_handle Vertex_handle ;
+
+    std::vector< Coordinate > positions ;
+    positions.push_back( Coordinate( 0.0,0.0,1.0 ) );
+    positions.push_back( Coordinate( 2.0,0.0,1.0 ) );
+    positions.push_back( Coordinate( 2.0,2.0,1.0 ) );
+    positions.push_back( Coordinate( 0.0,2.0,1.0 ) );
+    positions.push_back( Coordinate( 1.0,1.0,5.0 ) );
+    // duplicate, the last coordinate is kept as with addVertex
+    positions.push_back( Coordinate( 1.0,1.0,7.0 ) );
+
+    std::vector< Vertex_handle > vertices = triangulation.addVertices( positions );
+    BOOST_REQUIRE_EQUAL( vertices.size(), 6U );
+    BOOST_CHECK_EQUAL( triangulation.numVertices(), 5U );
+    BOOST_CHECK_EQUAL( triangulation.numTriangles(), 4U );
+    BOOST_CHECK( vertices[4] == vertices[5] );
+    BOOST_CHECK( vertices[4]->info().original.z() == 7.0 );
+
+    for ( size_t i = 0; i < 4; i++ ) {
+        BOOST_CHECK( vertices[i]->info().original == positions[i] );
+    }
+
+    std::vector< std::pair< size_t, size_t > > constraints ;
+
+    for ( size_t i = 0; i < 4; i++ ) {
+        constraints.push_back( std::make_pair( i, ( i + 1 ) % 4 ) );
+    }
+
+    triangulation.addConstraints( vertices, constraints );
+
+    size_t numConstrained = 0 ;
+
+    for ( ConstraintDelaunayTriangulation::CDT::Finite_edges_iterator it = triangulation.cdt().finite_edges_begin(); it != triangulation.cdt().finite_edges_end(); ++it ) {
+        if ( triangulation.cdt().is_constrained( *it ) ) {
+            numConstrained++ ;
+        }
+    }
+
+    BOOST_CHECK_EQUAL( numConstrained, 4U );
+
+    BOOST_CHECK_THROW( triangulation.addVertices( std::vector< Coordinate >( 1, Coordinate() ) ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE( testAddVerticesCocircular )
+{
+    typedef ConstraintDelaunayTriangulation::Vertex_handle Vertex_handle ;
+
+    // 12 points on the circle of radius 5, the triangles depend on the insertion order
+    const double xy[12][2] = {
+        { 5, 0 }, { 4, 3 }, { 3, 4 }, { 0, 5 }, { -3, 4 }, { -4, 3 },
+        { -5, 0 }, { -4, -3 }, { -3, -4 }, { 0, -5 }, { 3, -4 }, { 4, -3 }
+    };
+    std::vector< Coordinate > positions ;
+
+    for ( size_t i = 0; i < 12; i++ ) {
+        positions.push_back( Coordinate( xy[i][0], xy[i][1] ) );
+    }
+
+    ConstraintDelaunayTriangulation batch ;
+    std::vector< Vertex_handle > vertices = batch.addVertices( positions );
+
+    ConstraintDelaunayTriangulation successive ;
+
+    for ( size_t i = 0; i < positions.size(); i++ ) {
+        successive.addVertex( positions[i] );
+    }
+
+    // same vertices and number of triangles, each position has its own vertex
+    BOOST_CHECK_EQUAL( batch.numVertices(), successive.numVertices() );
+    BOOST_CHECK_EQUAL( batch.numTriangles(), successive.numTriangles() );
+    BOOST_CHECK_EQUAL( batch.numTriangles(), 10U );
+
+    for ( size_t i = 0; i < positions.size(); i++ ) {
+        BOOST_CHECK( vertices[i]->info().original == positions[i] );
+        BOOST_CHECK( vertices[i]->point() == positions[i].toPoint_2() );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -0,0 +1,107 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/area.h>
+#include <SFCGAL/algorithm/normal.h>
+#include <SFCGAL/algorithm/volume.h>
+#include <SFCGAL/triangulate/triangulatePolygon.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+using namespace SFCGAL::triangulate ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_triangulate_TriangulatePolygonTest )
+
+//
+// same area as the constrained Delaunay triangulation and triangles oriented as the polygon
+void checkFastTriangulation( const std::string& wkt, const size_t& numTriangles )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( wkt ) );
+    const Polygon& polygon = g->as< Polygon >();
+
+    TriangulatedSurface delaunay, fast ;
+    triangulatePolygon3D( polygon, delaunay, TRIANGULATION_DELAUNAY );
+    triangulatePolygon3D( polygon, fast, TRIANGULATION_FAST );
+
+    BOOST_TEST_MESSAGE( fast.asText() );
+    BOOST_CHECK_EQUAL( fast.numTriangles(), numTriangles );
+    BOOST_CHECK_CLOSE( algorithm::area3D( fast ), algorithm::area3D( delaunay ), 1e-9 );
+
+    const Kernel::Vector_3 normal = algorithm::normal3D< Kernel >( polygon );
+
+    for ( size_t i = 0; i < fast.numTriangles(); i++ ) {
+        const Kernel::Vector_3 n = algorithm::normal3D< Kernel >( fast.triangleN( i ).toPolygon() );
+        BOOST_CHECK( n * normal > 0 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testFastConvex )
+{
+    checkFastTriangulation( "POLYGON((0 0,1 0,1 1,0 1,0 0))", 2 );
+    // clockwise
+    checkFastTriangulation( "POLYGON((0 0,0 1,1 1,1 0,0 0))", 2 );
+    // vertical face of an extruded building
+    checkFastTriangulation( "POLYGON((0 0 0,0 0 3,2 0 3,2 0 0,0 0 0))", 2 );
+    checkFastTriangulation( "POLYGON((0 0 0,3 0 0,4 1 1,3 2 2,0 2 2,-1 1 1,0 0 0))", 4 );
+}
+
+BOOST_AUTO_TEST_CASE( testFastNonConvex )
+{
+    // L shape
+    checkFastTriangulation( "POLYGON((0 0,2 0,2 1,1 1,1 2,0 2,0 0))", 4 );
+    // U shape, clockwise, in the plane x = 1
+    checkFastTriangulation( "POLYGON((1 0 0,1 0 3,1 1 3,1 1 1,1 2 1,1 2 3,1 3 3,1 3 0,1 0 0))", 6 );
+}
+
+BOOST_AUTO_TEST_CASE( testFastFallback )
+{
+    const char* wkts[] = {
+        // hole
+        "POLYGON((0 0,4 0,4 4,0 4,0 0),(1 1,1 3,3 3,3 1,1 1))",
+        // flat vertex
+        "POLYGON((0 0,1 0,2 0,2 2,0 2,0 0))"
+    };
+
+    for ( size_t i = 0; i < sizeof( wkts ) / sizeof( wkts[0] ); i++ ) {
+        std::unique_ptr< Geometry > g( io::readWkt( wkts[i] ) );
+        TriangulatedSurface delaunay, fast ;
+        triangulatePolygon3D( *g, delaunay, TRIANGULATION_DELAUNAY );
+        triangulatePolygon3D( *g, fast, TRIANGULATION_FAST );
+        BOOST_CHECK_EQUAL( fast.asText(), delaunay.asText() );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testFastSolid )
+{
+    std::unique_ptr< Geometry > g( io::readWkt( "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" ) );
+
+    TriangulatedSurface fast ;
+    triangulatePolygon3D( *g, fast, TRIANGULATION_FAST );
+    BOOST_CHECK_EQUAL( fast.numTriangles(), 12U );
+    BOOST_CHECK_EQUAL( algorithm::volume( *g ), 1 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()